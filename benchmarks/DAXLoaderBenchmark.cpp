@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * Benchmark of Workflow::loadFromDAX() on a large synthetic DAX file.
+ *
+ * A layered DAX file (by default with 1M jobs) is written to disk, in which each job
+ * reads the output file of one job of the previous level and is the child of 3 jobs of
+ * the previous level. The file is then loaded, and the load time and peak memory
+ * footprint (resident set size) are reported.
+ *
+ * With --dom, the file is instead only parsed into a pugixml DOM tree (i.e., the first
+ * step of the previous, non-streaming, DAX loader), which shows the memory that it
+ * required on top of that of the workflow.
+ *
+ * With --binary, the loaded workflow is also saved as a binary snapshot (Workflow::saveBinary()),
+ * and the time to load that snapshot (Workflow::loadBinary()) is reported.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/resource.h>
+#include <pugixml.hpp>
+
+#include "wrench/workflow/Workflow.h"
+
+/**
+ * @brief Get the peak resident set size of the process
+ * @return a size in MB
+ */
+double getPeakRSS() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024.0;
+}
+
+/**
+ * @brief Write a layered synthetic DAX file
+ * @param path: the path of the file
+ * @param num_tasks: the number of jobs
+ * @param width: the number of jobs per level
+ */
+void writeLayeredDAX(const std::string &path, unsigned long num_tasks, unsigned long width) {
+  FILE *dax = fopen(path.c_str(), "w");
+  if (dax == nullptr) {
+    std::cerr << "Cannot write " << path << std::endl;
+    exit(1);
+  }
+
+  fprintf(dax, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+  fprintf(dax, "<!-- synthetic layered workflow -->\n");
+  fprintf(dax, "<adag xmlns=\"http://pegasus.isi.edu/schema/DAX\" version=\"2.1\" name=\"synthetic\" "
+               "jobCount=\"%lu\">\n", num_tasks);
+
+  for (unsigned long i = 0; i < num_tasks; i++) {
+    fprintf(dax, "  <job id=\"ID%08lu\" namespace=\"synthetic\" name=\"task_%lu\" version=\"1.0\" "
+                 "runtime=\"%.2f\" num_procs=\"%lu\">\n", i, i / width, 1.0 + (i % 100), 1 + (i % 4));
+    if (i >= width) {
+      fprintf(dax, "    <uses file=\"file_%08lu.out\" link=\"input\" register=\"true\" transfer=\"true\" "
+                   "optional=\"false\" type=\"data\" size=\"%lu\"/>\n", i - width, 1000 + (i - width));
+    } else {
+      fprintf(dax, "    <uses file=\"input.dat\" link=\"input\" register=\"true\" transfer=\"true\" "
+                   "optional=\"false\" type=\"data\" size=\"1000000\"/>\n");
+    }
+    fprintf(dax, "    <uses file=\"file_%08lu.out\" link=\"output\" register=\"true\" transfer=\"true\" "
+                 "optional=\"false\" type=\"data\" size=\"%lu\"/>\n", i, 1000 + i);
+    fprintf(dax, "  </job>\n");
+  }
+
+  for (unsigned long i = width; i < num_tasks; i++) {
+    unsigned long level_start = (i / width - 1) * width;
+    fprintf(dax, "  <child ref=\"ID%08lu\">\n", i);
+    for (unsigned long j = 0; j < 3; j++) {
+      fprintf(dax, "    <parent ref=\"ID%08lu\"/>\n", level_start + (i % width + j * 7) % width);
+    }
+    fprintf(dax, "  </child>\n");
+  }
+
+  fprintf(dax, "</adag>\n");
+  fclose(dax);
+}
+
+int main(int argc, char **argv) {
+
+  unsigned long num_tasks = 1000000;
+  unsigned long width = 1000;
+  std::string path = "/tmp/synthetic_workflow.dax";
+  bool dom = false;
+  bool keep = false;
+  bool binary = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (not strcmp(argv[i], "--dom")) {
+      dom = true;
+    } else if (not strcmp(argv[i], "--binary")) {
+      binary = true;
+    } else if (not strcmp(argv[i], "--keep")) {
+      keep = true;
+    } else if ((not strcmp(argv[i], "--num-tasks")) and (i + 1 < argc)) {
+      num_tasks = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--width")) and (i + 1 < argc)) {
+      width = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--dax")) and (i + 1 < argc)) {
+      path = argv[++i];
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--num-tasks <n>] [--width <n>] [--dax <path>] [--keep] [--dom | --binary]" << std::endl;
+      exit(1);
+    }
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  writeLayeredDAX(path, num_tasks, width);
+  auto end = std::chrono::steady_clock::now();
+  std::cerr << "Wrote a " << num_tasks << "-job DAX file (" << path << ") in "
+            << std::chrono::duration<double>(end - begin).count() << " sec" << std::endl;
+  std::cerr << "Peak RSS before loading: " << getPeakRSS() << " MB" << std::endl;
+
+  begin = std::chrono::steady_clock::now();
+  if (dom) {
+    pugi::xml_document dax_tree;
+    if (not dax_tree.load_file(path.c_str())) {
+      std::cerr << "Invalid DAX file" << std::endl;
+      exit(1);
+    }
+    end = std::chrono::steady_clock::now();
+    std::cerr << "Parsed the DAX file into a DOM tree in "
+              << std::chrono::duration<double>(end - begin).count() << " sec" << std::endl;
+  } else {
+    wrench::Workflow workflow;
+    workflow.loadFromDAX(path, "1f");
+    end = std::chrono::steady_clock::now();
+    std::cerr << "Loaded a " << workflow.getNumberOfTasks() << "-task workflow with "
+              << workflow.getFiles().size() << " files and " << workflow.getNumLevels() << " levels in "
+              << std::chrono::duration<double>(end - begin).count() << " sec" << std::endl;
+    std::cerr << "Peak RSS after loading: " << getPeakRSS() << " MB" << std::endl;
+
+    if (binary) {
+      std::string binary_path = path + ".bin";
+      begin = std::chrono::steady_clock::now();
+      workflow.saveBinary(binary_path);
+      end = std::chrono::steady_clock::now();
+      std::cerr << "Saved a binary snapshot (" << binary_path << ") in "
+                << std::chrono::duration<double>(end - begin).count() << " sec" << std::endl;
+
+      begin = std::chrono::steady_clock::now();
+      wrench::Workflow snapshot_workflow;
+      snapshot_workflow.loadBinary(binary_path);
+      end = std::chrono::steady_clock::now();
+      std::cerr << "Loaded a " << snapshot_workflow.getNumberOfTasks() << "-task workflow from the binary snapshot in "
+                << std::chrono::duration<double>(end - begin).count() << " sec" << std::endl;
+      if (not keep) {
+        remove(binary_path.c_str());
+      }
+    }
+  }
+  if (dom) {
+    std::cerr << "Peak RSS after loading: " << getPeakRSS() << " MB" << std::endl;
+  }
+
+  if (not keep) {
+    remove(path.c_str());
+  }
+
+  return 0;
+}
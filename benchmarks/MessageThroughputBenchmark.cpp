@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * Benchmark of message throughput on many mailboxes.
+ *
+ * By default, the message bookkeeping done by S4U_Mailbox::putMessage() and
+ * S4U_Mailbox::getMessage() (i.e., the MessageManager calls) is replayed without a
+ * simulation: each of the mailboxes holds a queue of in-flight messages, and messages
+ * are put into and then received from all mailboxes, round-robin.
+ *
+ * With --simulate, actual messages are exchanged in a SimGrid simulation: each mailbox
+ * has one receiver actor and (queue depth) sender actors, which all call
+ * S4U_Mailbox::putMessage() and S4U_Mailbox::getMessage().
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <simgrid/s4u.hpp>
+
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simulation/SimulationMessage.h"
+#include "wrench/util/MessageManager.h"
+
+/**
+ * @brief Replay the MessageManager bookkeeping of message exchanges
+ * @param mailboxes: the mailbox names
+ * @param queue_depth: the number of in-flight messages per mailbox
+ * @param num_rounds: the number of rounds
+ * @return the number of messages
+ */
+unsigned long replayBookkeeping(const std::vector<std::string> &mailboxes,
+                                unsigned long queue_depth, unsigned long num_rounds) {
+  std::vector<std::vector<wrench::SimulationMessage *>> queues(mailboxes.size());
+  unsigned long num_messages = 0;
+
+  for (unsigned long round = 0; round < num_rounds; round++) {
+    // Put messages into all mailboxes
+    for (unsigned long m = 0; m < mailboxes.size(); m++) {
+      for (unsigned long i = 0; i < queue_depth; i++) {
+        auto msg = new wrench::SimulationMessage("benchmark", 0);
+        wrench::MessageManager::manageMessage(mailboxes[m], msg);
+        queues[m].push_back(msg);
+      }
+    }
+    // Receive them (in FIFO order)
+    for (unsigned long m = 0; m < mailboxes.size(); m++) {
+      for (auto msg : queues[m]) {
+        wrench::MessageManager::removeReceivedMessages(mailboxes[m], msg);
+        delete msg;
+        num_messages++;
+      }
+      queues[m].clear();
+    }
+  }
+  return num_messages;
+}
+
+/**
+ * @brief Exchange messages between actors in a SimGrid simulation
+ * @param argc: the number of command-line arguments
+ * @param argv: the command-line arguments
+ * @param mailboxes: the mailbox names
+ * @param queue_depth: the number of sender actors per mailbox
+ * @param num_rounds: the number of messages sent by each sender actor
+ * @return the number of messages
+ */
+unsigned long simulate(int argc, char **argv, const std::vector<std::string> &mailboxes,
+                       unsigned long queue_depth, unsigned long num_rounds) {
+  std::string platform_file_path = "/tmp/message_benchmark_platform.xml";
+  FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+  fprintf(platform_file, "<?xml version='1.0'?>"
+                         "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                         "<platform version=\"4.1\"> "
+                         "   <zone id=\"AS0\" routing=\"Full\"> "
+                         "       <host id=\"Sender\" speed=\"1f\"/> "
+                         "       <host id=\"Receiver\" speed=\"1f\"/> "
+                         "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
+                         "       <route src=\"Sender\" dst=\"Receiver\"> <link_ctn id=\"1\"/> </route>"
+                         "   </zone> "
+                         "</platform>");
+  fclose(platform_file);
+
+  simgrid::s4u::Engine engine(&argc, argv);
+  engine.load_platform(platform_file_path.c_str());
+  remove(platform_file_path.c_str());
+
+  unsigned long num_messages = 0;
+  for (auto const &mailbox : mailboxes) {
+    for (unsigned long i = 0; i < queue_depth; i++) {
+      simgrid::s4u::Actor::create("sender", simgrid::s4u::Host::by_name("Sender"), [mailbox, num_rounds]() {
+          for (unsigned long round = 0; round < num_rounds; round++) {
+            wrench::S4U_Mailbox::putMessage(mailbox, new wrench::SimulationMessage("benchmark", 0));
+          }
+      });
+    }
+    simgrid::s4u::Actor::create("receiver", simgrid::s4u::Host::by_name("Receiver"),
+                                [mailbox, queue_depth, num_rounds, &num_messages]() {
+                                    for (unsigned long i = 0; i < queue_depth * num_rounds; i++) {
+                                      wrench::S4U_Mailbox::getMessage(mailbox);
+                                      num_messages++;
+                                    }
+                                });
+  }
+  engine.run();
+  return num_messages;
+}
+
+int main(int argc, char **argv) {
+
+  unsigned long num_mailboxes = 10000;
+  unsigned long queue_depth = 10;
+  unsigned long num_rounds = 10;
+  bool simulation = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (not strcmp(argv[i], "--simulate")) {
+      simulation = true;
+    } else if ((not strcmp(argv[i], "--num-mailboxes")) and (i + 1 < argc)) {
+      num_mailboxes = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--queue-depth")) and (i + 1 < argc)) {
+      queue_depth = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--num-rounds")) and (i + 1 < argc)) {
+      num_rounds = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--num-mailboxes <n>] [--queue-depth <n>] [--num-rounds <n>] [--simulate]" << std::endl;
+      exit(1);
+    }
+  }
+
+  std::vector<std::string> mailboxes;
+  for (unsigned long i = 0; i < num_mailboxes; i++) {
+    mailboxes.push_back(wrench::S4U_Mailbox::generateUniqueMailboxName("benchmark_mailbox"));
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  unsigned long num_messages = (simulation ? simulate(argc, argv, mailboxes, queue_depth, num_rounds)
+                                           : replayBookkeeping(mailboxes, queue_depth, num_rounds));
+  auto end = std::chrono::steady_clock::now();
+
+  double elapsed = std::chrono::duration<double>(end - begin).count();
+  std::cerr << "Exchanged " << num_messages << " messages on " << num_mailboxes << " mailboxes (queue depth "
+            << queue_depth << ") in " << elapsed << " sec (" << num_messages / elapsed << " messages/sec, "
+            << (simulation ? "simulation" : "bookkeeping only") << ")" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * Benchmark of the convergence of a NetworkProximityService.
+ *
+ * The hosts (by default 100) are peers of a SimGrid Vivaldi zone, placed at random coordinates, so that the
+ * latency between two hosts is known from their coordinates. A network proximity service (by default
+ * VIVALDI with 10% coverage) monitors all hosts. At regular checkpoints, a WMS queries the proximity estimates
+ * between a sample of reference hosts and all other hosts, and reports the fraction of estimates that are
+ * available and their mean relative error. The replay time and the peak memory footprint (resident set size)
+ * are reported at the end. Run it for, e.g., 100, 500, 1000, 2000, and 5000 hosts to see how the service scales.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <sys/resource.h>
+
+#include <wrench-dev.h>
+
+/**
+ * @brief Get the peak resident set size of the process
+ * @return a size in MB
+ */
+double getPeakRSS() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024.0;
+}
+
+/**
+ * @brief The proximity estimates at some date
+ */
+struct Checkpoint {
+    double date;
+    double available_fraction;
+    double mean_relative_error;
+};
+
+/**
+ * @brief A WMS that periodically compares the estimates of a network proximity service to the actual latencies
+ */
+class ProximityCheckWMS : public wrench::WMS {
+
+public:
+    ProximityCheckWMS(wrench::NetworkProximityService *network_proximity_service,
+                      const std::vector<std::string> &hostnames,
+                      const std::vector<std::pair<double, double>> &coordinates,
+                      unsigned long num_checkpoints, double checkpoint_interval, std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {network_proximity_service}, nullptr, hostname, "proximity_check"),
+            network_proximity_service(network_proximity_service), hostnames(hostnames), coordinates(coordinates),
+            num_checkpoints(num_checkpoints), checkpoint_interval(checkpoint_interval) {}
+
+    std::vector<Checkpoint> checkpoints;
+
+private:
+    wrench::NetworkProximityService *network_proximity_service;
+    const std::vector<std::string> &hostnames;
+    const std::vector<std::pair<double, double>> &coordinates;
+    unsigned long num_checkpoints;
+    double checkpoint_interval;
+
+    int main() override {
+      const unsigned long num_reference_hosts = std::min<unsigned long>(20, this->hostnames.size());
+      const unsigned long stride = this->hostnames.size() / num_reference_hosts;
+
+      for (unsigned long c = 1; c <= this->num_checkpoints; c++) {
+        wrench::S4U_Simulation::sleep(c * this->checkpoint_interval - this->simulation->getCurrentSimulatedDate());
+
+        unsigned long num_pairs = 0;
+        unsigned long num_available = 0;
+        double sum_relative_errors = 0;
+        for (unsigned long r = 0; r < num_reference_hosts; r++) {
+          unsigned long i = r * stride;
+          std::vector<double> estimates = this->network_proximity_service->queryMany(this->hostnames[i],
+                                                                                     this->hostnames);
+          for (unsigned long j = 0; j < this->hostnames.size(); j++) {
+            if (j == i) {
+              continue;
+            }
+            num_pairs++;
+            if (estimates[j] == wrench::NetworkProximityService::NOT_AVAILABLE) {
+              continue;
+            }
+            num_available++;
+            // Vivaldi zone coordinates are in ms
+            double dx = this->coordinates[j].first - this->coordinates[i].first;
+            double dy = this->coordinates[j].second - this->coordinates[i].second;
+            double latency = std::sqrt(dx * dx + dy * dy) / 1000.0;
+            sum_relative_errors += std::fabs(estimates[j] - latency) / latency;
+          }
+        }
+
+        this->checkpoints.push_back({this->simulation->getCurrentSimulatedDate(),
+                                     (double) num_available / num_pairs,
+                                     num_available ? sum_relative_errors / num_available : -1.0});
+      }
+
+      this->network_proximity_service->stop();
+      return 0;
+    }
+};
+
+int main(int argc, char **argv) {
+
+  unsigned long num_hosts = 100;
+  std::string type = "VIVALDI";
+  std::string coverage = "0.1";
+  std::string measurement_period = "60";
+  unsigned long num_checkpoints = 10;
+  double checkpoint_interval = 600;
+
+  for (int i = 1; i < argc; i++) {
+    if ((not strcmp(argv[i], "--num-hosts")) and (i + 1 < argc)) {
+      num_hosts = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--type")) and (i + 1 < argc)) {
+      type = argv[++i];
+    } else if ((not strcmp(argv[i], "--coverage")) and (i + 1 < argc)) {
+      coverage = argv[++i];
+    } else if ((not strcmp(argv[i], "--period")) and (i + 1 < argc)) {
+      measurement_period = argv[++i];
+    } else if ((not strcmp(argv[i], "--checkpoints")) and (i + 1 < argc)) {
+      num_checkpoints = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--checkpoint-interval")) and (i + 1 < argc)) {
+      checkpoint_interval = std::stod(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--num-hosts <n>] [--type <VIVALDI|ALLTOALL>] [--coverage <fraction>] [--period <sec>]"
+                << " [--checkpoints <n>] [--checkpoint-interval <sec>]"
+                << std::endl;
+      exit(1);
+    }
+  }
+  if (num_hosts < 2) {
+    std::cerr << "At least 2 hosts are needed" << std::endl;
+    exit(1);
+  }
+
+  // Create a platform in which the latency between hosts is given by their coordinates
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> coordinate_dist(1.0, 100.0);
+  std::vector<std::string> hostnames;
+  std::vector<std::pair<double, double>> coordinates;
+  for (unsigned long i = 0; i < num_hosts; i++) {
+    hostnames.push_back("Host" + std::to_string(i));
+    double x = coordinate_dist(rng);
+    double y = coordinate_dist(rng);
+    coordinates.push_back(std::make_pair(x, y));
+  }
+
+  std::string platform_file_path = "/tmp/network_proximity_benchmark_platform.xml";
+  FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+  fprintf(platform_file, "<?xml version='1.0'?>"
+                         "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                         "<platform version=\"4.1\"> "
+                         "   <zone id=\"AS0\" routing=\"Vivaldi\"> ");
+  for (unsigned long i = 0; i < num_hosts; i++) {
+    fprintf(platform_file, "       <peer id=\"%s\" coordinates=\"%lf %lf 0\" speed=\"1f\" "
+                           "bw_in=\"1GBps\" bw_out=\"1GBps\" lat=\"0us\"/> ",
+            hostnames[i].c_str(), coordinates[i].first, coordinates[i].second);
+  }
+  fprintf(platform_file, "   </zone> "
+                         "</platform>");
+  fclose(platform_file);
+
+  auto simulation = new wrench::Simulation();
+  simulation->init(&argc, argv);
+  simulation->instantiatePlatform(platform_file_path);
+  remove(platform_file_path.c_str());
+
+  std::string hostname = hostnames[0];
+  auto network_proximity_service = simulation->add(
+          new wrench::NetworkProximityService(hostname, hostnames,
+                                              {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, type},
+                                               {wrench::NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE, coverage},
+                                               {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD, measurement_period}}));
+
+  auto wms = (ProximityCheckWMS *) simulation->add(
+          new ProximityCheckWMS(network_proximity_service, hostnames, coordinates,
+                                num_checkpoints, checkpoint_interval, hostname));
+  auto workflow = new wrench::Workflow();
+  wms->addWorkflow(workflow);
+
+  auto begin = std::chrono::steady_clock::now();
+  simulation->launch();
+  auto end = std::chrono::steady_clock::now();
+
+  double elapsed = std::chrono::duration<double>(end - begin).count();
+  std::cerr << "Simulated a " << type << " network proximity service (coverage " << coverage << ") on "
+            << num_hosts << " hosts in " << elapsed << " sec (peak RSS: " << getPeakRSS() << " MB)" << std::endl;
+  for (auto const &checkpoint : wms->checkpoints) {
+    fprintf(stderr, "  date %10.1lf: %6.2lf%% of estimates available, mean relative error %.4lf\n",
+            checkpoint.date, 100.0 * checkpoint.available_fraction, checkpoint.mean_relative_error);
+  }
+
+  delete simulation;
+  delete workflow;
+  return 0;
+}
@@ -0,0 +1,284 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * Benchmark of the Workflow ready-task bookkeeping.
+ *
+ * A synthetic layered DAG (Montage/Epigenomics-like: each task depends on a few tasks
+ * of the previous level) is built in memory, and then executed in a simulation by a WMS
+ * that, at each scheduling round (i.e., after each job completion event), retrieves the
+ * ready tasks, submits one standard job per ready task to a multicore compute service
+ * through its JobManager, and checks whether the workflow is done.
+ *
+ * With --replay, no simulation is run: the task state transitions that the JobManager
+ * performs are replayed on the workflow, one task completion at a time, so as to time
+ * the workflow bookkeeping alone.
+ *
+ * With --full-scan, ready tasks are found (and the workflow is checked for completion)
+ * by scanning all workflow tasks (i.e., the behavior before ready tasks were tracked
+ * incrementally).
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <wrench-dev.h>
+#include "wrench/workflow/Workflow.h"
+
+/**
+ * @brief Build a layered DAG in which each task depends on (up to) 3 tasks of the previous level
+ * @param workflow: the workflow
+ * @param num_tasks: the number of tasks
+ * @param width: the number of tasks per level
+ */
+void buildLayeredWorkflow(wrench::Workflow *workflow, unsigned long num_tasks, unsigned long width) {
+  std::vector<wrench::WorkflowTask *> previous_level;
+  std::vector<wrench::WorkflowTask *> current_level;
+
+  for (unsigned long i = 0; i < num_tasks; i++) {
+    wrench::WorkflowTask *task = workflow->addTask("task_" + std::to_string(i), 1.0, 1, 1, 1.0, 0.0);
+    if (not previous_level.empty()) {
+      unsigned long index = current_level.size();
+      for (unsigned long j = 0; j < 3; j++) {
+        workflow->addControlDependency(previous_level[(index + j * 7) % previous_level.size()], task);
+      }
+    }
+    current_level.push_back(task);
+    if (current_level.size() == width) {
+      previous_level = current_level;
+      current_level.clear();
+    }
+  }
+}
+
+/**
+ * @brief Get the ready tasks by scanning all workflow tasks
+ * @param workflow: the workflow
+ * @return a vector of tasks
+ */
+std::vector<wrench::WorkflowTask *> getReadyTasksByFullScan(wrench::Workflow *workflow) {
+  std::vector<wrench::WorkflowTask *> ready_tasks;
+  for (auto task : workflow->getTasks()) {
+    if (task->getState() == wrench::WorkflowTask::State::READY) {
+      ready_tasks.push_back(task);
+    }
+  }
+  return ready_tasks;
+}
+
+/**
+ * @brief Determine whether the workflow is done by scanning all workflow tasks
+ * @param workflow: the workflow
+ * @return true or false
+ */
+bool isDoneByFullScan(wrench::Workflow *workflow) {
+  for (auto task : workflow->getTasks()) {
+    if (task->getState() != wrench::WorkflowTask::State::COMPLETED) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief A WMS that, at each scheduling round, submits one standard job per ready task
+ */
+class ReadyTasksWMS : public wrench::WMS {
+
+public:
+    ReadyTasksWMS(wrench::ComputeService *compute_service, bool full_scan, std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {compute_service}, {}, {}, nullptr, hostname, "ready_tasks"),
+            compute_service(compute_service), full_scan(full_scan) {}
+
+    unsigned long num_events = 0;
+    unsigned long max_num_ready_tasks = 0;
+
+private:
+    wrench::ComputeService *compute_service;
+    bool full_scan;
+
+    int main() override {
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+      wrench::Workflow *workflow = this->getWorkflow();
+
+      while (not (this->full_scan ? isDoneByFullScan(workflow) : workflow->isDone())) {
+        std::vector<wrench::WorkflowTask *> ready_tasks =
+                (this->full_scan ? getReadyTasksByFullScan(workflow) : workflow->getReadyTasks());
+        this->max_num_ready_tasks = std::max<unsigned long>(this->max_num_ready_tasks, ready_tasks.size());
+        for (auto task : ready_tasks) {
+          job_manager->submitJob(job_manager->createStandardJob(task, {}), this->compute_service);
+        }
+
+        std::unique_ptr<wrench::WorkflowExecutionEvent> event = workflow->waitForNextExecutionEvent();
+        if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+          throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+        }
+        this->num_events++;
+      }
+
+      job_manager->stop();
+      return 0;
+    }
+};
+
+/**
+ * @brief Execute the workflow in a simulation
+ * @param argc: the number of command-line arguments
+ * @param argv: the command-line arguments
+ * @param workflow: the workflow
+ * @param num_cores: the number of cores of the compute host
+ * @param full_scan: whether the WMS scans all tasks
+ * @param num_events: the number of job completion events (set by this function)
+ * @param max_num_ready_tasks: the maximum number of ready tasks at once (set by this function)
+ */
+void simulate(int argc, char **argv, wrench::Workflow *workflow, unsigned long num_cores, bool full_scan,
+              unsigned long &num_events, unsigned long &max_num_ready_tasks) {
+  std::string platform_file_path = "/tmp/ready_tasks_benchmark_platform.xml";
+  FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+  fprintf(platform_file, "<?xml version='1.0'?>"
+                         "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                         "<platform version=\"4.1\"> "
+                         "   <zone id=\"AS0\" routing=\"Full\"> "
+                         "       <host id=\"WMSHost\" speed=\"1f\" core=\"1\"/> "
+                         "       <host id=\"ComputeHost\" speed=\"1f\" core=\"%lu\"/> "
+                         "       <link id=\"1\" bandwidth=\"50000GBps\" latency=\"0us\"/>"
+                         "       <route src=\"WMSHost\" dst=\"ComputeHost\"> <link_ctn id=\"1\"/> </route>"
+                         "   </zone> "
+                         "</platform>", num_cores);
+  fclose(platform_file);
+
+  auto simulation = new wrench::Simulation();
+  simulation->init(&argc, argv);
+  simulation->instantiatePlatform(platform_file_path);
+  remove(platform_file_path.c_str());
+
+  wrench::ComputeService *compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService("WMSHost",
+                                                       {std::make_tuple("ComputeHost", wrench::ComputeService::ALL_CORES,
+                                                                        wrench::ComputeService::ALL_RAM)}, 0));
+  auto wms = (ReadyTasksWMS *) simulation->add(new ReadyTasksWMS(compute_service, full_scan, "WMSHost"));
+  wms->addWorkflow(workflow);
+
+  simulation->launch();
+  num_events = wms->num_events;
+  max_num_ready_tasks = wms->max_num_ready_tasks;
+
+  delete simulation;
+}
+
+/**
+ * @brief Complete a task and make its children ready if possible (as done by the JobManager)
+ * @param workflow: the workflow
+ * @param task: the task
+ */
+void completeTask(wrench::Workflow *workflow, wrench::WorkflowTask *task) {
+  task->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+  task->setState(wrench::WorkflowTask::State::COMPLETED);
+
+  for (auto child : workflow->getTaskChildren(task)) {
+    bool all_parents_completed = true;
+    for (auto parent : workflow->getTaskParents(child)) {
+      if (parent->getState() != wrench::WorkflowTask::State::COMPLETED) {
+        all_parents_completed = false;
+        break;
+      }
+    }
+    if (all_parents_completed) {
+      child->setInternalState(wrench::WorkflowTask::InternalState::TASK_READY);
+      child->setState(wrench::WorkflowTask::State::READY);
+    }
+  }
+}
+
+/**
+ * @brief Replay the task state transitions of the workflow's execution, without a simulation
+ * @param workflow: the workflow
+ * @param full_scan: whether ready tasks are found by scanning all tasks
+ * @param num_events: the number of task completions (set by this function)
+ * @param max_num_ready_tasks: the maximum number of ready tasks at once (set by this function)
+ */
+void replay(wrench::Workflow *workflow, bool full_scan, unsigned long &num_events, unsigned long &max_num_ready_tasks) {
+  num_events = 0;
+  max_num_ready_tasks = 0;
+  while (true) {
+    std::vector<wrench::WorkflowTask *> ready_tasks =
+            (full_scan ? getReadyTasksByFullScan(workflow) : workflow->getReadyTasks());
+    max_num_ready_tasks = std::max<unsigned long>(max_num_ready_tasks, ready_tasks.size());
+
+    bool done = (full_scan ? isDoneByFullScan(workflow) : workflow->isDone());
+    if (done or ready_tasks.empty()) {
+      break;
+    }
+
+    // "Submit" the first ready task, and "complete" it
+    wrench::WorkflowTask *task = ready_tasks.front();
+    task->setState(wrench::WorkflowTask::State::PENDING);
+    completeTask(workflow, task);
+    num_events++;
+  }
+}
+
+int main(int argc, char **argv) {
+
+  unsigned long num_tasks = 100000;
+  unsigned long width = 1000;
+  unsigned long num_cores = 1000;
+  bool full_scan = false;
+  bool no_simulation = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (not strcmp(argv[i], "--full-scan")) {
+      full_scan = true;
+    } else if (not strcmp(argv[i], "--replay")) {
+      no_simulation = true;
+    } else if ((not strcmp(argv[i], "--num-tasks")) and (i + 1 < argc)) {
+      num_tasks = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--width")) and (i + 1 < argc)) {
+      width = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--num-cores")) and (i + 1 < argc)) {
+      num_cores = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--num-tasks <n>] [--width <n>] [--num-cores <n>] [--full-scan] [--replay]" << std::endl;
+      exit(1);
+    }
+  }
+
+  auto workflow = new wrench::Workflow();
+
+  auto begin = std::chrono::steady_clock::now();
+  buildLayeredWorkflow(workflow, num_tasks, width);
+  auto end = std::chrono::steady_clock::now();
+  std::cerr << "Built a " << workflow->getNumberOfTasks() << "-task workflow with " << workflow->getNumLevels()
+            << " levels in " << std::chrono::duration<double>(end - begin).count() << " sec" << std::endl;
+
+  unsigned long num_events = 0;
+  unsigned long max_num_ready_tasks = 0;
+  begin = std::chrono::steady_clock::now();
+  if (no_simulation) {
+    replay(workflow, full_scan, num_events, max_num_ready_tasks);
+  } else {
+    simulate(argc, argv, workflow, num_cores, full_scan, num_events, max_num_ready_tasks);
+  }
+  end = std::chrono::steady_clock::now();
+
+  std::cerr << (no_simulation ? "Replayed " : "Simulated ") << num_events
+            << (no_simulation ? " task completions" : " job completions")
+            << " (at most " << max_num_ready_tasks << " tasks ready at once) in "
+            << std::chrono::duration<double>(end - begin).count() << " sec ("
+            << (full_scan ? "full scan" : "incremental ready-task tracking") << ")" << std::endl;
+
+  delete workflow;
+  return 0;
+}
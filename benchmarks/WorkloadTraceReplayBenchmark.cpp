@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * Benchmark of the replay of a workload trace on a BatchService.
+ *
+ * The jobs of a SWF trace file (by default test/trace_files/NASA-iPSC-1993-3.swf) are replicated
+ * (by default 100 times) back to back, i.e., the submission dates of the jobs of the k-th copy are
+ * shifted by k times the date of the last submission in the original trace. The resulting trace is
+ * replayed on a 128-node batch service. Once the last trace job has been submitted, a WMS submits a
+ * job that needs the whole machine, whose completion (with FCFS) marks the end of the replay.
+ * The simulated makespan, the replay time, and the peak memory footprint (resident set size) are reported.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+
+#include <wrench-dev.h>
+#include "wrench/services/compute/batch/BatchService.h"
+#include "wrench/util/TraceFileLoader.h"
+
+/**
+ * @brief Get the peak resident set size of the process
+ * @return a size in MB
+ */
+double getPeakRSS() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024.0;
+}
+
+/**
+ * @brief Write a trace file in which the jobs of a trace file are replicated back to back
+ * @param input_path: the path of the original trace file
+ * @param output_path: the path of the trace file to write
+ * @param scale: the number of copies of the original trace
+ * @param max_num_nodes: the number of nodes of the batch service
+ * @return the date of the last submission
+ */
+double writeScaledTrace(const std::string &input_path, const std::string &output_path,
+                        unsigned long scale, unsigned long max_num_nodes) {
+  auto trace = wrench::TraceFileLoader::loadFromTraceFile(input_path, 0);
+  if (trace.empty()) {
+    std::cerr << "No job in " << input_path << std::endl;
+    exit(1);
+  }
+  double duration = std::get<1>(trace.back());
+
+  FILE *output = fopen(output_path.c_str(), "w");
+  if (output == nullptr) {
+    std::cerr << "Cannot write " << output_path << std::endl;
+    exit(1);
+  }
+  unsigned long id = 1;
+  double last_submission = 0;
+  for (unsigned long k = 0; k < scale; k++) {
+    for (auto const &job : trace) {
+      last_submission = std::get<1>(job) + k * duration;
+      unsigned long num_nodes = std::min<unsigned long>(std::get<5>(job), max_num_nodes);
+      // Fields: id, submit time, wait time, run time, allocated procs, cpu time, memory, requested procs,
+      //         requested time, requested memory
+      fprintf(output, "%lu %.0lf -1 %.0lf %lu -1 -1 %lu %.0lf -1\n",
+              id++, last_submission, std::get<2>(job), num_nodes, num_nodes, std::get<3>(job));
+    }
+  }
+  fclose(output);
+  return last_submission;
+}
+
+/**
+ * @brief A WMS that waits for the last trace job to be submitted, and then runs a job that needs
+ *        the whole machine
+ */
+class TraceReplayWMS : public wrench::WMS {
+
+public:
+    TraceReplayWMS(wrench::ComputeService *compute_service, unsigned long num_nodes,
+                   double last_submission, std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {compute_service}, {}, {}, nullptr, hostname, "trace_replay"),
+            compute_service(compute_service), num_nodes(num_nodes), last_submission(last_submission) {}
+
+    double makespan = 0;
+
+private:
+    wrench::ComputeService *compute_service;
+    unsigned long num_nodes;
+    double last_submission;
+
+    int main() override {
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      wrench::S4U_Simulation::sleep(this->last_submission + 1);
+
+      wrench::WorkflowTask *task = this->getWorkflow()->addTask("last_task", 1, 1, 1, 1.0, 0);
+      wrench::StandardJob *job = job_manager->createStandardJob(task, {});
+      std::map<std::string, std::string> job_args;
+      job_args["-N"] = std::to_string(this->num_nodes);
+      job_args["-t"] = "1";
+      job_args["-c"] = "1";
+      job_manager->submitJob(job, this->compute_service, job_args);
+
+      std::unique_ptr<wrench::WorkflowExecutionEvent> event = this->getWorkflow()->waitForNextExecutionEvent();
+      if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+        throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+      }
+      this->makespan = this->simulation->getCurrentSimulatedDate();
+
+      job_manager->stop();
+      return 0;
+    }
+};
+
+int main(int argc, char **argv) {
+
+  unsigned long scale = 100;
+  unsigned long num_nodes = 128;
+  std::string scheduling_algorithm = "FCFS";
+  std::string trace_file_path = "test/trace_files/NASA-iPSC-1993-3.swf";
+
+  for (int i = 1; i < argc; i++) {
+    if ((not strcmp(argv[i], "--scale")) and (i + 1 < argc)) {
+      scale = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--num-nodes")) and (i + 1 < argc)) {
+      num_nodes = std::stoul(argv[++i]);
+    } else if ((not strcmp(argv[i], "--algorithm")) and (i + 1 < argc)) {
+      scheduling_algorithm = argv[++i];
+    } else if ((not strcmp(argv[i], "--trace")) and (i + 1 < argc)) {
+      trace_file_path = argv[++i];
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--scale <n>] [--num-nodes <n>] [--algorithm <FCFS|easy_bf|conservative_bf>] [--trace <swf file>]"
+                << std::endl;
+      exit(1);
+    }
+  }
+
+  std::string scaled_trace_file_path = "/tmp/scaled_workload_trace.swf";
+  double last_submission = writeScaledTrace(trace_file_path, scaled_trace_file_path, scale, num_nodes);
+
+  // Create a platform with a WMS host and single-core compute hosts
+  std::string platform_file_path = "/tmp/trace_replay_benchmark_platform.xml";
+  FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+  fprintf(platform_file, "<?xml version='1.0'?>"
+                         "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                         "<platform version=\"4.1\"> "
+                         "   <zone id=\"AS0\" routing=\"Full\"> "
+                         "       <host id=\"WMSHost\" speed=\"1f\" core=\"1\"/> ");
+  for (unsigned long i = 0; i < num_nodes; i++) {
+    fprintf(platform_file, "       <host id=\"Host%lu\" speed=\"1f\" core=\"1\"/> ", i);
+  }
+  fprintf(platform_file, "       <link id=\"1\" bandwidth=\"50000GBps\" latency=\"0us\"/>");
+  for (unsigned long i = 0; i < num_nodes; i++) {
+    fprintf(platform_file, "       <route src=\"WMSHost\" dst=\"Host%lu\"> <link_ctn id=\"1\"/> </route>", i);
+  }
+  fprintf(platform_file, "   </zone> "
+                         "</platform>");
+  fclose(platform_file);
+
+  auto simulation = new wrench::Simulation();
+  simulation->init(&argc, argv);
+  simulation->instantiatePlatform(platform_file_path);
+  remove(platform_file_path.c_str());
+
+  std::vector<std::string> compute_hosts;
+  for (unsigned long i = 0; i < num_nodes; i++) {
+    compute_hosts.push_back("Host" + std::to_string(i));
+  }
+  std::string hostname = "WMSHost";
+  wrench::ComputeService *compute_service = simulation->add(
+          new wrench::BatchService(hostname, compute_hosts, 0,
+                                   {{wrench::BatchServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, scaled_trace_file_path},
+                                    {wrench::BatchServiceProperty::BATCH_SCHEDULING_ALGORITHM, scheduling_algorithm}}));
+
+  auto wms = (TraceReplayWMS *) simulation->add(
+          new TraceReplayWMS(compute_service, num_nodes, last_submission, hostname));
+  auto workflow = new wrench::Workflow();
+  wms->addWorkflow(workflow);
+
+  auto begin = std::chrono::steady_clock::now();
+  simulation->launch();
+  auto end = std::chrono::steady_clock::now();
+  remove(scaled_trace_file_path.c_str());
+
+  double elapsed = std::chrono::duration<double>(end - begin).count();
+  std::cerr << "Replayed a " << scale << "x trace (last submission at " << last_submission << " sec) on "
+            << num_nodes << " nodes with " << scheduling_algorithm << " in " << elapsed
+            << " sec (simulated makespan: " << wms->makespan << " sec, peak RSS: " << getPeakRSS() << " MB)"
+            << std::endl;
+
+  delete simulation;
+  delete workflow;
+  return 0;
+}
@@ -14,6 +14,7 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include <wrench/simgrid_S4U_util/S4U_Daemon.h>
 
@@ -47,11 +48,11 @@ namespace wrench {
 
         bool isUp();
 
-        std::string getPropertyValueAsString(std::string);
+        std::string getPropertyValueAsString(const std::string &);
 
-        double getPropertyValueAsDouble(std::string);
-        
-        bool getPropertyValueAsBoolean(std::string);
+        double getPropertyValueAsDouble(const std::string &);
+
+        bool getPropertyValueAsBoolean(const std::string &);
 
         double getNetworkTimeoutValue();
 
@@ -65,9 +66,9 @@ namespace wrench {
         /** \cond INTERNAL     */
         /***********************/
 
-        std::string getMessagePayloadValueAsString(std::string);
+        std::string getMessagePayloadValueAsString(const std::string &);
 
-        double getMessagePayloadValueAsDouble(std::string);
+        double getMessagePayloadValueAsDouble(const std::string &);
 
         void setStateToDown();
 
@@ -106,6 +107,28 @@ namespace wrench {
         /** @brief The service's messagepayload list */
         std::map<std::string, std::string> messagepayload_list;
 
+        /** @brief A property or message payload value, parsed once when it is set */
+        struct ParsedValue {
+            /** @brief The value as a string */
+            std::string string_value;
+            /** @brief Whether the value is a valid double */
+            bool is_double = false;
+            /** @brief The value as a double (if valid) */
+            double double_value = 0.0;
+            /** @brief Whether the value is a valid boolean */
+            bool is_boolean = false;
+            /** @brief The value as a boolean (if valid) */
+            bool boolean_value = false;
+        };
+
+        /** @brief The service's parsed property values, by property name */
+        std::unordered_map<std::string, ParsedValue> parsed_property_list;
+
+        /** @brief The service's parsed message payload values, by message payload name */
+        std::unordered_map<std::string, ParsedValue> parsed_messagepayload_list;
+
+        static ParsedValue parseValue(const std::string &value);
+
 
         /** @brief The service's state */
         State state;
@@ -23,6 +23,10 @@ namespace wrench {
         BatchJob(WorkflowJob* job, unsigned long jobid, unsigned long time_in_minutes, unsigned long number_nodes,
                  unsigned long cores_per_node,double ending_time_stamp, double arrival_time_stamp);
 
+        //jobid, actual run time, -t, -N, -c, arrival s4u_timestamp (a background job from a workload trace)
+        BatchJob(unsigned long jobid, double run_time, unsigned long time_in_minutes, unsigned long number_nodes,
+                 unsigned long cores_per_node, double arrival_time_stamp);
+
 
         unsigned long getJobID();
         double getAllocatedTime();
@@ -35,6 +39,9 @@ namespace wrench {
         double getArrivalTimeStamp();
         unsigned long getNumNodes();
         WorkflowJob* getWorkflowJob();
+        bool isBackgroundJob();
+        double getRunTime();
+        std::string getName();
         void setEndingTimeStamp(double);
         std::set<std::tuple<std::string,unsigned long, double>> getResourcesAllocated();
         void setAllocatedResources(std::set<std::tuple<std::string,unsigned long, double>>);
@@ -43,6 +50,7 @@ namespace wrench {
         unsigned long jobid;
         double  allocated_time;
         WorkflowJob* job;
+        double run_time;
         unsigned long num_nodes;
         unsigned long cores_per_node;
         double begin_time_stamp;
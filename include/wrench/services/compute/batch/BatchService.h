@@ -15,12 +15,15 @@
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
 #include "wrench/services/compute/batch/BatchJob.h"
 #include "wrench/services/compute/batch/BatschedNetworkListener.h"
+#include "wrench/services/compute/batch/HostAvailabilityIndex.h"
+#include "wrench/services/compute/batch/NodeAvailabilityProfile.h"
 #include "wrench/services/compute/batch/BatchServiceProperty.h"
 #include "wrench/services/compute/batch/BatchServiceMessagePayload.h"
 #include "wrench/services/helpers/Alarm.h"
 #include "wrench/workflow/job/StandardJob.h"
 #include "wrench/workflow/job/WorkflowJob.h"
 #include <deque>
+#include <functional>
 #include <queue>
 #include <set>
 #include <tuple>
@@ -55,6 +58,7 @@ namespace wrench {
                  {BatchServiceProperty::SUPPORTS_PILOT_JOBS,                         "true"},
                  {BatchServiceProperty::SUPPORTS_STANDARD_JOBS,                      "true"},
                  {BatchServiceProperty::THREAD_STARTUP_OVERHEAD,                     "0"},
+                 {BatchServiceProperty::SIMULATE_COMPUTE_THREADS,                    "true"},
                  {BatchServiceProperty::HOST_SELECTION_ALGORITHM,                    "FIRSTFIT"},
                 #ifdef ENABLE_BATSCHED
                  {BatchServiceProperty::BATCH_SCHEDULING_ALGORITHM,                  "easy_bf"},
@@ -157,9 +161,14 @@ namespace wrench {
         unsigned long num_cores_per_node;
         std::map<std::string, unsigned long> nodes_to_cores_map;
         std::vector<double> timeslots;
-        std::map<std::string, unsigned long> available_nodes_to_cores;
+        HostAvailabilityIndex available_cores_index;
         std::map<unsigned long, std::string> host_id_to_names;
         std::vector<std::string> compute_hosts;
+        unsigned long round_robin_last_host_id = 0;
+        // Node availability profile of the running jobs (updated when jobs start and end)
+        NodeAvailabilityProfile running_jobs_profile;
+        // Same, plus the reservations made by the last backfilling pass (used for start time estimates)
+        NodeAvailabilityProfile reservations_profile;
         /*End Resources information in Batchservice */
 
         // Vector of standard job executors
@@ -177,6 +186,11 @@ namespace wrench {
         std::set<BatchJob *> running_jobs;
         // A set of waiting jobs that have been submitted to batsched, but not scheduled
         std::set<BatchJob *> waiting_jobs;
+        // Running background jobs (from the workload trace), ordered by end date and then by job ID
+        // (so that jobs ending at the same date complete in a deterministic order)
+        std::priority_queue<std::tuple<double, unsigned long, BatchJob *>,
+                std::vector<std::tuple<double, unsigned long, BatchJob *>>,
+                std::greater<std::tuple<double, unsigned long, BatchJob *>>> running_background_jobs;
 
 
 
@@ -198,7 +212,7 @@ namespace wrench {
 
         };
 #else
-        std::set<std::string> scheduling_algorithms = {"FCFS"
+        std::set<std::string> scheduling_algorithms = {"FCFS", "easy_bf", "conservative_bf"
         };
 
         //Batch queue ordering options
@@ -273,9 +287,21 @@ namespace wrench {
         // Try to schedule a job
         bool scheduleOneQueuedJob();
 
+        // Schedule queued jobs with EASY or conservative backfilling
+        void scheduleQueuedJobsWithBackfilling(bool conservative);
+
+        // Start a queued job on allocated resources
+        void startQueuedJob(BatchJob *batch_job, std::set<std::tuple<std::string, unsigned long, double>> resources);
+
         // process a job submission
         void processJobSubmission(BatchJob *job, std::string answer_mailbox);
 
+        // process a background job submission (from the workload trace replayer)
+        void processBackgroundJobSubmission(BatchJob *job);
+
+        // process the completion of the background jobs that are done
+        void processBackgroundJobCompletions();
+
 
         //start a job
         void startJob(std::set<std::tuple<std::string, unsigned long, double>>, WorkflowJob *,
@@ -287,6 +313,8 @@ namespace wrench {
 
         std::map<std::string,double> getStartTimeEstimatesForFCFS(std::set<std::tuple<std::string,unsigned int,unsigned int, double>>);
 
+        std::map<std::string,double> getStartTimeEstimatesForBackfilling(std::set<std::tuple<std::string,unsigned int,unsigned int, double>>);
+
 #ifdef ENABLE_BATSCHED
         std::vector<std::shared_ptr<BatschedNetworkListener>> network_listeners;
 
@@ -24,7 +24,7 @@ namespace wrench{
      */
     class BatchServiceMessage : public ComputeServiceMessage {
     protected:
-        BatchServiceMessage(std::string name, double payload);
+        BatchServiceMessage(SimulationMessage::Type type, std::string name, double payload);
     };
 
     /**
@@ -40,6 +40,18 @@ namespace wrench{
         BatchJob* job;
     };
 
+    /**
+     * @brief A message sent to a BatchService (by its workload trace replayer) to add
+     *        a background job to its queue
+     */
+    class BatchServiceBackgroundJobSubmissionMessage : public BatchServiceMessage {
+    public:
+        BatchServiceBackgroundJobSubmissionMessage(BatchJob* job, double payload);
+
+        /** @brief The batch job */
+        BatchJob* job;
+    };
+
     /**
      * @brief A message sent by an alarm when a job goes over its
      *        requested execution time
@@ -26,10 +26,19 @@ namespace wrench {
          */
         DECLARE_PROPERTY_NAME(THREAD_STARTUP_OVERHEAD);
 
+        /**
+         * @brief Whether the computation of a multicore task is simulated with one
+         *        compute thread per core ("true", default), or with a single computation
+         *        after an analytical thread startup delay ("false", faster to simulate)
+         */
+        DECLARE_PROPERTY_NAME(SIMULATE_COMPUTE_THREADS);
+
         /**
          * @brief The batch scheduling algorithm. Can be:
          *    - If ENABLE_BATSCHED is set to off / not set:
-         *      - "FCFS": First Come First Serve
+         *      - "FCFS": First Come First Serve (default)
+         *      - "easy_bf": EASY backfilling (only the first queued job that cannot start gets a reservation)
+         *      - "conservative_bf": conservative backfilling (every queued job that cannot start gets a reservation)
          *    - If ENABLE_BATSCHED is set to on:
          *      - whatever scheduling algorithm is supported by Batsched
          *                  (by default: "easy_bf")
@@ -61,6 +70,11 @@ namespace wrench {
          * be in the SWF format (see http://www.cs.huji.ac.il/labs/parallel/workload/swf.html).
          * Note that jobs in the trace whose node/host/processor/core requirements exceed the capacity
          * of the batch service will simply be capped at that capacity.
+         * Trace jobs are background jobs: they go through the batch queue like other jobs, but
+         * their execution is not simulated (each job simply holds all the cores of its nodes for its
+         * run time, or until it reaches its requested time). The memory requested in the trace is
+         * ignored: like any job of the batch service, which allocates whole nodes, a trace job
+         * is allocated all the RAM of its nodes.
          */
         DECLARE_PROPERTY_NAME(SIMULATED_WORKLOAD_TRACE_FILE);
 
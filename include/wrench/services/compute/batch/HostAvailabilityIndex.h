@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_HOSTAVAILABILITYINDEX_H
+#define WRENCH_HOSTAVAILABILITYINDEX_H
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief An index of the available cores of a set of homogeneous hosts, used by a BatchService
+     *        to select hosts for a job. Hosts are identified by integer IDs (their position in the
+     *        host list given to the constructor), are bucketed by number of available cores,
+     *        and idle hosts are tracked in a bitmap. Allocating or releasing cores on a host
+     *        is O(log N), and selecting k hosts is O(k log C) (with C the number of cores per host).
+     */
+    class HostAvailabilityIndex {
+
+    public:
+
+        HostAvailabilityIndex();
+
+        HostAvailabilityIndex(const std::vector<std::string> &hostnames, unsigned long num_cores_per_host);
+
+        unsigned long getNumHosts() const;
+
+        unsigned long getNumCoresPerHost() const;
+
+        unsigned long getHostID(const std::string &hostname) const;
+
+        const std::string &getHostname(unsigned long host_id) const;
+
+        const std::vector<unsigned long> &getHostIDsInHostnameOrder() const;
+
+        unsigned long getNumAvailableCores(unsigned long host_id) const;
+
+        bool isIdle(unsigned long host_id) const;
+
+        unsigned long getNumIdleHosts() const;
+
+        void allocateCores(unsigned long host_id, unsigned long num_cores);
+
+        void releaseCores(unsigned long host_id, unsigned long num_cores);
+
+        std::vector<unsigned long> selectFirstFit(unsigned long num_hosts, unsigned long num_cores) const;
+
+        std::vector<unsigned long> selectBestFit(unsigned long num_hosts, unsigned long num_cores) const;
+
+        std::vector<unsigned long> selectRoundRobin(unsigned long num_hosts, unsigned long num_cores,
+                                                    unsigned long last_host_id) const;
+
+    private:
+
+        unsigned long getNumHostsWithAtLeast(unsigned long num_cores) const;
+
+        void setNumAvailableCores(unsigned long host_id, unsigned long num_cores);
+
+        unsigned long num_cores_per_host;
+        std::vector<std::string> hostnames;                     // hostnames, by host ID
+        std::unordered_map<std::string, unsigned long> host_ids;
+        std::vector<unsigned long> ids_in_hostname_order;       // host IDs, sorted by hostname
+        std::vector<unsigned long> hostname_ranks;              // position of each host in ids_in_hostname_order
+        std::vector<unsigned long> available_cores;             // number of available cores, by host ID
+        std::vector<std::set<unsigned long>> ranks_by_cores;    // [c]: hostname ranks of the hosts with c available cores
+        std::vector<std::set<unsigned long>> ids_by_cores;      // [c]: IDs of the hosts with c available cores
+        std::vector<bool> idle_hosts;                           // bitmap of the hosts with all cores available
+        unsigned long num_idle_hosts;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+
+#endif //WRENCH_HOSTAVAILABILITYINDEX_H
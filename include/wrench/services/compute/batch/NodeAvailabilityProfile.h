@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_NODEAVAILABILITYPROFILE_H
+#define WRENCH_NODEAVAILABILITYPROFILE_H
+
+#include <map>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief The number of available nodes of a batch service over time, as a step function
+     *        (a time-ordered list of dates at which the number of available nodes changes).
+     *        Jobs are accounted for as whole nodes between their (actual or reserved) start date and their
+     *        start date plus their requested walltime. This is the resource availability
+     *        profile on which backfilling algorithms make their decisions.
+     */
+    class NodeAvailabilityProfile {
+
+    public:
+
+        explicit NodeAvailabilityProfile(unsigned long num_nodes = 0);
+
+        void allocate(double start_date, double end_date, unsigned long num_nodes);
+
+        void release(double start_date, double end_date, unsigned long num_nodes);
+
+        long getNumAvailableNodes(double date) const;
+
+        double getEarliestStartDate(double date, double duration, unsigned long num_nodes) const;
+
+        unsigned long getNumSteps() const;
+
+    private:
+
+        void add(double start_date, double end_date, long num_nodes);
+
+        std::map<double, long>::iterator split(double date);
+
+        unsigned long num_nodes;
+        std::map<double, long> steps; // date -> number of available nodes from that date until the next one
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+
+#endif //WRENCH_NODEAVAILABILITYPROFILE_H
@@ -27,6 +27,12 @@ namespace wrench {
         /** @brief The overhead to start a thread, in seconds **/
         DECLARE_PROPERTY_NAME(THREAD_STARTUP_OVERHEAD);
 
+        /** @brief Whether the computation of a multicore task is simulated with one
+         *         compute thread per core ("true", default), or with a single computation
+         *         after an analytical thread startup delay ("false", faster to simulate)
+         **/
+        DECLARE_PROPERTY_NAME(SIMULATE_COMPUTE_THREADS);
+
         /** @brief The job selection policy:
          *      - FCFS: serve jobs in First-Come-First-Serve manner (default)
          */
@@ -110,6 +110,7 @@ namespace wrench {
 
         std::map<std::string, std::string> default_property_values = {
                 {StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD, "0"},
+                {StandardJobExecutorProperty::SIMULATE_COMPUTE_THREADS, "true"},
                 {StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM, "maximum"},
                 {StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM, "maximum_flops"},
                 {StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM, "best_fit"},
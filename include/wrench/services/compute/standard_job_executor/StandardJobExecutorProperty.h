@@ -29,6 +29,14 @@ namespace wrench {
         /** @brief The number of seconds to start a thread (default = 0) **/
         DECLARE_PROPERTY_NAME(THREAD_STARTUP_OVERHEAD);
 
+        /** @brief Whether the computation of a multicore task is simulated with one
+         *         compute thread per core (true, default), or with a single computation
+         *         by the executor after an (analytical) thread startup delay (false).
+         *         Both give the same completion dates on homogeneous cores, but the latter
+         *         creates no simulated process per core.
+         **/
+        DECLARE_PROPERTY_NAME(SIMULATE_COMPUTE_THREADS);
+
         /** @brief The number of bytes in the control message sent by the executor to provide the set of files stored in the scratch **/
         DECLARE_PROPERTY_NAME(STANDARD_JOB_FILES_STORED_IN_SCRATCH);
 
@@ -48,7 +48,8 @@ namespace wrench {
                      Workunit *workunit,
                      StorageService *scratch_space,
                      WorkflowJob* job,
-                     double thread_startup_overhead = 0.0);
+                     double thread_startup_overhead = 0.0,
+                     bool simulate_compute_threads = true);
 
         void kill();
 
@@ -65,12 +66,15 @@ namespace wrench {
 
         void performWork(Workunit *work);
 
+        void performFileCopies(std::vector<std::tuple<WorkflowFile *, StorageService *, std::string, StorageService *, std::string>> file_copies);
+
         void runMulticoreComputation(double flops, double parallel_efficiency);
 
         std::string callback_mailbox;
         unsigned long num_cores;
         double ram_utilization;
         double thread_startup_overhead;
+        bool simulate_compute_threads;
 
         StorageService* scratch_space;
 
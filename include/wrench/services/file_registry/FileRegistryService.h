@@ -11,6 +11,7 @@
 #ifndef WRENCH_FILEREGISTRYSERVICE_H
 #define WRENCH_FILEREGISTRYSERVICE_H
 
+#include <map>
 #include <set>
 #include <wrench/services/network_proximity/NetworkProximityService.h>
 
@@ -67,8 +68,8 @@ namespace wrench {
 
         std::set<StorageService *> lookupEntry(WorkflowFile *file);
 
-        std::map<double, StorageService *> lookupEntry(WorkflowFile *file, std::string reference_host,
-                                                       NetworkProximityService *);
+        std::multimap<double, StorageService *> lookupEntry(WorkflowFile *file, std::string reference_host,
+                                                            NetworkProximityService *);
 
         void addEntry(WorkflowFile *file, StorageService *storage_service);
 
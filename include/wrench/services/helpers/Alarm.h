@@ -12,7 +12,6 @@
 
 #include <string>
 #include <memory>
-#include <wrench/services/Service.h>
 #include "wrench/simulation/SimulationMessage.h"
 
 namespace wrench {
@@ -23,13 +22,16 @@ namespace wrench {
 
 
     class Simulation;
+    class AlarmService;
 
     /**
-     * @brief A one-shot service that sends a message to a mailbox after some specified amount of time and terminates
+     * @brief A one-shot alarm that sends a message to a mailbox at some specified date. Alarms
+     *        are armed with (and the messages are sent by) the AlarmService of the host, so that
+     *        an alarm does not require a simulated process of its own.
      */
-    class Alarm : public Service {
+    class Alarm {
 
-        friend class S4U_Daemon;
+        friend class AlarmService;
 
     public:
 
@@ -38,15 +40,21 @@ namespace wrench {
 
         void kill();
 
+        double getDate();
+
     private:
-        Alarm(double date, std::string hostname, std::string &reply_mailbox_name,
+        Alarm(double date, std::string &reply_mailbox_name,
               SimulationMessage *msg, std::string suffix);
 
         double date;
+        unsigned long sequence_number;
         std::string reply_mailbox_name;
+        std::string suffix;
         std::unique_ptr<SimulationMessage> msg;
 
-        int main() override;
+        // The service with which the alarm is armed, and the position of the alarm in its heap (-1 if not armed)
+        std::weak_ptr<AlarmService> alarm_service;
+        long heap_index = -1;
 
     };
 
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_ALARMSERVICE_H
+#define WRENCH_ALARMSERVICE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "wrench/services/Service.h"
+#include "wrench/services/helpers/Alarm.h"
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    class Simulation;
+
+    /**
+     * @brief A per-host service that keeps the armed alarms in a min-heap (ordered by date), and
+     *        whose single daemon sends the message of each alarm at the alarm's date. Arming and
+     *        cancelling an alarm are O(log n) operations.
+     */
+    class AlarmService : public Service {
+
+    public:
+
+        static std::shared_ptr<AlarmService> getAlarmService(Simulation *simulation, const std::string &hostname);
+
+        void arm(std::shared_ptr<Alarm> alarm);
+
+        void disarm(Alarm *alarm);
+
+        unsigned long getNumArmedAlarms();
+
+    private:
+
+        explicit AlarmService(const std::string &hostname);
+
+        int main() override;
+
+        void cleanup() override;
+
+        void sendAlarmMessage(std::shared_ptr<Alarm> alarm);
+
+        bool precedes(const std::shared_ptr<Alarm> &a, const std::shared_ptr<Alarm> &b);
+        void swap(unsigned long i, unsigned long j);
+        void siftUp(unsigned long index);
+        void siftDown(unsigned long index);
+
+        // Armed alarms, as a binary min-heap ordered by (date, sequence number)
+        std::vector<std::shared_ptr<Alarm>> heap;
+
+        // Whether a wake-up message has been sent to the daemon and not yet received
+        bool wake_up_pending = false;
+
+        unsigned long next_sequence_number = 0;
+
+        // The alarm services, by hostname
+        static std::map<std::string, std::shared_ptr<AlarmService>> alarm_services;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+}
+
+#endif //WRENCH_ALARMSERVICE_H
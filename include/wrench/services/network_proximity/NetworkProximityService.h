@@ -10,9 +10,9 @@
 #ifndef WRENCH_NETWORKPROXIMITYSERVICE_H
 #define WRENCH_NETWORKPROXIMITYSERVICE_H
 
-#include <complex>
 #include <random>
 #include <cfloat>
+#include <unordered_map>
 #include "wrench/services/Service.h"
 #include "wrench/services/network_proximity/NetworkProximityServiceProperty.h"
 #include "wrench/services/network_proximity/NetworkProximityDaemon.h"
@@ -62,6 +62,12 @@ namespace wrench{
 
         ~NetworkProximityService();
 
+        static void computeAllProximityValues(const double *coordinates_x, const double *coordinates_y,
+                                              unsigned long num_hosts, double *proximity_values);
+
+        static void vivaldiUpdate(double proximity_value, double *coordinates_x, double *coordinates_y,
+                                  unsigned long sender_index, unsigned long peer_index);
+
         /***********************/
         /** \endcond           */
         /***********************/
@@ -78,7 +84,11 @@ namespace wrench{
 
         double query(std::pair<std::string, std::string> hosts);
 
-        std::vector<std::string> getHostnameList();
+        std::vector<double> queryMany(std::string reference_host, std::vector<std::string> hosts);
+
+        std::vector<double> queryAll();
+
+        const std::vector<std::string> &getHostnameList();
 
         std::pair<double, double> getCoordinate(std::string);
 
@@ -95,21 +105,40 @@ namespace wrench{
         std::vector<std::shared_ptr<NetworkProximityDaemon>> network_daemons;
         std::vector<std::string> hosts_in_network;
 
+        // The index of each monitored host in hosts_in_network
+        std::unordered_map<std::string, unsigned long> host_indices;
+        bool is_vivaldi;
+
         std::default_random_engine master_rng;
 
         int main();
 
         bool processNextMessage();
 
-        void addEntryToDatabase(std::pair<std::string,std::string> pair_hosts,double proximity_value);
+        long getHostIndex(const std::string &hostname);
 
-        std::map<std::pair<std::string,std::string>,double> entries;
+        double getProximityValue(const std::pair<std::string, std::string> &hosts);
 
-        std::map<std::string, std::complex<double>> coordinate_lookup_table;
+        void computeProximityValues(unsigned long reference_index, double *proximity_values);
 
-        std::shared_ptr<NetworkProximityDaemon> getCommunicationPeer(const NetworkProximityDaemon * sender_daemon);
+        void computeAllProximityValues(double *proximity_values);
 
-        void vivaldiUpdate(double proximityValue, std::string sender_hostname, std::string peer_hostname);
+        // ALLTOALL: the measured proximity values, as a row-major matrix indexed by host indices
+        std::vector<double> proximity_matrix;
+
+        // VIVALDI: the coordinates of the hosts, indexed by host indices
+        std::vector<double> coordinates_x;
+        std::vector<double> coordinates_y;
+
+        // The measurement schedule: the k-th peer of the i-th network daemon is the
+        // (i + peer_offsets[k mod peer_offsets.size()])-th network daemon (modulo the number of daemons)
+        std::vector<unsigned long> peer_offsets;
+        std::vector<unsigned long> next_peer_offset_positions;
+        std::unordered_map<const NetworkProximityDaemon *, unsigned long> daemon_indices;
+
+        void setUpMeasurementSchedule();
+
+        std::shared_ptr<NetworkProximityDaemon> getCommunicationPeer(const NetworkProximityDaemon * sender_daemon);
 
         void validateProperties();
 
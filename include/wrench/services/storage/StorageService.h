@@ -17,6 +17,7 @@
 #include <wrench/workflow/job/StandardJob.h>
 
 #include "wrench/services/Service.h"
+#include "wrench/services/storage/StorageServiceFileCatalog.h"
 #include "wrench/workflow/execution_events/FailureCause.h"
 
 namespace wrench {
@@ -28,6 +29,7 @@ namespace wrench {
     class FailureCause;
 
     class FileRegistryService;
+    class S4U_PendingCommunication;
 
     /**
      * @brief The storage service base class
@@ -65,6 +67,10 @@ namespace wrench {
 
         virtual void deleteFile(WorkflowFile *file, WorkflowJob* job, FileRegistryService *file_registry_service=nullptr);
 
+        virtual void deletePartition(std::string partition);
+
+        virtual void deletePartition(WorkflowJob* job);
+
         virtual bool lookupFile(WorkflowFile *file, WorkflowJob*);
 
         virtual void copyFile(WorkflowFile *file, StorageService *src, std::string src_dir, std::string dst_dir);
@@ -120,8 +126,10 @@ namespace wrench {
 
         void removeFileFromStorage(WorkflowFile *, std::string);
 
-        /** @brief The map of file directories and the set of files stored on those directories inside the storage service */
-        std::map<std::string, std::set<WorkflowFile *>> stored_files;
+        unsigned long removePartitionFromStorage(std::string);
+
+        /** @brief The files stored on the storage service, by partition */
+        StorageServiceFileCatalog stored_files;
         /** @brief The storage service's capacity */
         double capacity;
         /** @brief The storage service's occupied space */
@@ -143,6 +151,10 @@ namespace wrench {
                                      StorageService *default_storage_service, std::set<WorkflowFile*>& files_in_scratch,
                                      WorkflowJob* job);
 
+        std::unique_ptr<S4U_PendingCommunication> startFileRead(WorkflowFile *file, std::string src_partition);
+
+        std::unique_ptr<S4U_PendingCommunication> startFileWrite(WorkflowFile *file, std::string dst_partition);
+
 
     };
 
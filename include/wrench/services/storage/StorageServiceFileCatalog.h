@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_STORAGESERVICEFILECATALOG_H
+#define WRENCH_STORAGESERVICEFILECATALOG_H
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "wrench/util/IDTable.h"
+
+namespace wrench {
+
+    class WorkflowFile;
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief The files stored on a storage service, by partition. Partition names are interned
+     *        as dense indices, and each partition keeps a hash set of its files and the number of bytes
+     *        they occupy, so that looking up, adding, or removing a file takes constant time, and so does
+     *        removing a whole partition (e.g., the scratch partition of a job) at once. The indices
+     *        of removed partitions are reused, so that the catalog does not grow with the number of
+     *        partitions that have come and gone (e.g., one per job).
+     */
+    class StorageServiceFileCatalog {
+
+    public:
+
+        bool lookup(const std::string &partition, WorkflowFile *file) const;
+
+        bool insert(const std::string &partition, WorkflowFile *file);
+
+        bool remove(const std::string &partition, WorkflowFile *file);
+
+        unsigned long removePartition(const std::string &partition);
+
+        double getOccupiedSpace(const std::string &partition) const;
+
+        unsigned long getNumFiles(const std::string &partition) const;
+
+        unsigned long getNumFiles() const;
+
+    private:
+
+        /** @brief The files of a partition */
+        struct Partition {
+            /** @brief The files */
+            std::unordered_set<WorkflowFile *> files;
+            /** @brief The number of bytes occupied by the files */
+            double occupied_space = 0;
+        };
+
+        Partition *getPartition(const std::string &partition) const;
+
+        IDTable partition_ids{true};                        // Interned partition names (indices are reused)
+        std::vector<std::unique_ptr<Partition>> partitions; // by partition index (nullptr once removed)
+        unsigned long num_files = 0;                        // number of files in all partitions
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+
+#endif //WRENCH_STORAGESERVICEFILECATALOG_H
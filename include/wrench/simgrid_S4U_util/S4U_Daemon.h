@@ -15,6 +15,8 @@
 #include <simgrid/s4u.hpp>
 #include <iostream>
 
+#include "wrench/simgrid_S4U_util/S4U_MailboxHandle.h"
+
 namespace wrench {
 
     /***********************/
@@ -40,6 +42,8 @@ namespace wrench {
         std::string process_name;
         /** @brief The name of the daemon's mailbox */
         std::string mailbox_name;
+        /** @brief The daemon's mailbox (resolved once, to be used instead of the mailbox name for communications) */
+        S4U_MailboxHandle mailbox;
         /** @brief The name of the host on which the daemon is running */
         std::string hostname;
 
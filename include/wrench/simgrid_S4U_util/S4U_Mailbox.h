@@ -15,9 +15,14 @@
 #include <string>
 #include <map>
 #include <set>
+#include <unordered_set>
+#include <vector>
 
 #include <simgrid/s4u.hpp>
 
+#include "wrench/simgrid_S4U_util/S4U_MailboxHandle.h"
+#include "wrench/simgrid_S4U_util/S4U_ReplyMailbox.h"
+
 namespace wrench {
 
 		/***********************/
@@ -33,19 +38,32 @@ namespace wrench {
 		class S4U_Mailbox {
 
 		public:
-				static std::unique_ptr<SimulationMessage> getMessage(std::string mailbox);
-				static std::unique_ptr<SimulationMessage> getMessage(std::string mailbox, double timeout);
-				static void putMessage(std::string mailbox, SimulationMessage *m);
-				static void dputMessage(std::string mailbox_name, SimulationMessage *msg);
-				static std::unique_ptr<S4U_PendingCommunication> iputMessage(std::string mailbox_name, SimulationMessage *msg);
-				static std::unique_ptr<S4U_PendingCommunication> igetMessage(std::string mailbox_name);
+				static std::unique_ptr<SimulationMessage> getMessage(const std::string &mailbox_name);
+				static std::unique_ptr<SimulationMessage> getMessage(const S4U_MailboxHandle &mailbox);
+				static std::unique_ptr<SimulationMessage> getMessage(const std::string &mailbox_name, double timeout);
+				static std::unique_ptr<SimulationMessage> getMessage(const S4U_MailboxHandle &mailbox, double timeout);
+				static void putMessage(const std::string &mailbox_name, SimulationMessage *msg);
+				static void putMessage(const S4U_MailboxHandle &mailbox, SimulationMessage *msg);
+				static void dputMessage(const std::string &mailbox_name, SimulationMessage *msg);
+				static void dputMessage(const S4U_MailboxHandle &mailbox, SimulationMessage *msg);
+				static std::unique_ptr<S4U_PendingCommunication> iputMessage(const std::string &mailbox_name, SimulationMessage *msg);
+				static std::unique_ptr<S4U_PendingCommunication> igetMessage(const std::string &mailbox_name);
 //				static void clear_dputs();
 
 				static std::string generateUniqueMailboxName(std::string);
 				static unsigned long generateUniqueSequenceNumber();
 
+				static std::string getReplyMailbox();
+				static void releaseReplyMailbox(const std::string &mailbox_name);
+				static void discardReplyMailbox(const std::string &mailbox_name);
+
 		private:
 
+				// Reply mailboxes that have received all the messages that were sent to them, and can be reused
+				static std::vector<std::string> free_reply_mailboxes;
+				// Reply mailboxes that have been handed out and not released yet
+				static std::unordered_set<std::string> reply_mailboxes_in_use;
+
 //				static std::map<simgrid::s4u::ActorPtr , std::set<simgrid::s4u::CommPtr>> dputs;
 
 		};
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_S4U_MAILBOXHANDLE_H
+#define WRENCH_S4U_MAILBOXHANDLE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <simgrid/s4u.hpp>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    struct ManagedMessageList;
+
+    /**
+     * @brief A handle to a mailbox whose S4U mailbox is resolved (by name) only once, so that
+     *        communications on a long-lived mailbox (e.g., that of a daemon) do not require
+     *        string lookups. Handles are cheap to copy, and copies share the resolved mailbox.
+     */
+    class S4U_MailboxHandle {
+
+    public:
+
+        S4U_MailboxHandle();
+
+        S4U_MailboxHandle(const std::string &name, unsigned long id);
+
+        unsigned long getID() const;
+
+        const std::string &getName() const;
+
+        simgrid::s4u::MailboxPtr getMailbox() const;
+
+        /**
+         * @brief Compare two handles
+         * @param other: another handle
+         * @return true if both handles refer to the same mailbox
+         */
+        bool operator==(const S4U_MailboxHandle &other) const {
+          return this->record == other.record;
+        }
+
+    private:
+
+        friend class MessageManager;
+
+        struct Record {
+            unsigned long id;                                      // Mailbox identity
+            std::string name;                                      // Mailbox name
+            simgrid::s4u::MailboxPtr mailbox = nullptr;            // S4U mailbox (resolved upon first use)
+            std::shared_ptr<ManagedMessageList> managed_messages;  // MessageManager list (resolved upon first use)
+        };
+
+        std::shared_ptr<Record> record;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_S4U_MAILBOXHANDLE_H
@@ -12,8 +12,11 @@
 #define WRENCH_S4U_PENDINGCOMMUNICATION_H
 
 
+#include <memory>
 #include <vector>
 #include <simgrid/s4u/Comm.hpp>
+
+#include "wrench/simgrid_S4U_util/S4U_ReplyMailbox.h"
 //#include "S4U_PendingCommunication.h"
 
 namespace wrench {
@@ -41,10 +44,12 @@ namespace wrench {
 
         /** @brief The SimGrid communication handle */
         simgrid::s4u::CommPtr comm_ptr;
-        /** @brief The message */
-        SimulationMessage *simulation_message;
+        /** @brief The message (received by an asynchronous get, nullptr for an asynchronous put) */
+        SimulationMessage *simulation_message = nullptr;
         /** @brief The mailbox name */
         std::string mailbox_name;
+        /** @brief The reply mailbox of an asynchronous get, if held by the communication (nullptr otherwise) */
+        std::unique_ptr<S4U_ReplyMailbox> reply_mailbox = nullptr;
     };
 
     /*******************/
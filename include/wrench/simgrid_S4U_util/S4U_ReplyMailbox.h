@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_S4U_REPLYMAILBOX_H
+#define WRENCH_S4U_REPLYMAILBOX_H
+
+#include <string>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A reply mailbox (see S4U_Mailbox::getReplyMailbox()) that is held for the duration of a
+     *        request: the mailbox is released, so that it can be reused, only once release() has been
+     *        called (i.e., once all the answers to the request have been received). On any other path
+     *        (e.g., an exception or a timeout), the mailbox is discarded upon destruction, so that an
+     *        answer that arrives late is never received by a later request.
+     */
+    class S4U_ReplyMailbox {
+
+    public:
+
+        S4U_ReplyMailbox();
+
+        S4U_ReplyMailbox(S4U_ReplyMailbox &&other);
+
+        ~S4U_ReplyMailbox();
+
+        S4U_ReplyMailbox(const S4U_ReplyMailbox &) = delete;
+
+        S4U_ReplyMailbox &operator=(const S4U_ReplyMailbox &) = delete;
+
+        S4U_ReplyMailbox &operator=(S4U_ReplyMailbox &&) = delete;
+
+        const std::string &getName() const;
+
+        void release();
+
+    private:
+        std::string name;  // Mailbox name (empty once the mailbox has been released, or moved)
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_S4U_REPLYMAILBOX_H
@@ -13,6 +13,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <wrench/workflow/execution_events/FailureCause.h>
 
 namespace wrench {
@@ -21,6 +22,8 @@ namespace wrench {
     /** \cond INTERNAL     */
     /***********************/
 
+    struct ManagedMessageList;
+
     /**
     * @brief Top-level class to describe a message communicated by processes in the simulation
     */
@@ -28,15 +31,131 @@ namespace wrench {
 
     public:
 
+        /**
+         * @brief Message types, so that a message can be identified (and dispatched with a switch statement)
+         *        without going through a chain of dynamic casts
+         */
+        enum Type : unsigned short {
+            /** @brief A message that is not one of WRENCH's own messages (e.g., a user-defined message) */
+            GENERIC = 0,
+            // Service messages
+            SERVICE_STOP_DAEMON,
+            SERVICE_DAEMON_STOPPED,
+            SERVICE_TTL_EXPIRED,
+            // Alarm service messages
+            ALARM_SERVICE_WAKE_UP,
+            // Compute service messages
+            COMPUTE_SERVICE_SUBMIT_STANDARD_JOB_REQUEST,
+            COMPUTE_SERVICE_SUBMIT_STANDARD_JOB_ANSWER,
+            COMPUTE_SERVICE_STANDARD_JOB_DONE,
+            COMPUTE_SERVICE_STANDARD_JOB_FAILED,
+            COMPUTE_SERVICE_TERMINATE_STANDARD_JOB_REQUEST,
+            COMPUTE_SERVICE_TERMINATE_STANDARD_JOB_ANSWER,
+            COMPUTE_SERVICE_SUBMIT_PILOT_JOB_REQUEST,
+            COMPUTE_SERVICE_SUBMIT_PILOT_JOB_ANSWER,
+            COMPUTE_SERVICE_PILOT_JOB_STARTED,
+            COMPUTE_SERVICE_PILOT_JOB_EXPIRED,
+            COMPUTE_SERVICE_PILOT_JOB_FAILED,
+            COMPUTE_SERVICE_TERMINATE_PILOT_JOB_REQUEST,
+            COMPUTE_SERVICE_TERMINATE_PILOT_JOB_ANSWER,
+            COMPUTE_SERVICE_RESOURCE_INFORMATION_REQUEST,
+            COMPUTE_SERVICE_RESOURCE_INFORMATION_ANSWER,
+            // Batch service messages
+            BATCH_SIMULATION_BEGINS_TO_SCHEDULER,
+            BATCH_SCHED_READY,
+            BATCH_EXECUTE_JOB_FROM_BAT_SCHED,
+            BATCH_QUERY_ANSWER,
+            BATCH_JOB_SUBMISSION_TO_SCHEDULER,
+            BATCH_JOB_REPLY_FROM_SCHEDULER,
+            BATCH_SERVICE_JOB_REQUEST,
+            BATCH_SERVICE_BACKGROUND_JOB_SUBMISSION,
+            ALARM_JOB_TIME_OUT,
+            ALARM_NOTIFY_BATSCHED,
+            // Virtualized cluster service messages
+            VIRTUALIZED_CLUSTER_SERVICE_GET_EXECUTION_HOSTS_REQUEST,
+            VIRTUALIZED_CLUSTER_SERVICE_GET_EXECUTION_HOSTS_ANSWER,
+            VIRTUALIZED_CLUSTER_SERVICE_CREATE_VM_REQUEST,
+            VIRTUALIZED_CLUSTER_SERVICE_CREATE_VM_ANSWER,
+            VIRTUALIZED_CLUSTER_SERVICE_MIGRATE_VM_REQUEST,
+            VIRTUALIZED_CLUSTER_SERVICE_MIGRATE_VM_ANSWER,
+            // Standard job executor messages
+            WORKUNIT_EXECUTOR_DONE,
+            WORKUNIT_EXECUTOR_FAILED,
+            STANDARD_JOB_EXECUTOR_DONE,
+            STANDARD_JOB_EXECUTOR_FAILED,
+            COMPUTE_THREAD_DONE,
+            // Storage service messages
+            STORAGE_SERVICE_FREE_SPACE_REQUEST,
+            STORAGE_SERVICE_FREE_SPACE_ANSWER,
+            STORAGE_SERVICE_FILE_LOOKUP_REQUEST,
+            STORAGE_SERVICE_FILE_LOOKUP_ANSWER,
+            STORAGE_SERVICE_FILE_DELETE_REQUEST,
+            STORAGE_SERVICE_FILE_DELETE_ANSWER,
+            STORAGE_SERVICE_PARTITION_DELETE_REQUEST,
+            STORAGE_SERVICE_PARTITION_DELETE_ANSWER,
+            STORAGE_SERVICE_FILE_COPY_REQUEST,
+            STORAGE_SERVICE_FILE_COPY_ANSWER,
+            STORAGE_SERVICE_FILE_WRITE_REQUEST,
+            STORAGE_SERVICE_FILE_WRITE_ANSWER,
+            STORAGE_SERVICE_FILE_READ_REQUEST,
+            STORAGE_SERVICE_FILE_READ_ANSWER,
+            STORAGE_SERVICE_FILE_CONTENT,
+            // File registry service messages
+            FILE_REGISTRY_FILE_LOOKUP_REQUEST,
+            FILE_REGISTRY_FILE_LOOKUP_ANSWER,
+            FILE_REGISTRY_FILE_LOOKUP_BY_PROXIMITY_REQUEST,
+            FILE_REGISTRY_FILE_LOOKUP_BY_PROXIMITY_ANSWER,
+            FILE_REGISTRY_REMOVE_ENTRY_REQUEST,
+            FILE_REGISTRY_REMOVE_ENTRY_ANSWER,
+            FILE_REGISTRY_ADD_ENTRY_REQUEST,
+            FILE_REGISTRY_ADD_ENTRY_ANSWER,
+            // Network proximity service messages
+            NETWORK_PROXIMITY_LOOKUP_REQUEST,
+            NETWORK_PROXIMITY_LOOKUP_ANSWER,
+            NETWORK_PROXIMITY_BULK_LOOKUP_REQUEST,
+            NETWORK_PROXIMITY_BULK_LOOKUP_ANSWER,
+            NETWORK_PROXIMITY_ALL_LOOKUP_REQUEST,
+            NETWORK_PROXIMITY_ALL_LOOKUP_ANSWER,
+            NETWORK_PROXIMITY_COMPUTE_ANSWER,
+            NEXT_CONTACT_DAEMON_REQUEST,
+            NEXT_CONTACT_DAEMON_ANSWER,
+            NETWORK_PROXIMITY_TRANSFER,
+            COORDINATE_LOOKUP_REQUEST,
+            COORDINATE_LOOKUP_ANSWER,
+            // WMS messages
+            ALARM_WMS_DEFERRED_START,
+            /** @brief The number of message types */
+            NUM_TYPES
+        };
+
         SimulationMessage(std::string name, double payload);
-        virtual ~SimulationMessage(){};
+        SimulationMessage(Type type, std::string name, double payload);
+        virtual ~SimulationMessage();
+
+        static unsigned long getNumMessagesCreated(Type type);
+        static unsigned long getNumMessagesAlive(Type type);
+        static void resetNumMessagesCreated();
+
+        static void *operator new(size_t size);
+        static void operator delete(void *ptr, size_t size);
 
         virtual std::string getName();
 
+        /** @brief The message type */
+        Type type;
         /** @brief The message name */
         std::string name;
         /** @brief The message size in bytes */
         double payload;
+
+    private:
+        friend class MessageManager;
+
+        static unsigned long num_messages_created[NUM_TYPES];  // Number of messages created, by message type
+        static unsigned long num_messages_alive[NUM_TYPES];    // Number of messages that exist, by message type
+
+        ManagedMessageList *managed_in = nullptr;  // MessageManager list of the message's mailbox, if any
+        size_t managed_index = 0;                  // Position of the message in that list
     };
 
 
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONMESSAGEPOOL_H
+#define WRENCH_SIMULATIONMESSAGEPOOL_H
+
+#include <cstddef>
+#include <vector>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A size-class pool allocator for SimulationMessage objects: freed message blocks are
+     *        kept in per-size-class free lists and reused by subsequent messages of similar size,
+     *        so that sending a message does not require a call to malloc. Blocks are carved out of
+     *        large chunks, which are never returned to the system.
+     *
+     * @warning The pool is not thread-safe: simulated processes must not run concurrently
+     *          (which is the case with all SimGrid context factories, unless actors are run in parallel)
+     */
+    class SimulationMessagePool {
+
+    public:
+
+        /** @brief The size granularity of blocks, in bytes */
+        static const size_t GRANULARITY = 16;
+
+        /** @brief The size of the largest pooled blocks, in bytes (larger messages are allocated with malloc) */
+        static const size_t MAX_BLOCK_SIZE = 1024;
+
+        /**
+         * @brief Usage statistics of a size class
+         */
+        struct SizeClassStatistics {
+            /** @brief The size of the blocks of the class, in bytes */
+            size_t block_size;
+            /** @brief The number of blocks allocated so far */
+            unsigned long num_allocations;
+            /** @brief The number of blocks currently in use */
+            unsigned long num_in_use;
+            /** @brief The maximum number of blocks in use at any one time */
+            unsigned long max_num_in_use;
+            /** @brief The number of blocks obtained from the system */
+            unsigned long num_blocks;
+        };
+
+        static void *allocate(size_t size);
+
+        static void deallocate(void *ptr, size_t size);
+
+        static std::vector<SizeClassStatistics> getSizeClassStatistics();
+
+    private:
+
+        struct SizeClass {
+            void *free_list = nullptr;  // Singly-linked list of free blocks
+            SizeClassStatistics statistics = {0, 0, 0, 0, 0};
+        };
+
+        static std::vector<SizeClass> &getSizeClasses();
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_SIMULATIONMESSAGEPOOL_H
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_IDTABLE_H
+#define WRENCH_IDTABLE_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A table that interns string IDs (e.g., task or file IDs) as dense integer
+     *        indices (0, 1, 2, ...), with an open-addressing (linear probing) hash table to
+     *        find the index of an ID. Indices of erased IDs are never reused, unless the table
+     *        is constructed to reuse them (e.g., for IDs that come and go, which would otherwise
+     *        make the indices grow without bound).
+     */
+    class IDTable {
+
+    public:
+
+        /** @brief The index returned by find() for an unknown ID */
+        static const unsigned long NOT_FOUND;
+
+        IDTable();
+
+        explicit IDTable(bool reuse_erased_indices);
+
+        std::pair<unsigned long, bool> insert(const std::string &id);
+
+        unsigned long find(const std::string &id) const;
+
+        void erase(unsigned long index);
+
+        const std::string &getString(unsigned long index) const;
+
+        unsigned long getNumIndices() const;
+
+    private:
+
+        void grow();
+
+        unsigned long findSlot(const std::string &id, size_t hash) const;
+
+        std::vector<std::string> strings;   // ID strings, by index
+        std::vector<unsigned long> slots;   // hash table of (index + 1), 0 for an empty slot
+        unsigned long num_entries;          // number of IDs in the hash table
+        bool reuse_erased_indices;          // whether indices of erased IDs are reused
+        std::vector<unsigned long> erased_indices; // indices of erased IDs, to be reused (if they are)
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+
+#endif //WRENCH_IDTABLE_H
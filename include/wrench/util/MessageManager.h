@@ -10,8 +10,11 @@
 #ifndef WRENCH_MESSAGEMANAGER_H
 #define WRENCH_MESSAGEMANAGER_H
 
+#include <memory>
+#include <unordered_map>
 #include <wrench/services/Service.h>
 #include <wrench/simulation/SimulationMessage.h>
+#include <wrench/simgrid_S4U_util/S4U_MailboxHandle.h>
 
 namespace wrench {
 
@@ -19,6 +22,18 @@ namespace wrench {
     /** \cond INTERNAL     */
     /***********************/
 
+    /**
+     * @brief The in-flight messages of a mailbox (each message knows its position in the list)
+     */
+    struct ManagedMessageList {
+        /** @brief The mailbox name */
+        std::string mailbox;
+        /** @brief The messages */
+        std::vector<SimulationMessage *> messages;
+        /** @brief Whether the list was erased from the manager (mailbox handles must then look up their mailbox's list again) */
+        bool erased = false;
+    };
+
     /**
      * @brief A helper class that manages messages (in terms of memory deallocation to avoid leaks when
      *        a message was sent but never received)
@@ -26,13 +41,22 @@ namespace wrench {
 
     class MessageManager {
 
-        static std::map<std::string,std::vector<SimulationMessage*>> mailbox_messages;
+        // In-flight messages, by mailbox. A list is erased once it becomes empty, unless a mailbox handle
+        // refers to it (so that daemons do not look up their mailbox's list for every message), and when
+        // its mailbox is cleaned up
+        static std::unordered_map<std::string, std::shared_ptr<ManagedMessageList>> mailbox_messages;
+
+        static const std::shared_ptr<ManagedMessageList> &getMessageList(const std::string &mailbox);
+        static void eraseMessageList(std::unordered_map<std::string, std::shared_ptr<ManagedMessageList>>::iterator itr);
 
     public:
 
         static void manageMessage(std::string, SimulationMessage* msg);
+        static void manageMessage(const S4U_MailboxHandle &mailbox, SimulationMessage* msg);
         static void cleanUpMessages(std::string);
         static void removeReceivedMessages(std::string,SimulationMessage* msg);
+        static void unmanageMessage(SimulationMessage* msg);
+        static unsigned long getNumMessageLists();
 
     };
 
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_XMLSTREAMREADER_H
+#define WRENCH_XMLSTREAMREADER_H
+
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A minimal streaming (pull) XML reader that reports element start/end events
+     *        one at a time, so that arbitrarily large documents (e.g., DAX files) can be
+     *        processed with a memory footprint that does not depend on the document size.
+     *        Comments, processing instructions, DOCTYPE declarations, CDATA sections and
+     *        character data are skipped. Attribute values are entity-decoded.
+     */
+    class XMLStreamReader {
+
+    public:
+
+        /** @brief Reader events */
+        enum Event {
+            /** @brief The start tag of an element (also reported for empty elements) */
+            START_ELEMENT,
+            /** @brief The end tag of an element (also reported for empty elements) */
+            END_ELEMENT,
+            /** @brief The end of the document */
+            END_OF_DOCUMENT
+        };
+
+        explicit XMLStreamReader(std::istream &input);
+
+        Event next();
+
+        const std::string &getName() const;
+
+        unsigned long getDepth() const;
+
+        bool hasAttribute(const std::string &name) const;
+
+        const std::string &getAttribute(const std::string &name) const;
+
+    private:
+
+        int get();
+
+        int peek();
+
+        bool fill();
+
+        int getNonSpace();
+
+        void readName(int c, std::string &name);
+
+        void readAttributeValue(int quote, std::string &value);
+
+        void skipUntil(const std::string &terminator);
+
+        void skipDeclaration();
+
+        void fail(const std::string &message);
+
+        std::istream &input;
+
+        std::vector<char> buffer;
+        size_t buffer_position;
+        size_t buffer_end;
+        unsigned long line;
+
+        std::string name;
+        std::vector<std::pair<std::string, std::string>> attributes;
+        unsigned long num_attributes;
+
+        std::vector<std::string> open_elements;
+        unsigned long depth;
+        bool pending_end_element;
+        bool seen_root_element;
+
+        static const std::string empty_string;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+
+#endif //WRENCH_XMLSTREAMREADER_H
@@ -14,9 +14,11 @@
 #include <map>
 #include <set>
 
+#include "wrench/util/IDTable.h"
 #include "wrench/workflow/execution_events/WorkflowExecutionEvent.h"
 #include "WorkflowFile.h"
 #include "WorkflowTask.h"
+#include "WorkflowTaskSpan.h"
 
 class WorkflowTask;
 
@@ -53,6 +55,10 @@ namespace wrench {
 
         void loadFromJSON(const std::string &filename, const std::string &reference_flop_rate);
 
+        void saveBinary(const std::string &filename);
+
+        void loadBinary(const std::string &filename);
+
         unsigned long getNumberOfTasks();
 
         unsigned long getNumLevels();
@@ -83,6 +89,10 @@ namespace wrench {
 
         std::vector<WorkflowTask *> getTaskChildren(const WorkflowTask *task);
 
+        WorkflowTaskSpan getTaskParentsSpan(const WorkflowTask *task);
+
+        WorkflowTaskSpan getTaskChildrenSpan(const WorkflowTask *task);
+
 
         /***********************/
         /** \endcond           */
@@ -104,19 +114,73 @@ namespace wrench {
 
     private:
         friend class WorkflowTask;
+        friend class WorkflowFile;
 
         void setNumLevels(unsigned long);
 
+        void updateTopLevels();
+
+        void loadBinarySnapshot(const char *data, size_t size);
+
+        void updateTaskStateIndex(WorkflowTask *task, WorkflowTask::State previous_state);
+
+        void updateTaskClusterIndex(WorkflowTask *task, const std::string &previous_cluster_id);
+
         std::unique_ptr<lemon::ListDigraph> DAG;  // Lemon DiGraph
         std::unique_ptr<lemon::ListDigraph::NodeMap<WorkflowTask *>> DAG_node_map;  // Lemon map
 
-        std::map<std::string, std::unique_ptr<WorkflowTask>> tasks;
-        std::map<std::string, std::unique_ptr<WorkflowFile>> files;
+        IDTable task_ids;  // Interned task IDs
+        IDTable file_ids;  // Interned file IDs
+        std::vector<std::unique_ptr<WorkflowTask>> tasks;  // Indexed by interned task ID (nullptr for removed tasks)
+        std::vector<std::unique_ptr<WorkflowFile>> files;  // Indexed by interned file ID
+        unsigned long num_tasks;
+
+        std::vector<WorkflowTask *> tasks_by_id;  // All tasks sorted by ID (for getTasks()), nullptr for removed tasks
+        bool tasks_by_id_up_to_date;
+        unsigned long num_removed_tasks_by_id;    // Number of nullptr entries in tasks_by_id
+        std::vector<WorkflowFile *> files_by_id;  // All files sorted by ID (for getFiles())
+        bool files_by_id_up_to_date;
+
+        std::map<std::string, WorkflowTask *> ready_tasks;  // Tasks in the READY state (indexed by ID)
+        std::map<std::string, std::map<std::string, WorkflowTask *>> clustered_tasks;  // Tasks indexed by cluster ID and by ID
+        unsigned long num_tasks_in_state[WorkflowTask::State::COMPLETED + 1];  // Number of tasks in each visible state
 
         unsigned long num_levels;
+        bool top_levels_up_to_date;  // Whether task top-levels and num_levels reflect the current DAG
+
+        // Compressed sparse row (CSR) view of the children (or of the parents) of all tasks, kept up to
+        // date as the DAG changes. The neighbors of the task with interned ID i are stored contiguously,
+        // newest first (as in the DAG's arc order), at positions [firsts[i], ends[i]) of a segment that
+        // starts at starts[i]. A neighbor is added in the segment's free front slot, and a full segment is
+        // moved to the end of the array with twice its capacity; the array is compacted once the slots left
+        // behind outnumber the others, so that adding a dependency takes amortized constant time
+        struct TaskAdjacency {
+            std::vector<unsigned long> starts;
+            std::vector<unsigned long> firsts;
+            std::vector<unsigned long> ends;
+            std::vector<WorkflowTask *> tasks;
+            unsigned long num_unused_slots = 0;  // Slots that are not in any segment
+
+            void addIndex();
+            void add(unsigned long index, WorkflowTask *neighbor);
+            void remove(unsigned long index, WorkflowTask *neighbor);
+            void clear(unsigned long index);
+            WorkflowTaskSpan getSpan(unsigned long index) const;
+
+        private:
+            void move(unsigned long index, unsigned long capacity);
+            void compact();
+        };
+
+        TaskAdjacency children;
+        TaskAdjacency parents;
 
         bool pathExists(WorkflowTask *, WorkflowTask *);
 
+        void updateTopologicalOrder(WorkflowTask *, WorkflowTask *);
+
+        unsigned long next_topological_index;  // Position in the topological order of the next added task
+
         std::string callback_mailbox;
 
         ComputeService *parent_compute_service; // The compute service to which the job was submitted, if any
@@ -12,6 +12,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 
 namespace wrench {
@@ -43,20 +44,20 @@ namespace wrench {
 
         friend class WorkflowTask;
 
-        std::string id;
+        unsigned long index;  // Interned file ID (the ID string is in the workflow's file ID table)
         double size; // in bytes
 
         void setOutputOf(WorkflowTask * task);
 
         void setInputOf(WorkflowTask *task);
 
-        std::map<std::string, WorkflowTask *> getInputOf();
+        const std::vector<WorkflowTask *> &getInputOf();
 
         Workflow *workflow; // Containing workflow
-        WorkflowFile(const std::string, double);
+        WorkflowFile(unsigned long, double);
 
         WorkflowTask *output_of;
-        std::map<std::string, WorkflowTask *> input_of;
+        std::vector<WorkflowTask *> input_of;  // Sorted by interned task ID
 
     };
 
@@ -14,6 +14,7 @@
 #include <stack>
 #include <lemon/list_graph.h>
 #include <set>
+#include <vector>
 
 #include "wrench/workflow/job/WorkflowJob.h"
 #include "wrench/workflow/WorkflowFile.h"
@@ -127,14 +128,14 @@ namespace wrench {
 
         static std::string stateToString(WorkflowTask::InternalState state);
 
-        void updateTopLevel();
-
         void setInternalState(WorkflowTask::InternalState);
 
         void setState(WorkflowTask::State);
 
         WorkflowTask::InternalState getInternalState() const;
 
+        unsigned long getNumberOfIncompleteParents() const;
+
         void setJob(WorkflowJob *job);
 
         void setStartDate(double date);
@@ -152,8 +153,9 @@ namespace wrench {
     private:
 
         friend class Workflow;
+        friend class WorkflowFile;
 
-        std::string id;                    // Task ID
+        unsigned long index;               // Interned task ID (the ID string is in the workflow's task ID table)
         std::string cluster_id;            // ID for clustered task
         TaskType task_type;                // Task type
         double flops;                      // Number of flops
@@ -164,6 +166,11 @@ namespace wrench {
         long priority = 0;
 
         unsigned long toplevel;           // 0 if entry task
+        unsigned long topological_index;  // Position in the workflow's (incrementally maintained) topological order
+        unsigned long by_id_position = 0; // Position in the workflow's list of tasks sorted by ID (if up to date)
+        unsigned long num_children = 0;
+        unsigned long num_parents = 0;
+        unsigned long num_incomplete_parents = 0;  // Number of parents not in the TASK_COMPLETED internal state
 
         double start_date = -1.0;          // Date at which task began execution (getter?)
         double end_date = -1.0;            // Date at which task finished execution (getter?)
@@ -175,12 +182,12 @@ namespace wrench {
         Workflow *workflow;                                    // Containing workflow
         lemon::ListDigraph *DAG;                              // Containing workflow
         lemon::ListDigraph::Node DAG_node;                    // pointer to the underlying DAG node
-        std::map<std::string, WorkflowFile *> output_files;    // List of output files
-        std::map<std::string, WorkflowFile *> input_files;    // List of input files
+        std::vector<WorkflowFile *> output_files;    // List of output files (sorted by interned file ID)
+        std::vector<WorkflowFile *> input_files;     // List of input files (sorted by interned file ID)
         std::map<WorkflowFile *, std::pair<std::string, std::string>> fileTransfers;  // Map of transfer files and hosts
 
         // Private constructor (called by Workflow)
-        WorkflowTask(std::string id,
+        WorkflowTask(unsigned long index,
                      double t,
                      unsigned long min_num_cores,
                      unsigned long max_num_cores,
@@ -192,9 +199,9 @@ namespace wrench {
         WorkflowJob *job;
 
         // Private helper function
-        void addFileToMap(std::map<std::string, WorkflowFile *> &map_to_insert,
-                          std::map<std::string, WorkflowFile *> &map_to_check,
-                          WorkflowFile *f);
+        void addFileToList(std::vector<WorkflowFile *> &list_to_insert,
+                           std::vector<WorkflowFile *> &list_to_check,
+                           WorkflowFile *f);
     };
 };
 
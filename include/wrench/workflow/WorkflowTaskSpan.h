@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_WORKFLOWTASKSPAN_H
+#define WRENCH_WORKFLOWTASKSPAN_H
+
+#include <cstddef>
+
+namespace wrench {
+
+    class WorkflowTask;
+
+    /***********************/
+    /** \cond DEVELOPER    */
+    /***********************/
+
+    /**
+     * @brief A non-owning, read-only view of a contiguous sequence of workflow tasks
+     *        (e.g., the children or the parents of a task in the workflow's adjacency arrays),
+     *        which can be iterated over without allocating memory
+     *
+     * @warning A span is invalidated by any change to the structure of the workflow (adding or
+     *          removing tasks or dependencies)
+     */
+    class WorkflowTaskSpan {
+
+    public:
+
+        /** @brief Iterator type */
+        typedef WorkflowTask *const *iterator;
+
+        /**
+         * @brief Constructor
+         * @param first: pointer to the first task of the sequence
+         * @param last: pointer past the last task of the sequence
+         */
+        WorkflowTaskSpan(iterator first, iterator last) : first(first), last(last) {}
+
+        /** @brief Get an iterator to the first task
+         *  @return an iterator
+         */
+        iterator begin() const { return this->first; }
+
+        /** @brief Get an iterator past the last task
+         *  @return an iterator
+         */
+        iterator end() const { return this->last; }
+
+        /** @brief Get the number of tasks
+         *  @return a number of tasks
+         */
+        size_t size() const { return (size_t) (this->last - this->first); }
+
+        /** @brief Determine whether the sequence is empty
+         *  @return true or false
+         */
+        bool empty() const { return this->first == this->last; }
+
+        /** @brief Get a task in the sequence
+         *  @param i: the task's position
+         *  @return a task
+         */
+        WorkflowTask *operator[](size_t i) const { return this->first[i]; }
+
+    private:
+        iterator first;
+        iterator last;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_WORKFLOWTASKSPAN_H
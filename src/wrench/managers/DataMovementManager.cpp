@@ -62,7 +62,7 @@ namespace wrench {
      */
     void DataMovementManager::stop() {
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new ServiceStopDaemonMessage("", 0.0));
+        S4U_Mailbox::putMessage(this->mailbox, new ServiceStopDaemonMessage("", 0.0));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -234,7 +234,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name);
+        message = S4U_Mailbox::getMessage(this->mailbox);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -246,54 +246,58 @@ namespace wrench {
 
       WRENCH_INFO("Data Movement Manager got a %s message", message->getName().c_str());
 
-      if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-        // There shouldn't be any need to clean any state up
-        return false;
+      switch (message->type) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          // There shouldn't be any need to clean any state up
+          return false;
+        }
 
-      } else if (auto msg = dynamic_cast<StorageServiceFileCopyAnswerMessage *>(message.get())) {
-
-        // Remove the record and find the File Registry Service, if any
-        DataMovementManager::CopyRequestSpecs request(msg->file, msg->storage_service, msg->dst_partition, nullptr);
-        for (auto it = this->pending_file_copies.begin();
-             it != this->pending_file_copies.end();
-             ++it) {
-          if (*(*it) == request) {
-            request.file_registry_service = (*it)->file_registry_service;
-            this->pending_file_copies.erase(it); // remove the entry
-            break;
+        case SimulationMessage::STORAGE_SERVICE_FILE_COPY_ANSWER: {
+          auto msg = static_cast<StorageServiceFileCopyAnswerMessage *>(message.get());
+          // Remove the record and find the File Registry Service, if any
+          DataMovementManager::CopyRequestSpecs request(msg->file, msg->storage_service, msg->dst_partition, nullptr);
+          for (auto it = this->pending_file_copies.begin();
+               it != this->pending_file_copies.end();
+               ++it) {
+            if (*(*it) == request) {
+              request.file_registry_service = (*it)->file_registry_service;
+              this->pending_file_copies.erase(it); // remove the entry
+              break;
+            }
           }
-        }
 
-        bool file_registry_service_updated = false;
-        if (request.file_registry_service) {
-          WRENCH_INFO("Trying to do a register");
-          try {
-            request.file_registry_service->addEntry(request.file, request.dst);
-            file_registry_service_updated = true;
-          } catch (WorkflowExecutionException &e) {
-            WRENCH_INFO("Oops, couldn't do it");
-            // don't throw, just keep file_registry_service_update to false
+          bool file_registry_service_updated = false;
+          if (request.file_registry_service) {
+            WRENCH_INFO("Trying to do a register");
+            try {
+              request.file_registry_service->addEntry(request.file, request.dst);
+              file_registry_service_updated = true;
+            } catch (WorkflowExecutionException &e) {
+              WRENCH_INFO("Oops, couldn't do it");
+              // don't throw, just keep file_registry_service_update to false
+            }
           }
-        }
 
-          WRENCH_INFO("Forwarding status message");
-        // Forward it back
-        try {
-          S4U_Mailbox::dputMessage(msg->file->getWorkflow()->getCallbackMailbox(),
-                                   new StorageServiceFileCopyAnswerMessage(request.file,
-                                                                           request.dst,
-                                                                           request.dst_partition,
-                                                                           request.file_registry_service,
-                                                                           file_registry_service_updated,
-                                                                           msg->success,
-                                                                           std::move(msg->failure_cause), 0));
-        } catch  (std::shared_ptr<NetworkError> &cause) {
+            WRENCH_INFO("Forwarding status message");
+          // Forward it back
+          try {
+            S4U_Mailbox::dputMessage(msg->file->getWorkflow()->getCallbackMailbox(),
+                                     new StorageServiceFileCopyAnswerMessage(request.file,
+                                                                             request.dst,
+                                                                             request.dst_partition,
+                                                                             request.file_registry_service,
+                                                                             file_registry_service_updated,
+                                                                             msg->success,
+                                                                             std::move(msg->failure_cause), 0));
+          } catch  (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
           return true;
         }
-        return true;
 
-      } else {
-        throw std::runtime_error("DataMovementManager::waitForNextMessage(): Unexpected [" + message->getName() + "] message");
+        default: {
+          throw std::runtime_error("DataMovementManager::waitForNextMessage(): Unexpected [" + message->getName() + "] message");
+        }
       }
 
     }
@@ -71,7 +71,7 @@ namespace wrench {
      */
     void JobManager::stop() {
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new ServiceStopDaemonMessage("", 0.0));
+        S4U_Mailbox::putMessage(this->mailbox, new ServiceStopDaemonMessage("", 0.0));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -393,7 +393,7 @@ namespace wrench {
         for (auto task : ((StandardJob *) job)->tasks) {
           if (task->getState() == WorkflowTask::State::NOT_READY) {
             bool ready = true;
-            for (auto parent : task->getWorkflow()->getTaskParents(task)) {
+            for (auto parent : task->getWorkflow()->getTaskParentsSpan(task)) {
               if (parent->getState() != WorkflowTask::State::COMPLETED) {
                 ready = false;
               }
@@ -497,7 +497,7 @@ namespace wrench {
         std::unique_ptr<SimulationMessage> message = nullptr;
         try {
           WRENCH_INFO("Waiting for a message");
-          message = S4U_Mailbox::getMessage(this->mailbox_name);
+          message = S4U_Mailbox::getMessage(this->mailbox);
         } catch (std::shared_ptr<NetworkError> &cause) {
           continue;
         }
@@ -511,79 +511,29 @@ namespace wrench {
 
         WRENCH_INFO("Job Manager got a %s message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-          // There shouldn't be any need to clean any state up
-          keep_going = false;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceStandardJobDoneMessage *>(message.get())) {
-          // update job state
-          StandardJob *job = msg->job;
-          job->state = StandardJob::State::COMPLETED;
-
-          // Update all visible states
-          for (auto task : job->tasks) {
-            if (task->getInternalState() == WorkflowTask::InternalState::TASK_COMPLETED) {
-              task->setState(WorkflowTask::State::COMPLETED);
-            } else {
-              throw std::runtime_error("JobManager::main(): got a 'job done' message, but task " +
-                                       task->getID() + " does not have a TASK_COMPLETED internal state (" +
-                                       WorkflowTask::stateToString(task->getInternalState()) + ")");
-            }
-            auto children = this->wms->getWorkflow()->getTaskChildren(task);
-            for (auto child : children) {
-              switch (child->getInternalState()) {
-                case WorkflowTask::InternalState::TASK_NOT_READY:
-                case WorkflowTask::InternalState::TASK_RUNNING:
-                case WorkflowTask::InternalState::TASK_FAILED:
-                case WorkflowTask::InternalState::TASK_COMPLETED:
-                  // no nothing
-                  break;
-                case WorkflowTask::InternalState::TASK_READY:
-                  if (child->getState() == WorkflowTask::State::NOT_READY) {
-                    bool all_parents_ready = true;
-                    for (auto parent : child->getWorkflow()->getTaskParents(child)) {
-                      if (parent->getState() != WorkflowTask::State::COMPLETED) {
-                        all_parents_ready = false;
-                        break;
-                      }
-                    }
-                    if (all_parents_ready) {
-                      child->setState(WorkflowTask::State::READY);
-                    }
-                  }
-                  break;
-              }
-            }
+        switch (message->type) {
+          case SimulationMessage::SERVICE_STOP_DAEMON: {
+            // There shouldn't be any need to clean any state up
+            keep_going = false;
+            break;
           }
 
-          // move the job from the "pending" list to the "completed" list
-          this->pending_standard_jobs.erase(job);
-          this->completed_standard_jobs.insert(job);
-
+          case SimulationMessage::COMPUTE_SERVICE_STANDARD_JOB_DONE: {
+            auto msg = static_cast<ComputeServiceStandardJobDoneMessage *>(message.get());
+            // update job state
+            StandardJob *job = msg->job;
+            job->state = StandardJob::State::COMPLETED;
 
-          // Forward the notification along the notification chain
-          std::string callback_mailbox = job->popCallbackMailbox();
-          if (not callback_mailbox.empty()) {
-            try {
-              S4U_Mailbox::dputMessage(job->popCallbackMailbox(),
-                                       new ComputeServiceStandardJobDoneMessage(job, msg->compute_service, 0.0));
-            } catch (std::shared_ptr<NetworkError> &cause) {
-              // ignore
-            }
-          }
-          keep_going = true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceStandardJobFailedMessage *>(message.get())) {
-
-          // update job state
-          StandardJob *job = msg->job;
-          job->state = StandardJob::State::FAILED;
-
-          // update the task states and failure counts!
-          for (auto t: job->getTasks()) {
-            if (t->getInternalState() == WorkflowTask::InternalState::TASK_COMPLETED) {
-              t->setState(WorkflowTask::State::COMPLETED);
-              for (auto child : this->wms->getWorkflow()->getTaskChildren(t)) {
+            // Update all visible states
+            for (auto task : job->tasks) {
+              if (task->getInternalState() == WorkflowTask::InternalState::TASK_COMPLETED) {
+                task->setState(WorkflowTask::State::COMPLETED);
+              } else {
+                throw std::runtime_error("JobManager::main(): got a 'job done' message, but task " +
+                                         task->getID() + " does not have a TASK_COMPLETED internal state (" +
+                                         WorkflowTask::stateToString(task->getInternalState()) + ")");
+              }
+              for (auto child : this->wms->getWorkflow()->getTaskChildrenSpan(task)) {
                 switch (child->getInternalState()) {
                   case WorkflowTask::InternalState::TASK_NOT_READY:
                   case WorkflowTask::InternalState::TASK_RUNNING:
@@ -592,85 +542,141 @@ namespace wrench {
                     // no nothing
                     break;
                   case WorkflowTask::InternalState::TASK_READY:
-                    child->setState(WorkflowTask::State::READY);
+                    if (child->getState() == WorkflowTask::State::NOT_READY) {
+                      bool all_parents_ready = true;
+                      for (auto parent : child->getWorkflow()->getTaskParentsSpan(child)) {
+                        if (parent->getState() != WorkflowTask::State::COMPLETED) {
+                          all_parents_ready = false;
+                          break;
+                        }
+                      }
+                      if (all_parents_ready) {
+                        child->setState(WorkflowTask::State::READY);
+                      }
+                    }
                     break;
                 }
               }
+            }
 
-            } else if (t->getInternalState() == WorkflowTask::InternalState::TASK_READY) {
-              t->setState(WorkflowTask::State::READY);
-              t->incrementFailureCount();
+            // move the job from the "pending" list to the "completed" list
+            this->pending_standard_jobs.erase(job);
+            this->completed_standard_jobs.insert(job);
 
-            } else if (t->getInternalState() == WorkflowTask::InternalState::TASK_FAILED) {
-              bool ready = true;
-              for (auto parent : this->wms->getWorkflow()->getTaskParents(t)) {
-                if (parent->getInternalState() != WorkflowTask::InternalState::TASK_COMPLETED) {
-                  ready = false;
-                }
-              }
-              if (ready) {
-                t->setState(WorkflowTask::State::READY);
-              } else {
-                t->setState(WorkflowTask::State::NOT_READY);
+
+            // Forward the notification along the notification chain
+            std::string callback_mailbox = job->popCallbackMailbox();
+            if (not callback_mailbox.empty()) {
+              try {
+                S4U_Mailbox::dputMessage(job->popCallbackMailbox(),
+                                         new ComputeServiceStandardJobDoneMessage(job, msg->compute_service, 0.0));
+              } catch (std::shared_ptr<NetworkError> &cause) {
+                // ignore
               }
             }
-          }
-
-          // remove the job from the "pending" list
-          this->pending_standard_jobs.erase(job);
-          // put it in the "failed" list
-          this->failed_standard_jobs.insert(job);
-
-          // Forward the notification along the notification chain
-          try {
-            S4U_Mailbox::dputMessage(job->popCallbackMailbox(),
-                                     new ComputeServiceStandardJobFailedMessage(job, msg->compute_service,
-                                                                                std::move(msg->cause),
-                                                                                0.0));
-          } catch (std::shared_ptr<NetworkError> &cause) {
             keep_going = true;
+            break;
           }
 
-        } else if (auto msg = dynamic_cast<ComputeServicePilotJobStartedMessage *>(message.get())) {
+          case SimulationMessage::COMPUTE_SERVICE_STANDARD_JOB_FAILED: {
+            auto msg = static_cast<ComputeServiceStandardJobFailedMessage *>(message.get());
+            // update job state
+            StandardJob *job = msg->job;
+            job->state = StandardJob::State::FAILED;
+
+            // update the task states and failure counts!
+            for (auto t: job->getTasks()) {
+              if (t->getInternalState() == WorkflowTask::InternalState::TASK_COMPLETED) {
+                t->setState(WorkflowTask::State::COMPLETED);
+                for (auto child : this->wms->getWorkflow()->getTaskChildrenSpan(t)) {
+                  switch (child->getInternalState()) {
+                    case WorkflowTask::InternalState::TASK_NOT_READY:
+                    case WorkflowTask::InternalState::TASK_RUNNING:
+                    case WorkflowTask::InternalState::TASK_FAILED:
+                    case WorkflowTask::InternalState::TASK_COMPLETED:
+                      // no nothing
+                      break;
+                    case WorkflowTask::InternalState::TASK_READY:
+                      child->setState(WorkflowTask::State::READY);
+                      break;
+                  }
+                }
 
-          // update job state
-          PilotJob *job = msg->job;
-          job->state = PilotJob::State::RUNNING;
+              } else if (t->getInternalState() == WorkflowTask::InternalState::TASK_READY) {
+                t->setState(WorkflowTask::State::READY);
+                t->incrementFailureCount();
 
-          // move the job from the "pending" list to the "running" list
-          this->pending_pilot_jobs.erase(job);
-          this->running_pilot_jobs.insert(job);
+              } else if (t->getInternalState() == WorkflowTask::InternalState::TASK_FAILED) {
+                if (t->getNumberOfIncompleteParents() == 0) {
+                  t->setState(WorkflowTask::State::READY);
+                } else {
+                  t->setState(WorkflowTask::State::NOT_READY);
+                }
+              }
+            }
 
+            // remove the job from the "pending" list
+            this->pending_standard_jobs.erase(job);
+            // put it in the "failed" list
+            this->failed_standard_jobs.insert(job);
 
-          // Forward the notification to the source
-          WRENCH_INFO("Forwarding to %s", job->getOriginCallbackMailbox().c_str());
-          try {
-            S4U_Mailbox::dputMessage(job->getOriginCallbackMailbox(),
-                                     new ComputeServicePilotJobStartedMessage(job, msg->compute_service, 0.0));
-          } catch (std::shared_ptr<NetworkError> &cause) {
-            keep_going = true;
+            // Forward the notification along the notification chain
+            try {
+              S4U_Mailbox::dputMessage(job->popCallbackMailbox(),
+                                       new ComputeServiceStandardJobFailedMessage(job, msg->compute_service,
+                                                                                  std::move(msg->cause),
+                                                                                  0.0));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+              keep_going = true;
+            }
+            break;
           }
 
-        } else if (auto msg = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
+          case SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_STARTED: {
+            auto msg = static_cast<ComputeServicePilotJobStartedMessage *>(message.get());
+            // update job state
+            PilotJob *job = msg->job;
+            job->state = PilotJob::State::RUNNING;
 
-          // update job state
-          PilotJob *job = msg->job;
-          job->state = PilotJob::State::EXPIRED;
+            // move the job from the "pending" list to the "running" list
+            this->pending_pilot_jobs.erase(job);
+            this->running_pilot_jobs.insert(job);
 
-          // Remove the job from the "running" list
-          this->running_pilot_jobs.erase(job);
 
-          // Forward the notification to the source
-          WRENCH_INFO("Forwarding to %s", job->getOriginCallbackMailbox().c_str());
-          try {
-            S4U_Mailbox::dputMessage(job->getOriginCallbackMailbox(),
-                                     new ComputeServicePilotJobExpiredMessage(job, msg->compute_service, 0.0));
-          } catch (std::shared_ptr<NetworkError> &cause) {
-            keep_going = true;
+            // Forward the notification to the source
+            WRENCH_INFO("Forwarding to %s", job->getOriginCallbackMailbox().c_str());
+            try {
+              S4U_Mailbox::dputMessage(job->getOriginCallbackMailbox(),
+                                       new ComputeServicePilotJobStartedMessage(job, msg->compute_service, 0.0));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+              keep_going = true;
+            }
+            break;
+          }
+
+          case SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_EXPIRED: {
+            auto msg = static_cast<ComputeServicePilotJobExpiredMessage *>(message.get());
+            // update job state
+            PilotJob *job = msg->job;
+            job->state = PilotJob::State::EXPIRED;
+
+            // Remove the job from the "running" list
+            this->running_pilot_jobs.erase(job);
+
+            // Forward the notification to the source
+            WRENCH_INFO("Forwarding to %s", job->getOriginCallbackMailbox().c_str());
+            try {
+              S4U_Mailbox::dputMessage(job->getOriginCallbackMailbox(),
+                                       new ComputeServicePilotJobExpiredMessage(job, msg->compute_service, 0.0));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+              keep_going = true;
+            }
+            break;
           }
 
-        } else {
-          throw std::runtime_error("JobManager::main(): Unexpected [" + message->getName() + "] message");
+          default: {
+            throw std::runtime_error("JobManager::main(): Unexpected [" + message->getName() + "] message");
+          }
         }
       }
 
@@ -33,17 +33,34 @@ namespace wrench {
       this->name = process_name_prefix;
     }
 
+    /**
+     * @brief Parse a property or message payload value, so that typed getters do not
+     *        have to parse it each time they are called
+     * @param value: the value as a string
+     * @return the parsed value
+     */
+    Service::ParsedValue Service::parseValue(const std::string &value) {
+      ParsedValue parsed_value;
+      parsed_value.string_value = value;
+      parsed_value.is_double = (sscanf(value.c_str(), "%lf", &parsed_value.double_value) == 1);
+      if (value == "true") {
+        parsed_value.is_boolean = true;
+        parsed_value.boolean_value = true;
+      } else if (value == "false") {
+        parsed_value.is_boolean = true;
+        parsed_value.boolean_value = false;
+      }
+      return parsed_value;
+    }
+
     /**
       * @brief Set a property of the Service
       * @param property: the property
       * @param value: the property value
       */
     void Service::setProperty(std::string property, std::string value) {
-      if (this->property_list.find(property) != this->property_list.end()) {
-        this->property_list[property] = value;
-      } else {
-        this->property_list.insert(std::make_pair(property, value));
-      }
+      this->parsed_property_list[property] = parseValue(value);
+      this->property_list[property] = value;
     }
 
     /**
@@ -52,12 +69,13 @@ namespace wrench {
     * @param value: the message payload value
     */
     void Service::setMessagePayload(std::string messagepayload, std::string value) {
-      if (this->messagepayload_list.find(messagepayload) != this->messagepayload_list.end()) {
-        this->messagepayload_list[messagepayload] = value;
-      } else {
-        this->messagepayload_list.insert(std::make_pair(messagepayload, value));
-      }
+      ParsedValue parsed_value = parseValue(value);
+      // Message payloads are non-negative numbers of bytes
+      parsed_value.is_double = parsed_value.is_double and (parsed_value.double_value >= 0);
+      this->parsed_messagepayload_list[messagepayload] = parsed_value;
+      this->messagepayload_list[messagepayload] = value;
     }
+
     /**
      * @brief Get a property of the Service as a string
      * @param property: the property
@@ -65,12 +83,13 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    std::string Service::getPropertyValueAsString(std::string property) {
-      if (this->property_list.find(property) == this->property_list.end()) {
+    std::string Service::getPropertyValueAsString(const std::string &property) {
+      auto it = this->parsed_property_list.find(property);
+      if (it == this->parsed_property_list.end()) {
         throw std::invalid_argument("Service::getPropertyValueAsString(): Cannot find value for property " + property +
                                  " (perhaps a derived service class does not provide a default value?)");
       }
-      return this->property_list[property];
+      return it->second.string_value;
     }
 
     /**
@@ -80,15 +99,16 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    std::string Service::getMessagePayloadValueAsString(std::string message_payload) {
-      if (this->messagepayload_list.find(message_payload) == this->messagepayload_list.end()) {
+    std::string Service::getMessagePayloadValueAsString(const std::string &message_payload) {
+      auto it = this->parsed_messagepayload_list.find(message_payload);
+      if (it == this->parsed_messagepayload_list.end()) {
         throw std::invalid_argument("Service::getMessagePayloadValueAsString(): Cannot find value for message_payload " + message_payload +
                                     " (perhaps a derived service class does not provide a default value?)");
       }
-      return this->messagepayload_list[message_payload];
+      return it->second.string_value;
     }
 
-    
+
     /**
      * @brief Get a property of the Service as a double
      * @param property: the property
@@ -96,20 +116,18 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    double Service::getPropertyValueAsDouble(std::string property) {
-      double value;
-      std::string string_value;
-      try {
-        string_value = this->getPropertyValueAsString(property);
-      } catch (std::invalid_argument &e) {
-        throw;
+    double Service::getPropertyValueAsDouble(const std::string &property) {
+      auto it = this->parsed_property_list.find(property);
+      if (it == this->parsed_property_list.end()) {
+        throw std::invalid_argument("Service::getPropertyValueAsDouble(): Cannot find value for property " + property +
+                                    " (perhaps a derived service class does not provide a default value?)");
       }
-      if (sscanf(string_value.c_str(), "%lf", &value) != 1) {
+      if (not it->second.is_double) {
         throw std::invalid_argument(
                 "Service::getPropertyValueAsDouble(): Invalid double property value " + property + " " +
-                this->getPropertyValueAsString(property));
+                it->second.string_value);
       }
-      return value;
+      return it->second.double_value;
     }
 
     /**
@@ -119,24 +137,20 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    double Service::getMessagePayloadValueAsDouble(std::string message_payload) {
-      double value;
-      std::string string_value;
-      try {
-        string_value = this->getMessagePayloadValueAsString(message_payload);
-      } catch (std::invalid_argument &e) {
-        throw;
+    double Service::getMessagePayloadValueAsDouble(const std::string &message_payload) {
+      auto it = this->parsed_messagepayload_list.find(message_payload);
+      if (it == this->parsed_messagepayload_list.end()) {
+        throw std::invalid_argument("Service::getMessagePayloadValueAsDouble(): Cannot find value for message_payload " + message_payload +
+                                    " (perhaps a derived service class does not provide a default value?)");
       }
-      if ((sscanf(string_value.c_str(), "%lf", &value) != 1) || (value < 0)) {
+      if (not it->second.is_double) {
         throw std::invalid_argument(
                 "Service::getMessagePayloadValueAsDouble(): Invalid double message payload value " + message_payload + " " +
-                this->getMessagePayloadValueAsString(message_payload));
+                it->second.string_value);
       }
-      return value;
+      return it->second.double_value;
     }
 
-
-
     /**
      * @brief Get a property of the Service as a boolean
      * @param property: the property
@@ -144,23 +158,18 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    bool Service::getPropertyValueAsBoolean(std::string property) {
-      bool value;
-      std::string string_value;
-      try {
-        string_value = this->getPropertyValueAsString(property);
-      } catch (std::invalid_argument &e) {
-        throw;
+    bool Service::getPropertyValueAsBoolean(const std::string &property) {
+      auto it = this->parsed_property_list.find(property);
+      if (it == this->parsed_property_list.end()) {
+        throw std::invalid_argument("Service::getPropertyValueAsBoolean(): Cannot find value for property " + property +
+                                    " (perhaps a derived service class does not provide a default value?)");
       }
-      if (string_value == "true") {
-        return true;
-      } else if (string_value == "false") {
-        return false;
-      } else {
+      if (not it->second.is_boolean) {
         throw std::invalid_argument(
                 "Service::getPropertyValueAsBoolean(): Invalid boolean property value " + property + " " +
-                this->getPropertyValueAsString(property));
+                it->second.string_value);
       }
+      return it->second.boolean_value;
     }
 
     /**
@@ -196,11 +205,11 @@ namespace wrench {
       WRENCH_INFO("Telling the daemon listening on (%s) to terminate", this->mailbox_name.c_str());
 
       // Send a termination message to the daemon's mailbox_name - SYNCHRONOUSLY
-      std::string ack_mailbox = S4U_Mailbox::generateUniqueMailboxName("stop");
+      S4U_ReplyMailbox ack_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new ServiceStopDaemonMessage(
-                                        ack_mailbox,
+                                        ack_mailbox.getName(),
                                         this->getMessagePayloadValueAsDouble(ServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
@@ -210,10 +219,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(ack_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(ack_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      ack_mailbox.release();
 
       if (auto msg = dynamic_cast<ServiceDaemonStoppedMessage *>(message.get())) {
         this->state = Service::DOWN;
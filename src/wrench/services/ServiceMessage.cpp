@@ -13,11 +13,12 @@ namespace wrench {
 
     /**
      * @brief Constructor
+     * @param type: the message type
      * @param name: the message name
      * @param payload: message size in bytes
      */
-    ServiceMessage::ServiceMessage(std::string name, double payload) :
-            SimulationMessage("ServiceMessage::" + name, payload) {}
+    ServiceMessage::ServiceMessage(SimulationMessage::Type type, std::string name, double payload) :
+            SimulationMessage(type, "ServiceMessage::" + name, payload) {}
 
     /**
      * @brief Constructor
@@ -27,7 +28,7 @@ namespace wrench {
      * @throw std::invalid_arguments
      */
     ServiceStopDaemonMessage::ServiceStopDaemonMessage(std::string ack_mailbox, double payload)
-            : ServiceMessage("STOP_DAEMON", payload), ack_mailbox(std::move(ack_mailbox)) {}
+            : ServiceMessage(SimulationMessage::SERVICE_STOP_DAEMON, "STOP_DAEMON", payload), ack_mailbox(std::move(ack_mailbox)) {}
 
     /**
      * @brief Constructor
@@ -36,7 +37,7 @@ namespace wrench {
      * @throw std::invalid_arguments
      */
     ServiceDaemonStoppedMessage::ServiceDaemonStoppedMessage(double payload)
-            : ServiceMessage("DAEMON_STOPPED", payload) {}
+            : ServiceMessage(SimulationMessage::SERVICE_DAEMON_STOPPED, "DAEMON_STOPPED", payload) {}
 
 
   /**
@@ -46,7 +47,7 @@ namespace wrench {
     * @throw std::invalid_arguments
     */
     ServiceTTLExpiredMessage::ServiceTTLExpiredMessage(double payload)
-            : ServiceMessage("TTL_EXPIRED", payload) {}
+            : ServiceMessage(SimulationMessage::SERVICE_TTL_EXPIRED, "TTL_EXPIRED", payload) {}
 
 
 };
@@ -348,11 +348,11 @@ namespace wrench {
       }
 
       // send a "info request" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("get_service_info");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new ComputeServiceResourceInformationRequestMessage(
-                answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox, new ComputeServiceResourceInformationRequestMessage(
+                answer_mailbox.getName(),
                 this->getMessagePayloadValueAsDouble(
                         ComputeServiceMessagePayload::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -362,10 +362,11 @@ namespace wrench {
       // Get the reply
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceResourceInformationAnswerMessage *>(message.get())) {
         return msg->info;
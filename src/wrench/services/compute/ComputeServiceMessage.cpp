@@ -15,11 +15,12 @@ namespace wrench {
 
     /**
      * @brief Constructor
+     * @param type: the message type
      * @param name: message name
      * @param payload: message size in bytes
      */
-    ComputeServiceMessage::ComputeServiceMessage(std::string name, double payload) :
-            ServiceMessage("ComputeServiceMessage::" + name, payload) {
+    ComputeServiceMessage::ComputeServiceMessage(SimulationMessage::Type type, std::string name, double payload) :
+            ServiceMessage(type, "ComputeServiceMessage::" + name, payload) {
     }
 
 
@@ -37,7 +38,7 @@ namespace wrench {
             StandardJob *job,
             std::map<std::string, std::string> &service_specific_args,
             double payload) :
-            ComputeServiceMessage("SUBMIT_STANDARD_JOB_REQUEST", payload),
+            ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_SUBMIT_STANDARD_JOB_REQUEST, "SUBMIT_STANDARD_JOB_REQUEST", payload),
             service_specific_args(service_specific_args) {
       if ((answer_mailbox.empty()) || (job == nullptr)) {
         throw std::invalid_argument(
@@ -62,7 +63,7 @@ namespace wrench {
                                                                                                bool success,
                                                                                                std::shared_ptr<FailureCause> failure_cause,
                                                                                                double payload) :
-            ComputeServiceMessage("SUBMIT_STANDARD_JOB_ANSWER", payload) {
+            ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_SUBMIT_STANDARD_JOB_ANSWER, "SUBMIT_STANDARD_JOB_ANSWER", payload) {
       if ((job == nullptr) || (compute_service == nullptr) ||
               (success && (failure_cause != nullptr)) ||
               (!success && (failure_cause == nullptr))) {
@@ -86,7 +87,7 @@ namespace wrench {
     ComputeServiceStandardJobDoneMessage::ComputeServiceStandardJobDoneMessage(StandardJob *job,
                                                                                ComputeService *cs,
                                                                                double payload)
-            : ComputeServiceMessage("STANDARD_JOB_DONE", payload) {
+            : ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_STANDARD_JOB_DONE, "STANDARD_JOB_DONE", payload) {
       if ((job == nullptr) || (cs == nullptr)) {
         throw std::invalid_argument(
                 "ComputeServiceStandardJobDoneMessage::ComputeServiceStandardJobDoneMessage(): Invalid arguments");
@@ -108,7 +109,7 @@ namespace wrench {
                                                                                    ComputeService *cs,
                                                                                    std::shared_ptr<FailureCause> cause,
                                                                                    double payload)
-            : ComputeServiceMessage("STANDARD_JOB_FAILED", payload) {
+            : ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_STANDARD_JOB_FAILED, "STANDARD_JOB_FAILED", payload) {
       if ((job == nullptr) || (cs == nullptr) || (cause == nullptr)) {
         throw std::invalid_argument(
                 "ComputeServiceStandardJobFailedMessage::ComputeServiceStandardJobFailedMessage(): Invalid arguments");
@@ -130,7 +131,7 @@ namespace wrench {
             std::string answer_mailbox,
             StandardJob *job,
             double payload) :
-            ComputeServiceMessage("TERMINATE_STANDARD_JOB_REQUEST", payload) {
+            ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_TERMINATE_STANDARD_JOB_REQUEST, "TERMINATE_STANDARD_JOB_REQUEST", payload) {
       if ((answer_mailbox == "") || (job == nullptr)) {
         throw std::invalid_argument(
                 "ComputeServiceTerminateStandardJobRequestMessage::ComputeServiceTerminateStandardJobRequestMessage(): Invalid arguments");
@@ -154,7 +155,7 @@ namespace wrench {
                                                                                                      bool success,
                                                                                                      std::shared_ptr<FailureCause> failure_cause,
                                                                                                      double payload) :
-            ComputeServiceMessage("TERMINATE_STANDARD_JOB_ANSWER", payload) {
+            ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_TERMINATE_STANDARD_JOB_ANSWER, "TERMINATE_STANDARD_JOB_ANSWER", payload) {
       if ((job == nullptr) || (compute_service == nullptr) ||
               (success && (failure_cause != nullptr)) ||
               (!success && (failure_cause == nullptr))) {
@@ -180,7 +181,7 @@ namespace wrench {
                                                                                            PilotJob *job,
                                                                                            double payload)
             : ComputeServiceMessage(
-            "SUBMIT_PILOT_JOB_REQUEST", payload) {
+            SimulationMessage::COMPUTE_SERVICE_SUBMIT_PILOT_JOB_REQUEST, "SUBMIT_PILOT_JOB_REQUEST", payload) {
       if ((job == nullptr) || (answer_mailbox == "")) {
         throw std::invalid_argument(
                 "ComputeServiceSubmitPilotJobRequestMessage::ComputeServiceSubmitPilotJobRequestMessage(): Invalid arguments");
@@ -205,7 +206,7 @@ namespace wrench {
                                                                                          std::shared_ptr<FailureCause> failure_cause,
                                                                                          double payload)
             : ComputeServiceMessage(
-            "SUBMIT_PILOT_JOB_ANSWER", payload) {
+            SimulationMessage::COMPUTE_SERVICE_SUBMIT_PILOT_JOB_ANSWER, "SUBMIT_PILOT_JOB_ANSWER", payload) {
       if ((job == nullptr) || (compute_service == nullptr) ||
               (success && (failure_cause != nullptr)) ||
               (!success && (failure_cause == nullptr))) {
@@ -228,7 +229,7 @@ namespace wrench {
      */
     ComputeServicePilotJobStartedMessage::ComputeServicePilotJobStartedMessage(PilotJob *job, ComputeService *cs,
                                                                                double payload)
-            : ComputeServiceMessage("PILOT_JOB_STARTED", payload) {
+            : ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_STARTED, "PILOT_JOB_STARTED", payload) {
 
       if ((job == nullptr) || (cs == nullptr)) {
         throw std::invalid_argument(
@@ -248,7 +249,7 @@ namespace wrench {
      */
     ComputeServicePilotJobExpiredMessage::ComputeServicePilotJobExpiredMessage(PilotJob *job, ComputeService *cs,
                                                                                double payload)
-            : ComputeServiceMessage("PILOT_JOB_EXPIRED", payload) {
+            : ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_EXPIRED, "PILOT_JOB_EXPIRED", payload) {
       if ((job == nullptr) || (cs == nullptr)) {
         throw std::invalid_argument(
                 "ComputeServicePilotJobExpiredMessage::ComputeServicePilotJobExpiredMessage(): Invalid arguments");
@@ -267,7 +268,7 @@ namespace wrench {
      */
     ComputeServicePilotJobFailedMessage::ComputeServicePilotJobFailedMessage(PilotJob *job, ComputeService *cs,
                                                                              double payload) : ComputeServiceMessage(
-            "PILOT_JOB_FAILED", payload) {
+            SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_FAILED, "PILOT_JOB_FAILED", payload) {
       if ((job == nullptr) || (cs == nullptr)) {
         throw std::invalid_argument(
                 "ComputeServicePilotJobFailedMessage::ComputeServicePilotJobFailedMessage(): Invalid arguments");
@@ -288,7 +289,7 @@ namespace wrench {
             std::string answer_mailbox,
             PilotJob *job,
             double payload) :
-            ComputeServiceMessage("TERMINATE_PILOT_JOB_REQUEST", payload) {
+            ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_TERMINATE_PILOT_JOB_REQUEST, "TERMINATE_PILOT_JOB_REQUEST", payload) {
       if ((answer_mailbox == "") || (job == nullptr)) {
         throw std::invalid_argument(
                 "ComputeServiceTerminatePilotJobRequestMessage::ComputeServiceTerminatePilotJobRequestMessage(): Invalid arguments");
@@ -312,7 +313,7 @@ namespace wrench {
                                                                                                bool success,
                                                                                                std::shared_ptr<FailureCause> failure_cause,
                                                                                                double payload) :
-            ComputeServiceMessage("TERMINATE_PILOT_JOB_ANSWER", payload) {
+            ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_TERMINATE_PILOT_JOB_ANSWER, "TERMINATE_PILOT_JOB_ANSWER", payload) {
       if ((job == nullptr) || (compute_service == nullptr) ||
               (success && (failure_cause != nullptr)) ||
               (!success && (failure_cause == nullptr))) {
@@ -334,7 +335,7 @@ namespace wrench {
      */
     ComputeServiceResourceInformationRequestMessage::ComputeServiceResourceInformationRequestMessage(std::string answer_mailbox,
                                                                                        double payload)
-            : ComputeServiceMessage("RESOURCE_DESCRIPTION_REQUEST", payload) {
+            : ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_RESOURCE_INFORMATION_REQUEST, "RESOURCE_DESCRIPTION_REQUEST", payload) {
       if (answer_mailbox.empty()) {
         throw std::invalid_argument(
                 "ComputeServiceResourceInformationRequestMessage::ComputeServiceResourceInformationRequestMessage(): Invalid arguments");
@@ -352,5 +353,5 @@ namespace wrench {
      */
     ComputeServiceResourceInformationAnswerMessage::ComputeServiceResourceInformationAnswerMessage(
             std::map<std::string, std::vector<double>> info, double payload)
-            : ComputeServiceMessage("RESOURCE_DESCRIPTION_ANSWER", payload), info(info) {}
+            : ComputeServiceMessage(SimulationMessage::COMPUTE_SERVICE_RESOURCE_INFORMATION_ANSWER, "RESOURCE_DESCRIPTION_ANSWER", payload), info(info) {}
 };
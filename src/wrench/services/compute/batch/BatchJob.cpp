@@ -31,6 +31,7 @@ namespace wrench {
         );
       }
       this->job = job;
+      this->run_time = -1;
       if (jobid <= 0 || num_nodes == 0 || cores_per_node == 0) {
         std::cout << "Info: " << jobid << " " << time_in_minutes << " " << num_nodes << " " << cores_per_node << "\n";
         throw std::invalid_argument(
@@ -45,6 +46,35 @@ namespace wrench {
       this->arrival_time_stamp = arrival_time_stamp;
     }
 
+    /**
+     * @brief Constructor for a background job, i.e., a job from a workload trace that is
+     *        not backed by a workflow job and whose execution is not simulated (it simply
+     *        holds its resources for its run time)
+     *
+     * @param jobid: the batch job id
+     * @param run_time: the job's actual run time in seconds
+     * @param time_in_minutes: the requested execution time in minutes
+     * @param num_nodes: the requested number of compute nodes (hosts)
+     * @param cores_per_node: the requested number of cores per node
+     * @param arrival_time_stamp: the job's arrival date
+     */
+    BatchJob::BatchJob(unsigned long jobid, double run_time, unsigned long time_in_minutes, unsigned long num_nodes,
+                       unsigned long cores_per_node, double arrival_time_stamp) {
+      if (jobid <= 0 || num_nodes == 0 || cores_per_node == 0 || run_time < 0) {
+        throw std::invalid_argument(
+                "BatchJob::BatchJob(): either jobid, num_nodes, cores_per_node is less than or equal to zero, or run_time is negative"
+        );
+      }
+      this->job = nullptr;
+      this->run_time = run_time;
+      this->jobid = jobid;
+      this->allocated_time = time_in_minutes * 60.0;
+      this->num_nodes = num_nodes;
+      this->cores_per_node = cores_per_node;
+      this->ending_time_stamp = -1;
+      this->arrival_time_stamp = arrival_time_stamp;
+    }
+
     /**
      * @brief Get the number of cores per node
      * @return a number of cores
@@ -76,7 +106,7 @@ namespace wrench {
     double BatchJob::getMemoryRequirement() {
       WorkflowJob *workflow_job = this->job;
       double memory_requirement = 0.0;
-      if (workflow_job->getType() == WorkflowJob::STANDARD) {
+      if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD)) {
         auto standard_job = (StandardJob *)workflow_job;
         for (auto const &t : standard_job->getTasks()) {
           double ram = t->getMemoryRequirement();
@@ -103,6 +133,33 @@ namespace wrench {
       return this->job;
     }
 
+    /**
+     * @brief Determine whether this batch job is a background job (i.e., it has no workflow job)
+     * @return true or false
+     */
+    bool BatchJob::isBackgroundJob() {
+      return this->job == nullptr;
+    }
+
+    /**
+     * @brief Get the actual run time of a background job
+     * @return a time in seconds (-1 if the job is not a background job)
+     */
+    double BatchJob::getRunTime() {
+      return this->run_time;
+    }
+
+    /**
+     * @brief Get a name for this batch job (for logging purposes)
+     * @return the name of the workflow job, or a name based on the job id for a background job
+     */
+    std::string BatchJob::getName() {
+      if (this->job == nullptr) {
+        return "background_job_" + std::to_string(this->jobid);
+      }
+      return this->job->getName();
+    }
+
     /**
      * @brief Get the id of this batch job
      * @return a string id
@@ -76,6 +76,8 @@ namespace wrench {
       if ((this->getPropertyValueAsString(BatchServiceProperty::BATCH_SCHEDULING_ALGORITHM) == "FCFS") and
           (this->getPropertyValueAsString(BatchServiceProperty::HOST_SELECTION_ALGORITHM) == "FIRSTFIT")) {
         return getStartTimeEstimatesForFCFS(set_of_jobs);
+      } else if (this->getPropertyValueAsString(BatchServiceProperty::BATCH_SCHEDULING_ALGORITHM) != "FCFS") {
+        return getStartTimeEstimatesForBackfilling(set_of_jobs);
       } else {
         throw WorkflowExecutionException(std::shared_ptr<FunctionalityNotAvailable>(
                 new FunctionalityNotAvailable(this, "start time estimates")));
@@ -191,10 +193,12 @@ namespace wrench {
       int i = 0;
       for (auto h : compute_hosts) {
         this->nodes_to_cores_map.insert({h, num_cores_available});
-        this->available_nodes_to_cores.insert({h, num_cores_available});
         this->host_id_to_names[i++] = h;
       }
       this->compute_hosts = compute_hosts;
+      this->available_cores_index = HostAvailabilityIndex(compute_hosts, (unsigned long) num_cores_available);
+      this->running_jobs_profile = NodeAvailabilityProfile(compute_hosts.size());
+      this->reservations_profile = this->running_jobs_profile;
 
       this->num_cores_per_node = this->nodes_to_cores_map.begin()->second;
       this->total_num_of_nodes = compute_hosts.size();
@@ -305,11 +309,11 @@ namespace wrench {
                                      num_hosts, num_cores_per_host, -1, S4U_Simulation::getClock());
 
       // Send a "run a batch job" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("batch_standard_job_mailbox");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new BatchServiceJobRequestMessage(
-                                        answer_mailbox, batch_job,
+                                        answer_mailbox.getName(), batch_job,
                                         this->getMessagePayloadValueAsDouble(
                                                 BatchServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -319,10 +323,11 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -404,11 +409,11 @@ namespace wrench {
                                      nodes_asked_for, num_cores_per_hosts, -1, S4U_Simulation::getClock());
 
       //  send a "run a batch job" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("batch_pilot_job_mailbox");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new BatchServiceJobRequestMessage(
-                                        answer_mailbox, batch_job,
+                                        answer_mailbox.getName(), batch_job,
                                         this->getMessagePayloadValueAsDouble(
                                                 BatchServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -418,10 +423,11 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -453,12 +459,12 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_standard_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       // Send a "terminate a pilot job" message to the daemon's mailbox_name
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new ComputeServiceTerminateStandardJobRequestMessage(answer_mailbox, job,
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new ComputeServiceTerminateStandardJobRequestMessage(answer_mailbox.getName(), job,
                                                                                      this->getMessagePayloadValueAsDouble(
                                                                                              BatchServiceMessagePayload::TERMINATE_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -469,10 +475,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceTerminateStandardJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -525,6 +532,10 @@ namespace wrench {
       while (keep_going) {
         keep_going = processNextMessage();
 
+        if (keep_going) {
+          this->processBackgroundJobCompletions();
+        }
+
 #ifdef ENABLE_BATSCHED
         //        if (keep_going && this->isBatschedReady()) {
         if (keep_going) {
@@ -532,7 +543,13 @@ namespace wrench {
         }
 #else
         if (keep_going) {
-          while (this->scheduleOneQueuedJob());
+          std::string scheduling_algorithm =
+                  this->getPropertyValueAsString(BatchServiceProperty::BATCH_SCHEDULING_ALGORITHM);
+          if (scheduling_algorithm == "FCFS") {
+            while (this->scheduleOneQueuedJob());
+          } else {
+            this->scheduleQueuedJobsWithBackfilling(scheduling_algorithm == "conservative_bf");
+          }
         }
 #endif
       }
@@ -589,7 +606,7 @@ namespace wrench {
      */
     void BatchService::freeUpResources(std::set<std::tuple<std::string, unsigned long, double>> resources) {
       for (auto r : resources) {
-        this->available_nodes_to_cores[std::get<0>(r)] += std::get<1>(r);
+        this->available_cores_index.releaseCores(this->available_cores_index.getHostID(std::get<0>(r)), std::get<1>(r));
       }
     }
 
@@ -602,6 +619,7 @@ namespace wrench {
         throw std::runtime_error("BatchService::removeJobFromRunningList(): Cannot find job!");
       }
       this->running_jobs.erase(job);
+      this->running_jobs_profile.release(job->getBeginTimeStamp(), job->getEndingTimeStamp(), job->getNumNodes());
     }
 
     /**
@@ -614,7 +632,7 @@ namespace wrench {
       }
 
       for (auto const &j: this->all_jobs) {
-        if (j->getWorkflowJob() == job->getWorkflowJob()) {
+        if (j.get() == job) {
           this->all_jobs.erase(j);
           break;
         }
@@ -717,105 +735,29 @@ namespace wrench {
                                   unsigned long cores_per_node,
                                   double ram_per_node) {
 
-      if (ram_per_node > Simulation::getHostMemoryCapacity(this->available_nodes_to_cores.begin()->first)) {
+      if (ram_per_node > Simulation::getHostMemoryCapacity(this->compute_hosts.front())) {
         throw std::runtime_error("BatchService::scheduleOnHosts(): Asking for too much RAM per host");
       }
-      if (num_nodes > this->available_nodes_to_cores.size()) {
+      if (num_nodes > this->available_cores_index.getNumHosts()) {
         throw std::runtime_error("BatchService::scheduleOnHosts(): Asking for too many hosts");
       }
-      if (cores_per_node > Simulation::getHostNumCores(this->available_nodes_to_cores.begin()->first)) {
+      if (cores_per_node > Simulation::getHostNumCores(this->compute_hosts.front())) {
         throw std::runtime_error("BatchService::scheduleOnHosts(): Asking for too many cores per host");
       }
 
       std::set<std::tuple<std::string, unsigned long, double>> resources = {};
-      std::vector<std::string> hosts_assigned = {};
+      std::vector<unsigned long> hosts_assigned;
       if (host_selection_algorithm == "FIRSTFIT") {
-        std::map<std::string, unsigned long>::iterator map_it;
-        unsigned long host_count = 0;
-        for (map_it = this->available_nodes_to_cores.begin();
-             map_it != this->available_nodes_to_cores.end(); map_it++) {
-          if ((*map_it).second >= cores_per_node) {
-            //Remove that many cores from the available_nodes_to_core
-            (*map_it).second -= cores_per_node;
-            hosts_assigned.push_back((*map_it).first);
-            resources.insert(std::make_tuple((*map_it).first, cores_per_node, ram_per_node));
-            if (++host_count >= num_nodes) {
-              break;
-            }
-          }
-        }
-        if (resources.size() < num_nodes) {
-          resources = {};
-          std::vector<std::string>::iterator vector_it;
-          for (vector_it = hosts_assigned.begin(); vector_it != hosts_assigned.end(); vector_it++) {
-            available_nodes_to_cores[*vector_it] += cores_per_node;
-          }
-        }
+        hosts_assigned = this->available_cores_index.selectFirstFit(num_nodes, cores_per_node);
       } else if (host_selection_algorithm == "BESTFIT") {
-        while (resources.size() < num_nodes) {
-          unsigned long target_slack = 0;
-          std::string target_host = "";
-          unsigned long target_num_cores = 0;
-
-          for (auto h : this->available_nodes_to_cores) {
-            std::string hostname = std::get<0>(h);
-            unsigned long num_available_cores = std::get<1>(h);
-            if (num_available_cores < cores_per_node) {
-              continue;
-            }
-            unsigned long tentative_target_num_cores = std::min(num_available_cores, cores_per_node);
-            unsigned long tentative_target_slack =
-                    num_available_cores - tentative_target_num_cores;
-
-            if (target_host.empty() ||
-                (tentative_target_num_cores > target_num_cores) ||
-                ((tentative_target_num_cores == target_num_cores) &&
-                 (target_slack > tentative_target_slack))) {
-              target_host = hostname;
-              target_num_cores = tentative_target_num_cores;
-              target_slack = tentative_target_slack;
-            }
-          }
-          if (target_host == "") {
-            WRENCH_INFO("Didn't find a suitable host");
-            resources = {};
-            std::vector<std::string>::iterator it;
-            for (it = hosts_assigned.begin(); it != hosts_assigned.end(); it++) {
-              available_nodes_to_cores[*it] += cores_per_node;
-            }
-            break;
-          }
-          this->available_nodes_to_cores[target_host] -= cores_per_node;
-          hosts_assigned.push_back(target_host);
-          resources.insert(std::make_tuple(target_host, cores_per_node, ComputeService::ALL_RAM));
-        }
+        hosts_assigned = this->available_cores_index.selectBestFit(num_nodes, cores_per_node);
+        // BESTFIT has always reserved the full RAM of its hosts
+        ram_per_node = ComputeService::ALL_RAM;
       } else if (host_selection_algorithm == "ROUNDROBIN") {
-        static unsigned long round_robin_host_selector_idx = 0;
-        unsigned long cur_host_idx = round_robin_host_selector_idx;
-        unsigned long host_count = 0;
-        do {
-          cur_host_idx = (cur_host_idx + 1) % available_nodes_to_cores.size();
-          auto it = this->compute_hosts.begin();
-          it = it + cur_host_idx;
-          std::string cur_host_name = *it;
-          unsigned long num_available_cores = available_nodes_to_cores[cur_host_name];
-          if (num_available_cores >= cores_per_node) {
-            available_nodes_to_cores[cur_host_name] -= cores_per_node;
-            hosts_assigned.push_back(cur_host_name);
-            resources.insert(std::make_tuple(cur_host_name, cores_per_node, ram_per_node));
-            if (++host_count >= num_nodes) {
-              break;
-            }
-          }
-        } while (cur_host_idx != round_robin_host_selector_idx);
-        if (resources.size() < num_nodes) {
-          resources = {};
-          std::vector<std::string>::iterator it;
-          for (it = hosts_assigned.begin(); it != hosts_assigned.end(); it++) {
-            available_nodes_to_cores[*it] += cores_per_node;
-          }
-        } else {
-          round_robin_host_selector_idx = cur_host_idx;
+        hosts_assigned = this->available_cores_index.selectRoundRobin(num_nodes, cores_per_node,
+                                                                      this->round_robin_last_host_id);
+        if (not hosts_assigned.empty()) {
+          this->round_robin_last_host_id = hosts_assigned.back();
         }
       } else {
         throw std::invalid_argument(
@@ -824,6 +766,16 @@ namespace wrench {
         );
       }
 
+      if (hosts_assigned.empty()) {
+        WRENCH_INFO("Didn't find suitable hosts");
+        return resources;
+      }
+
+      for (auto host_id : hosts_assigned) {
+        this->available_cores_index.allocateCores(host_id, cores_per_node);
+        resources.insert(std::make_tuple(this->available_cores_index.getHostname(host_id), cores_per_node, ram_per_node));
+      }
+
       return resources;
     }
 
@@ -860,12 +812,10 @@ namespace wrench {
                 "BatchService::scheduleAllQueuedJobs(): Found no job in pending queue to dispatch"
         );
       }
-      WorkflowJob *workflow_job = batch_job->getWorkflowJob();
 
       /* Get the nodes and cores per nodes asked for */
       unsigned long cores_per_node_asked_for = batch_job->getAllocatedCoresPerNode();
       unsigned long num_nodes_asked_for = batch_job->getNumNodes();
-      double allocated_time = batch_job->getAllocatedTime();
 
 //      WRENCH_INFO("Trying to see if I can run job (batch_job = %ld)(%s)",
 //                  (unsigned long)batch_job,
@@ -879,11 +829,11 @@ namespace wrench {
 
 
       if (resources.empty()) {
-        WRENCH_INFO("Can't run job %s right now", workflow_job->getName().c_str());
+        WRENCH_INFO("Can't run job %s right now", batch_job->getName().c_str());
         return false;
       }
 
-      WRENCH_INFO("Running job %s", workflow_job->getName().c_str());
+      WRENCH_INFO("Running job %s", batch_job->getName().c_str());
 
       // Remove it from the pending list
       for (auto it = this->pending_jobs.begin(); it != this->pending_jobs.end(); it++) {
@@ -893,14 +843,86 @@ namespace wrench {
         }
       }
 
-      this->running_jobs.insert(batch_job);
-
-      startJob(resources, workflow_job, batch_job, num_nodes_asked_for, allocated_time,
-               cores_per_node_asked_for);
+      this->startQueuedJob(batch_job, resources);
       return true;
 
     }
 
+    /**
+     * @brief Schedule queued jobs with a backfilling algorithm, based on the node availability
+     *        profile of the running jobs (which hold their nodes until the end of their requested walltimes):
+     *          - queued jobs are started in order for as long as they fit;
+     *          - the first job that does not fit gets a reservation at the earliest date
+     *            at which enough nodes are available for its walltime;
+     *          - a later job is started right away (i.e., backfilled) if enough nodes are available
+     *            for its walltime without delaying any reservation. With EASY backfilling, that's all.
+     *            With conservative backfilling, each job that cannot be started gets a reservation
+     *            as well, so that no job is ever delayed by a job that was queued after it.
+     *
+     *        Like batsched, the profile counts whole nodes: jobs that share nodes make it pessimistic.
+     *        The resulting profile, with the reservations, is kept for start time estimates.
+     *
+     * @param conservative: true for conservative backfilling, false for EASY backfilling
+     */
+    void BatchService::scheduleQueuedJobsWithBackfilling(bool conservative) {
+
+      double now = S4U_Simulation::getClock();
+      std::string host_selection_algorithm =
+              this->getPropertyValueAsString(BatchServiceProperty::HOST_SELECTION_ALGORITHM);
+
+      // Start from the profile of the running jobs (a job that has exceeded its walltime
+      // and has yet to be killed is accounted for until the end of its walltime only)
+      this->reservations_profile = this->running_jobs_profile;
+      NodeAvailabilityProfile &profile = this->reservations_profile;
+
+      bool reservation_made = false;
+      for (auto it = this->pending_jobs.begin(); it != this->pending_jobs.end();) {
+        BatchJob *batch_job = *it;
+        unsigned long num_nodes = batch_job->getNumNodes();
+        double walltime = batch_job->getAllocatedTime();
+
+        // Start the job now if it fits without delaying a reservation
+        std::set<std::tuple<std::string, unsigned long, double>> resources = {};
+        if ((not reservation_made) or (profile.getEarliestStartDate(now, walltime, num_nodes) <= now)) {
+          resources = this->scheduleOnHosts(host_selection_algorithm, num_nodes,
+                                            batch_job->getAllocatedCoresPerNode(), ComputeService::ALL_RAM);
+        }
+
+        if (not resources.empty()) {
+          WRENCH_INFO("Running job %s%s", batch_job->getName().c_str(),
+                      reservation_made ? " (backfilled)" : "");
+          it = this->pending_jobs.erase(it);
+          this->startQueuedJob(batch_job, resources);
+          profile.allocate(now, batch_job->getEndingTimeStamp(), num_nodes);
+          continue;
+        }
+
+        // Otherwise, give it a reservation if need be
+        if (conservative or (not reservation_made)) {
+          double start_date = profile.getEarliestStartDate(now, walltime, num_nodes);
+          WRENCH_INFO("Reserving nodes for job %s at date %lf",
+                      batch_job->getName().c_str(), start_date);
+          profile.allocate(start_date, start_date + walltime, num_nodes);
+          reservation_made = true;
+        }
+        it++;
+      }
+    }
+
+    /**
+     * @brief Start a job that has been removed from the pending job queue
+     *
+     * @param batch_job: the batch job
+     * @param resources: the resources allocated to the job
+     */
+    void BatchService::startQueuedJob(BatchJob *batch_job,
+                                      std::set<std::tuple<std::string, unsigned long, double>> resources) {
+      this->running_jobs.insert(batch_job);
+
+      startJob(resources, batch_job->getWorkflowJob(), batch_job, batch_job->getNumNodes(),
+               batch_job->getAllocatedTime(), batch_job->getAllocatedCoresPerNode());
+    }
+
     /**
     * @brief Declare all current jobs as failed (likely because the daemon is being terminated
     * or has timed out (because it's in fact a pilot job))
@@ -916,7 +938,7 @@ namespace wrench {
         std::vector<BatchJob *> to_erase;
         for (auto const &j : this->running_jobs) {
           WorkflowJob *workflow_job = j->getWorkflowJob();
-          if (workflow_job->getType() == WorkflowJob::STANDARD) {
+          if ((not j->isBackgroundJob()) and (workflow_job->getType() == WorkflowJob::STANDARD)) {
             auto *job = (StandardJob *) workflow_job;
             terminateRunningStandardJob(job);
             this->sendStandardJobFailureNotification(job, std::to_string(j->getJobID()),
@@ -926,7 +948,7 @@ namespace wrench {
         }
 
         for (auto const &j : to_erase) {
-          this->running_jobs.erase(j);
+          this->removeJobFromRunningList(j);
           this->freeJobFromJobsList(j);
         }
         to_erase.clear();
@@ -938,7 +960,7 @@ namespace wrench {
 
         for (auto it1 = this->pending_jobs.begin(); it1 != this->pending_jobs.end(); it1++) {
           WorkflowJob *workflow_job = (*it1)->getWorkflowJob();
-          if (workflow_job->getType() == WorkflowJob::STANDARD) {
+          if ((not (*it1)->isBackgroundJob()) and (workflow_job->getType() == WorkflowJob::STANDARD)) {
             to_erase.push_back(it1);
             auto *job = (StandardJob *) workflow_job;
             this->sendStandardJobFailureNotification(job, std::to_string((*it1)->getJobID()),
@@ -958,7 +980,7 @@ namespace wrench {
 
         for (auto it2 = this->waiting_jobs.begin(); it2 != this->waiting_jobs.end(); it2++) {
           WorkflowJob *workflow_job = (*it2)->getWorkflowJob();
-          if (workflow_job->getType() == WorkflowJob::STANDARD) {
+          if ((not (*it2)->isBackgroundJob()) and (workflow_job->getType() == WorkflowJob::STANDARD)) {
             to_erase.push_back(*it2);
             auto *job = (StandardJob *) workflow_job;
             this->sendStandardJobFailureNotification(job, std::to_string((*it2)->getJobID()),
@@ -991,13 +1013,13 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_pilot_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       // Send a "terminate a pilot job" message to the daemon's mailbox_name
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new ComputeServiceTerminatePilotJobRequestMessage(
-                                        answer_mailbox, job,
+                                        answer_mailbox.getName(), job,
                                         this->getMessagePayloadValueAsDouble(
                                                 BatchServiceMessagePayload::TERMINATE_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -1008,10 +1030,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceTerminatePilotJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -1055,7 +1078,7 @@ namespace wrench {
 
         // Stopping services
         for (auto &job : this->running_jobs) {
-          if ((job)->getWorkflowJob()->getType() == WorkflowJob::PILOT) {
+          if ((not job->isBackgroundJob()) and ((job)->getWorkflowJob()->getType() == WorkflowJob::PILOT)) {
             PilotJob *p_job = (PilotJob *) ((job)->getWorkflowJob());
             BatchService *cs = (BatchService *) p_job->getComputeService();
             if (cs == nullptr) {
@@ -1073,7 +1096,7 @@ namespace wrench {
 
         // Cleaning up data structures
         for (auto &job : to_erase) {
-          this->running_jobs.erase(job);
+          this->removeJobFromRunningList(job);
           this->freeJobFromJobsList(job);
         }
 
@@ -1088,11 +1111,15 @@ namespace wrench {
      */
     bool BatchService::processNextMessage() {
 
-      // Wait for a message
+      // Wait for a message, or for the next background job completion
       std::unique_ptr<SimulationMessage> message = nullptr;
+      double timeout = -1;
+      if (not this->running_background_jobs.empty()) {
+        timeout = std::max<double>(0, std::get<0>(this->running_background_jobs.top()) - S4U_Simulation::getClock());
+      }
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name);
+        message = S4U_Mailbox::getMessage(this->mailbox, timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -1105,104 +1132,137 @@ namespace wrench {
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
 
-      if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-        this->setStateToDown();
-        this->failCurrentStandardJobs();
-        this->terminateRunningPilotJobs();
-        this->cleanup();
-        // Send back a synchronous reply!
-        try {
-          S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                  new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
-                                          BatchServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+      switch (message->type) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+          this->setStateToDown();
+          this->failCurrentStandardJobs();
+          this->terminateRunningPilotJobs();
+          this->cleanup();
+          // Send back a synchronous reply!
+          try {
+            S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                    new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
+                                            BatchServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
 
-        } catch (std::shared_ptr<NetworkError> &cause) {
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
+          }
           return false;
         }
-        return false;
 
-      } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-        processGetResourceInformation(msg->answer_mailbox);
-        return true;
-
-      } else if (auto msg = dynamic_cast<BatchServiceJobRequestMessage *>(message.get())) {
-        processJobSubmission(msg->job, msg->answer_mailbox);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_RESOURCE_INFORMATION_REQUEST: {
+          auto msg = static_cast<ComputeServiceResourceInformationRequestMessage *>(message.get());
+          processGetResourceInformation(msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<StandardJobExecutorDoneMessage *>(message.get())) {
-        processStandardJobCompletion(msg->executor, msg->job);
-        return true;
+        case SimulationMessage::BATCH_SERVICE_JOB_REQUEST: {
+          auto msg = static_cast<BatchServiceJobRequestMessage *>(message.get());
+          processJobSubmission(msg->job, msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<StandardJobExecutorFailedMessage *>(message.get())) {
-        processStandardJobFailure(msg->executor, msg->job, msg->cause);
-        return true;
+        case SimulationMessage::BATCH_SERVICE_BACKGROUND_JOB_SUBMISSION: {
+          auto msg = static_cast<BatchServiceBackgroundJobSubmissionMessage *>(message.get());
+          processBackgroundJobSubmission(msg->job);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get())) {
-        processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
-        return true;
+        case SimulationMessage::STANDARD_JOB_EXECUTOR_DONE: {
+          auto msg = static_cast<StandardJobExecutorDoneMessage *>(message.get());
+          processStandardJobCompletion(msg->executor, msg->job);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
-        processPilotJobCompletion(msg->job);
-        return true;
+        case SimulationMessage::STANDARD_JOB_EXECUTOR_FAILED: {
+          auto msg = static_cast<StandardJobExecutorFailedMessage *>(message.get());
+          processStandardJobFailure(msg->executor, msg->job, msg->cause);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get())) {
-        processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_TERMINATE_STANDARD_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get());
+          processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<AlarmJobTimeOutMessage *>(message.get())) {
-        if (this->running_jobs.find(msg->job) == this->running_jobs.end()) {
-          WRENCH_INFO("Received a time out message (%ld) for an unknown batch job (%ld)... ignoring",
-                      (unsigned long) (message.get()),
-                      (unsigned long) msg->job);
-//          WRENCH_INFO("----> %ld", (unsigned long) msg->job->getWorkflowJob());
+        case SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_EXPIRED: {
+          auto msg = static_cast<ComputeServicePilotJobExpiredMessage *>(message.get());
+          processPilotJobCompletion(msg->job);
           return true;
         }
-        if (msg->job->getWorkflowJob()->getType() == WorkflowJob::STANDARD) {
-          this->processStandardJobTimeout((StandardJob *) (msg->job->getWorkflowJob()));
-          this->removeJobFromRunningList(msg->job);
-          this->freeUpResources(msg->job->getResourcesAllocated());
-          this->sendStandardJobFailureNotification((StandardJob *) msg->job->getWorkflowJob(),
-                                                   std::to_string(msg->job->getJobID()),
-                                                   std::shared_ptr<FailureCause>(new JobTimeout(msg->job->getWorkflowJob())));
+
+        case SimulationMessage::COMPUTE_SERVICE_TERMINATE_PILOT_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get());
+          processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
           return true;
-        } else if (msg->job->getWorkflowJob()->getType() == WorkflowJob::PILOT) {
-          WRENCH_INFO("Terminating pilot job %s", msg->job->getWorkflowJob()->getName().c_str());
-          auto *pilot_job = (PilotJob *) msg->job->getWorkflowJob();
-          ComputeService *cs = pilot_job->getComputeService();
-          try {
-            cs->stop();
-          } catch (wrench::WorkflowExecutionException &e) {
+        }
+
+        case SimulationMessage::ALARM_JOB_TIME_OUT: {
+          auto msg = static_cast<AlarmJobTimeOutMessage *>(message.get());
+          if (this->running_jobs.find(msg->job) == this->running_jobs.end()) {
+            WRENCH_INFO("Received a time out message (%ld) for an unknown batch job (%ld)... ignoring",
+                        (unsigned long) (message.get()),
+                        (unsigned long) msg->job);
+//          WRENCH_INFO("----> %ld", (unsigned long) msg->job->getWorkflowJob());
+            return true;
+          }
+          if (msg->job->getWorkflowJob()->getType() == WorkflowJob::STANDARD) {
+            this->processStandardJobTimeout((StandardJob *) (msg->job->getWorkflowJob()));
+            this->removeJobFromRunningList(msg->job);
+            this->freeUpResources(msg->job->getResourcesAllocated());
+            this->sendStandardJobFailureNotification((StandardJob *) msg->job->getWorkflowJob(),
+                                                     std::to_string(msg->job->getJobID()),
+                                                     std::shared_ptr<FailureCause>(new JobTimeout(msg->job->getWorkflowJob())));
+            return true;
+          } else if (msg->job->getWorkflowJob()->getType() == WorkflowJob::PILOT) {
+            WRENCH_INFO("Terminating pilot job %s", msg->job->getWorkflowJob()->getName().c_str());
+            auto *pilot_job = (PilotJob *) msg->job->getWorkflowJob();
+            ComputeService *cs = pilot_job->getComputeService();
+            try {
+              cs->stop();
+            } catch (wrench::WorkflowExecutionException &e) {
+              throw std::runtime_error(
+                      "BatchService::processNextMessage(): Not able to terminate the pilot job"
+              );
+            }
+            this->processPilotJobCompletion(pilot_job);
+            return true;
+          } else {
             throw std::runtime_error(
-                    "BatchService::processNextMessage(): Not able to terminate the pilot job"
+                    "BatchService::processNextMessage(): Alarm about unknown job type " +
+                    std::to_string(msg->job->getWorkflowJob()->getType())
             );
           }
-          this->processPilotJobCompletion(pilot_job);
-          return true;
-        } else {
-          throw std::runtime_error(
-                  "BatchService::processNextMessage(): Alarm about unknown job type " +
-                  std::to_string(msg->job->getWorkflowJob()->getType())
-          );
         }
 
 #ifdef ENABLE_BATSCHED
-        //      } else if (auto msg = dynamic_cast<BatchSchedReadyMessage *>(message.get())) {
-//        is_bat_sched_ready = true;
-//        return true;
+//        case SimulationMessage::BATCH_SCHED_READY: {
+//          is_bat_sched_ready = true;
+//          return true;
+//        }
+
+        case SimulationMessage::BATCH_EXECUTE_JOB_FROM_BAT_SCHED: {
+          auto msg = static_cast<BatchExecuteJobFromBatSchedMessage *>(message.get());
+          processExecuteJobFromBatSched(msg->batsched_decision_reply);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<BatchExecuteJobFromBatSchedMessage *>(message.get())) {
-        processExecuteJobFromBatSched(msg->batsched_decision_reply);
-        return true;
-//      } else if (auto msg = dynamic_cast<AlarmNotifyBatschedMessage *>(message.get())) {
-//        //first forward this notification to the batsched
-//        this->notifyJobEventsToBatSched(msg->job_id, "SUCCESS", "COMPLETED_SUCCESSFULLY", "");
-//        return true;
+//        case SimulationMessage::ALARM_NOTIFY_BATSCHED: {
+//          auto msg = static_cast<AlarmNotifyBatschedMessage *>(message.get());
+//          //first forward this notification to the batsched
+//          this->notifyJobEventsToBatSched(msg->job_id, "SUCCESS", "COMPLETED_SUCCESSFULLY", "");
+//          return true;
+//        }
 #endif
-      } else {
-        throw std::runtime_error(
-                "BatchService::processNextMessage(): Unknown message type: " +
-                std::to_string(message->payload));
-        return false;
+
+        default: {
+          throw std::runtime_error(
+                  "BatchService::processNextMessage(): Unknown message type: " +
+                  std::to_string(message->payload));
+          return false;
+        }
       }
     }
 
@@ -1265,11 +1325,11 @@ namespace wrench {
 
         double required_ram_per_host = job->getMemoryRequirement();
 
-        if ((requested_hosts > this->available_nodes_to_cores.size()) or
+        if ((requested_hosts > this->available_cores_index.getNumHosts()) or
             (requested_num_cores_per_host >
-             Simulation::getHostNumCores(this->available_nodes_to_cores.begin()->first)) or
+             Simulation::getHostNumCores(this->compute_hosts.front())) or
             (required_ram_per_host >
-             Simulation::getHostMemoryCapacity(this->available_nodes_to_cores.begin()->first))) {
+             Simulation::getHostMemoryCapacity(this->compute_hosts.front()))) {
 
           {
             try {
@@ -1291,9 +1351,9 @@ namespace wrench {
         }
       }
 
-      if ((requested_hosts > this->available_nodes_to_cores.size()) or
+      if ((requested_hosts > this->available_cores_index.getNumHosts()) or
           (requested_num_cores_per_host >
-           Simulation::getHostNumCores(this->available_nodes_to_cores.begin()->first))) {
+           Simulation::getHostNumCores(this->compute_hosts.front()))) {
         try {
           S4U_Mailbox::dputMessage(answer_mailbox,
                                    new ComputeServiceSubmitPilotJobAnswerMessage(
@@ -1343,6 +1403,50 @@ namespace wrench {
       this->pending_jobs.push_back(job);
     }
 
+    /**
+     * @brief Process a background job submission
+     *
+     * @param job: the (background) batch job
+     */
+    void BatchService::processBackgroundJobSubmission(BatchJob *job) {
+
+      WRENCH_INFO("Asked to run background job %s", job->getName().c_str());
+
+      // Add the RJMS delay to the job's requested time
+      job->setAllocatedTime(job->getAllocatedTime() +
+                            this->getPropertyValueAsDouble(BatchServiceProperty::BATCH_RJMS_DELAY));
+      this->all_jobs.insert(std::unique_ptr<BatchJob>(job));
+      this->pending_jobs.push_back(job);
+    }
+
+    /**
+     * @brief Process the completion of all the running background jobs whose run
+     *        time (or walltime) has elapsed
+     */
+    void BatchService::processBackgroundJobCompletions() {
+
+      double now = S4U_Simulation::getClock();
+      while ((not this->running_background_jobs.empty()) and (std::get<0>(this->running_background_jobs.top()) <= now)) {
+        BatchJob *batch_job = std::get<2>(this->running_background_jobs.top());
+        this->running_background_jobs.pop();
+
+        WRENCH_INFO("Background job %s has completed", batch_job->getName().c_str());
+
+        this->freeUpResources(batch_job->getResourcesAllocated());
+        this->removeJobFromRunningList(batch_job);
+
+#ifdef ENABLE_BATSCHED
+        if (batch_job->getRunTime() > batch_job->getAllocatedTime()) {
+          this->notifyJobEventsToBatSched(std::to_string(batch_job->getJobID()), "TIMEOUT", "COMPLETED_FAILED", "", "JOB_COMPLETED");
+        } else {
+          this->notifyJobEventsToBatSched(std::to_string(batch_job->getJobID()), "SUCCESS", "COMPLETED_SUCCESSFULLY", "", "JOB_COMPLETED");
+        }
+#endif
+
+        this->freeJobFromJobsList(batch_job);
+      }
+    }
+
     /**
      * @brief Process a pilot job completion
      *
@@ -1443,10 +1547,7 @@ namespace wrench {
           job_id = std::to_string((*it1)->getJobID());
           this->processPilotJobTimeout((PilotJob *) (*it1)->getWorkflowJob());
           // Update the cores count in the available resources
-          std::set<std::tuple<std::string, unsigned long, double>> resources = (*it1)->getResourcesAllocated();
-          for (auto r : resources) {
-            this->available_nodes_to_cores[std::get<0>(r)] += std::get<1>(r);
-          }
+          this->freeUpResources((*it1)->getResourcesAllocated());
           ComputeServiceTerminatePilotJobAnswerMessage *answer_message = new ComputeServiceTerminatePilotJobAnswerMessage(
                   job, this, true, nullptr,
                   this->getMessagePayloadValueAsDouble(
@@ -1459,7 +1560,7 @@ namespace wrench {
           //this is the list of raw pointers
 
           BatchJob *to_erase = *it1;
-          this->running_jobs.erase(it1);
+          this->removeJobFromRunningList(to_erase);
 
           //this is the list of unique pointers
           this->freeJobFromJobsList(to_erase);
@@ -1639,6 +1740,22 @@ namespace wrench {
                            BatchJob *batch_job, unsigned long num_nodes_allocated,
                            double allocated_time,
                            unsigned long cores_per_node_asked_for) {
+      if (batch_job->isBackgroundJob()) {
+        // No execution to simulate: the job holds its resources until it completes or reaches its walltime
+        WRENCH_INFO("Allocating %ld nodes with %ld cores per node to background job %s",
+                    num_nodes_allocated, cores_per_node_asked_for, batch_job->getName().c_str());
+        // (like for a standard job, the ending time stamp is that of the walltime, which is all the scheduler knows)
+        batch_job->setBeginTimeStamp(S4U_Simulation::getClock());
+        batch_job->setEndingTimeStamp(S4U_Simulation::getClock() + allocated_time);
+        this->running_jobs_profile.allocate(batch_job->getBeginTimeStamp(), batch_job->getEndingTimeStamp(),
+                                            batch_job->getNumNodes());
+        batch_job->setAllocatedResources(resources);
+        this->running_background_jobs.push(
+                std::make_tuple(S4U_Simulation::getClock() + std::min(batch_job->getRunTime(), allocated_time),
+                                batch_job->getJobID(), batch_job));
+        return;
+      }
+
       switch (workflow_job->getType()) {
         case WorkflowJob::STANDARD: {
           auto job = (StandardJob *) workflow_job;
@@ -1657,7 +1774,10 @@ namespace wrench {
                           nullptr,
                           {{StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD,
                                    this->getPropertyValueAsString(
-                                           BatchServiceProperty::THREAD_STARTUP_OVERHEAD)}},
+                                           BatchServiceProperty::THREAD_STARTUP_OVERHEAD)},
+                           {StandardJobExecutorProperty::SIMULATE_COMPUTE_THREADS,
+                                   this->getPropertyValueAsString(
+                                           BatchServiceProperty::SIMULATE_COMPUTE_THREADS)}},
                           {}));
           executor->start(executor, true);
           batch_job->setBeginTimeStamp(S4U_Simulation::getClock());
@@ -1666,6 +1786,8 @@ namespace wrench {
 
 //          this->running_jobs.insert(std::move(batch_job_ptr));
           this->timeslots.push_back(batch_job->getEndingTimeStamp());
+          this->running_jobs_profile.allocate(batch_job->getBeginTimeStamp(), batch_job->getEndingTimeStamp(),
+                                              batch_job->getNumNodes());
           //remember the allocated resources for the job
           batch_job->setAllocatedResources(resources);
 
@@ -1701,7 +1823,10 @@ namespace wrench {
                   new MultihostMulticoreComputeService(host_to_run_on,
                                                        resources,
                                                        {{MultihostMulticoreComputeServiceProperty::SUPPORTS_STANDARD_JOBS, "true"},
-                                                        {MultihostMulticoreComputeServiceProperty::SUPPORTS_PILOT_JOBS, "false"}}, {}, getScratch()
+                                                        {MultihostMulticoreComputeServiceProperty::SUPPORTS_PILOT_JOBS, "false"},
+                                                        {MultihostMulticoreComputeServiceProperty::SIMULATE_COMPUTE_THREADS,
+                                                                this->getPropertyValueAsString(BatchServiceProperty::SIMULATE_COMPUTE_THREADS)}},
+                                                       {}, getScratch()
                   ));
           cs->simulation = this->simulation;
           job->setComputeService(cs);
@@ -1718,6 +1843,8 @@ namespace wrench {
           // Put the job in the running queue
 //          this->running_jobs.insert(std::move(batch_job_ptr));
           this->timeslots.push_back(batch_job->getEndingTimeStamp());
+          this->running_jobs_profile.allocate(batch_job->getBeginTimeStamp(), batch_job->getEndingTimeStamp(),
+                                              batch_job->getNumNodes());
 
           //remember the allocated resources for the job
           batch_job->setAllocatedResources(resources);
@@ -1777,8 +1904,8 @@ namespace wrench {
 
       // Num idle cores per hosts
       std::vector<double> num_idle_cores;
-      for (auto h : this->available_nodes_to_cores) {
-        num_idle_cores.push_back((double) (h.second));
+      for (auto host_id : this->available_cores_index.getHostIDsInHostnameOrder()) {
+        num_idle_cores.push_back((double) (this->available_cores_index.getNumAvailableCores(host_id)));
       }
       dict.insert(std::make_pair("num_idle_cores", num_idle_cores));
 
@@ -1798,11 +1925,12 @@ namespace wrench {
 
       // RAM availability per host  (0 if something is running, full otherwise)
       std::vector<double> ram_availabilities;
-      for (auto h : this->available_nodes_to_cores) {
-        if (h.second < S4U_Simulation::getHostMemoryCapacity(h.first)) {
+      for (auto host_id : this->available_cores_index.getHostIDsInHostnameOrder()) {
+        const std::string &hostname = this->available_cores_index.getHostname(host_id);
+        if (this->available_cores_index.getNumAvailableCores(host_id) < S4U_Simulation::getHostMemoryCapacity(hostname)) {
           ram_availabilities.push_back(0.0);
         } else {
-          ram_availabilities.push_back(S4U_Simulation::getHostMemoryCapacity(h.first));
+          ram_availabilities.push_back(S4U_Simulation::getHostMemoryCapacity(hostname));
         }
       }
 
@@ -1858,20 +1986,35 @@ namespace wrench {
 
       // Assumes time origin is zero for simplicity!
 
-      // Set the available time of each code to zero (i.e., now)
+      // Set the available time of each core to zero (i.e., now), for each host ID
       // (invariant: for each host, core availabilities are sorted by
       //             non-decreasing available time)
-      std::map<std::string, std::vector<double>> core_available_times;
-      for (auto h : this->nodes_to_cores_map) {
-        std::string hostname = h.first;
-        unsigned long num_cores = h.second;
-        std::vector<double> zeros;
-        for (unsigned int i = 0; i < num_cores; i++) {
-          zeros.push_back(0);
-        }
-        core_available_times.insert(std::make_pair(hostname, zeros));
-      }
-
+      unsigned long num_hosts_total = this->available_cores_index.getNumHosts();
+      std::vector<std::vector<double>> core_available_times(num_hosts_total,
+                                                            std::vector<double>(this->num_cores_per_node, 0));
+
+      // Set the first cores of a host to a (larger) available time, and restore the invariant
+      auto set_core_available_times = [&core_available_times](unsigned long host_id, unsigned long num_cores,
+                                                              double available_time) {
+          std::vector<double> &times = core_available_times[host_id];
+          std::fill(times.begin(), times.begin() + num_cores, available_time);
+          std::inplace_merge(times.begin(), times.begin() + num_cores, times.end());
+      };
+
+      // Compute the earliest date at which a number of hosts have a number of cores available, and
+      // put these hosts at the beginning of a vector of (date, hostname rank) pairs (ties are
+      // broken by hostname, as when sorting the hosts by date)
+      const std::vector<unsigned long> &host_ids = this->available_cores_index.getHostIDsInHostnameOrder();
+      std::vector<std::pair<double, unsigned long>> earliest_start_times(num_hosts_total);
+      auto compute_earliest_start_time = [&host_ids, &core_available_times, &earliest_start_times](
+              unsigned long num_hosts, unsigned long num_cores_per_host) {
+          for (unsigned long rank = 0; rank < host_ids.size(); rank++) {
+            earliest_start_times[rank] = std::make_pair(core_available_times[host_ids[rank]][num_cores_per_host - 1], rank);
+          }
+          std::nth_element(earliest_start_times.begin(), earliest_start_times.begin() + num_hosts - 1,
+                           earliest_start_times.end());
+          return earliest_start_times[num_hosts - 1].first;
+      };
 
       // Update core availabilities for jobs that are currently running
       for (auto job : this->running_jobs) {
@@ -1879,29 +2022,13 @@ namespace wrench {
                                           job->getAllocatedTime() -
                                           this->simulation->getCurrentSimulatedDate());
         for (auto resource : job->getResourcesAllocated()) {
-          std::string hostname = std::get<0>(resource);
+          unsigned long host_id = this->available_cores_index.getHostID(std::get<0>(resource));
           unsigned long num_cores = std::get<1>(resource);
-          double ram = std::get<2>(resource);
           // Update available_times
-          double new_available_time = *(core_available_times[hostname].begin() + num_cores - 1) + time_to_finish;
-          for (unsigned int i = 0; i < num_cores; i++) {
-            *(core_available_times[hostname].begin() + i) = new_available_time;
-          }
-          // Sort them!
-          std::sort(core_available_times[hostname].begin(), core_available_times[hostname].end());
-        }
-      }
-
-      #if 0
-      std::cerr << "TIMELINES AFTER ACCOUNTING FOR RUNNING JOBS: \n";
-      for (auto h : core_available_times) {
-        std::cerr << "  " << h.first << ":\n";
-        for (auto t : h.second) {
-          std::cerr << "     core : " << t << "\n";
+          double new_available_time = core_available_times[host_id][num_cores - 1] + time_to_finish;
+          set_core_available_times(host_id, num_cores, new_available_time);
         }
       }
-      std::cerr << "----------------------------------------\n";
-      #endif
 
       // Go through the pending jobs and update core availabilities
       for (auto job : this->pending_jobs) {
@@ -1909,60 +2036,23 @@ namespace wrench {
         unsigned long num_hosts = job->getNumNodes();
         unsigned long num_cores_per_host = job->getAllocatedCoresPerNode();
 
-        #if 0
-        std::cerr << "ACCOUNTING FOR RUNNING JOB WITH " << "duration:" <<
-                  duration << " num_hosts=" << num_hosts << " num_cores_per_host=" << num_cores_per_host << "\n";
-        #endif
-
-        // Compute the  earliest start times on all hosts
-        std::vector<std::pair<std::string, double>> earliest_start_times;
-        for (auto h : core_available_times) {
-          double earliest_start_time = *(h.second.begin() + num_cores_per_host - 1);
-          earliest_start_times.emplace_back(std::make_pair(h.first, earliest_start_time));
-        }
-
-        // Sort the hosts by earliest start times
-        std::sort(earliest_start_times.begin(), earliest_start_times.end(),
-                  [](std::pair<std::string, double> const &a, std::pair<std::string, double> const &b) {
-                      return std::get<1>(a) < std::get<1>(b);
-                  });
-
         // Compute the actual earliest start time
-        double earliest_job_start_time = (*(earliest_start_times.begin() + num_hosts - 1)).second;
+        double earliest_job_start_time = compute_earliest_start_time(num_hosts, num_cores_per_host);
 
         // Update the core available times on each host used for the job
         for (unsigned int i = 0; i < num_hosts; i++) {
-          std::string hostname = (*(earliest_start_times.begin() + i)).first;
-          for (unsigned int j = 0; j < num_cores_per_host; j++) {
-            *(core_available_times[hostname].begin() + j) = earliest_job_start_time + duration;
-          }
-          std::sort(core_available_times[hostname].begin(), core_available_times[hostname].end());
+          set_core_available_times(host_ids[earliest_start_times[i].second], num_cores_per_host,
+                                   earliest_job_start_time + duration);
         }
 
         // Go through all hosts and make sure that no core is available before earliest_job_start_time
         // since this is a simple FCFS algorithm with no "jumping ahead" of any kind
-        for (auto h : this->nodes_to_cores_map) {
-          std::string hostname = h.first;
-          unsigned long num_cores = h.second;
-          for (unsigned int i = 0; i < num_cores; i++) {
-            if (*(core_available_times[hostname].begin() + i) < earliest_job_start_time) {
-              *(core_available_times[hostname].begin() + i) = earliest_job_start_time;
-            }
-          }
-          std::sort(core_available_times[hostname].begin(), core_available_times[hostname].end());
-        }
-
-        #if 0
-        std::cerr << "AFTER ACCOUNTING FOR THIS JOB: \n";
-        for (auto h : core_available_times) {
-          std::cerr << "  " << h.first << ":\n";
-          for (auto t : h.second) {
-            std::cerr << "     core : " << t << "\n";
+        // (raising the earliest available times of a host keeps them sorted)
+        for (auto &times : core_available_times) {
+          for (auto it = times.begin(); (it != times.end()) and (*it < earliest_job_start_time); it++) {
+            *it = earliest_job_start_time;
           }
         }
-        std::cerr << "----------------------------------------\n";
-        #endif
-
       }
 
       // We now have the predicted available times for each cores given
@@ -1973,37 +2063,17 @@ namespace wrench {
         std::string id = std::get<0>(job);
         unsigned int num_hosts = std::get<1>(job);
         unsigned int num_cores_per_host = std::get<2>(job);
-        double duration = std::get<3>(job);
 
         double earliest_job_start_time;
 
-        if ((num_hosts > core_available_times.size()) ||
+        if ((num_hosts > num_hosts_total) ||
             (num_cores_per_host > this->num_cores_per_node)) {
 
           earliest_job_start_time = -1.0;
 
         } else {
 
-          #if 0
-          std::cerr << "COMPUTING PREDICTIONS for JOB: num_hosts=" << num_hosts <<
-                    ", num_cores_per_hosts=" << num_cores_per_host << ", duration=" << duration << "\n";
-          #endif
-
-          // Compute the earliest start times on all hosts
-          std::vector<std::pair<std::string, double>> earliest_start_times;
-          for (auto h : core_available_times) {
-            double earliest_start_time = *(h.second.begin() + num_cores_per_host - 1);
-            earliest_start_times.emplace_back(std::make_pair(h.first, earliest_start_time));
-          }
-
-
-          // Sort the hosts by putative start times
-          std::sort(earliest_start_times.begin(), earliest_start_times.end(),
-                    [](std::pair<std::string, double> const &a, std::pair<std::string, double> const &b) {
-                        return std::get<1>(a) < std::get<1>(b);
-                    });
-
-          earliest_job_start_time = (*(earliest_start_times.begin() + num_hosts - 1)).second;
+          earliest_job_start_time = compute_earliest_start_time(num_hosts, num_cores_per_host);
         }
 
 
@@ -2019,6 +2089,37 @@ namespace wrench {
 
     }
 
+    /**
+     * @brief Returns start time estimates for the backfilling (non-batsched) algorithms, from the node
+     *        availability profile of the running jobs and of the reservations made by the last scheduling pass
+     *        (with EASY backfilling, only the first job that could not start has a reservation)
+     * @param set_of_jobs: a set of job specifications (<id, num hosts, num cores per host, time>)
+     *
+     * @return a map of start time predictions
+     */
+    std::map<std::string, double>
+    BatchService::getStartTimeEstimatesForBackfilling(
+            std::set<std::tuple<std::string, unsigned int, unsigned int, double>> set_of_jobs) {
+
+      double now = S4U_Simulation::getClock();
+      std::map<std::string, double> predictions;
+
+      for (auto job : set_of_jobs) {
+        std::string id = std::get<0>(job);
+        unsigned int num_hosts = std::get<1>(job);
+        unsigned int num_cores_per_host = std::get<2>(job);
+        double duration = std::get<3>(job);
+
+        double earliest_job_start_time = -1.0;
+        if ((num_hosts <= this->total_num_of_nodes) and (num_cores_per_host <= this->num_cores_per_node)) {
+          earliest_job_start_time = this->reservations_profile.getEarliestStartDate(now, duration, num_hosts);
+        }
+        predictions.insert(std::make_pair(id, earliest_job_start_time));
+      }
+
+      return predictions;
+    }
+
     /**
      * @brief Process a "terminate standard job message"
      *
@@ -2034,7 +2135,7 @@ namespace wrench {
       bool is_running = false;
       for (auto const & j : this->running_jobs) {
         WorkflowJob *workflow_job = j->getWorkflowJob();
-        if ((workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *)workflow_job == job)) {
+        if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *)workflow_job == job)) {
           batch_job = j;
           job_id = std::to_string(j->getJobID());
           is_running = true;
@@ -2047,7 +2148,7 @@ namespace wrench {
         // Is it pending?
         for (auto it1 = this->pending_jobs.begin(); it1 != this->pending_jobs.end(); it1++) {
           WorkflowJob *workflow_job = (*it1)->getWorkflowJob();
-          if ((workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *)workflow_job == job)) {
+          if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *)workflow_job == job)) {
             batch_pending_it = it1;
             job_id = std::to_string((*it1)->getJobID());
             is_pending = true;
@@ -2060,7 +2161,7 @@ namespace wrench {
         // Is it waiting?
         for (auto const & j : this->waiting_jobs) {
           WorkflowJob *workflow_job = j->getWorkflowJob();
-          if ((workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *)workflow_job == job)) {
+          if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *)workflow_job == job)) {
             batch_job = j;
             job_id = std::to_string(j->getJobID());
             is_waiting = true;
@@ -2092,7 +2193,7 @@ namespace wrench {
       // Is it running?
       if (is_running) {
         terminateRunningStandardJob(job);
-        this->running_jobs.erase(batch_job);
+        this->removeJobFromRunningList(batch_job);
         this->freeJobFromJobsList(batch_job);
       }
       if (is_pending) {
@@ -2468,7 +2569,7 @@ namespace wrench {
           break;
         }
       }
-      if (workflow_job == nullptr) {
+      if (batch_job == nullptr) {
         throw std::runtime_error(
                 "BatchService::processExecuteJobFromBatSched(): Job received from batsched that does not belong to the list of jobs batchservice has"
         );
@@ -2509,7 +2610,7 @@ namespace wrench {
       std::map<std::string, unsigned long>::iterator it;
 
       for (auto node:node_resources) {
-        this->available_nodes_to_cores[this->host_id_to_names[node]] -= cores_per_node_asked_for;
+        this->available_cores_index.allocateCores(node, cores_per_node_asked_for);
         resources.insert(std::make_tuple(this->host_id_to_names[node], cores_per_node_asked_for,
                                          0)); // TODO: Is setting RAM to 0 ok here?
       }
@@ -14,11 +14,12 @@ namespace wrench {
     /**
      * @brief Constructor
      *
+     * @param type: the message type
      * @param name: the message name
      * @param payload: the message size in bytes
      */
-    BatchServiceMessage::BatchServiceMessage(std::string name, double payload) :
-            ComputeServiceMessage("BatchServiceMessage::" + name, payload) {
+    BatchServiceMessage::BatchServiceMessage(SimulationMessage::Type type, std::string name, double payload) :
+            ComputeServiceMessage(type, "BatchServiceMessage::" + name, payload) {
     }
 
     #if 0
@@ -33,7 +34,7 @@ namespace wrench {
     BatchSimulationBeginsToSchedulerMessage::BatchSimulationBeginsToSchedulerMessage(std::string answer_mailbox,
                                                                                      std::string job_args_to_scheduler,
                                                                                      double payload)
-            : BatchServiceMessage("BATCH_SIMULATION_BEGINS", payload) {
+            : BatchServiceMessage(SimulationMessage::BATCH_SIMULATION_BEGINS_TO_SCHEDULER, "BATCH_SIMULATION_BEGINS", payload) {
       if (job_args_to_scheduler.empty()) {
         throw std::invalid_argument(
                 "BatchSimulationBeginsToSchedulerMessage::BatchSimulationBeginsToSchedulerMessage(): Empty job arguments to scheduler");
@@ -56,7 +57,7 @@ namespace wrench {
      * @throw std::invalid_argument
      */
     BatchSchedReadyMessage::BatchSchedReadyMessage(std::string answer_mailbox, double payload)
-            : BatchServiceMessage("BATCH_SCHED_READY", payload) {
+            : BatchServiceMessage(SimulationMessage::BATCH_SCHED_READY, "BATCH_SCHED_READY", payload) {
       if (answer_mailbox.empty()) {
         throw std::invalid_argument(
                 "BatchSchedReadyMessage::BatchSchedReadyMessage(): Empty answer mailbox");
@@ -76,7 +77,7 @@ namespace wrench {
     BatchExecuteJobFromBatSchedMessage::BatchExecuteJobFromBatSchedMessage(std::string answer_mailbox,
                                                                            std::string batsched_decision_reply,
                                                                            double payload)
-            : BatchServiceMessage("BATCH_EXECUTE_JOB", payload) {
+            : BatchServiceMessage(SimulationMessage::BATCH_EXECUTE_JOB_FROM_BAT_SCHED, "BATCH_EXECUTE_JOB", payload) {
       if (answer_mailbox.empty()) {
         throw std::invalid_argument(
                 "BatchExecuteJobFromBatSchedMessage::BatchExecuteJobFromBatSchedMessage(): Empty answer mailbox");
@@ -97,7 +98,7 @@ namespace wrench {
      * @throw std::invalid_argument
      */
     BatchQueryAnswerMessage::BatchQueryAnswerMessage(double estimated_job_start_time, double payload)
-            : BatchServiceMessage("BATCH_QUERY_ANSWER", payload) {
+            : BatchServiceMessage(SimulationMessage::BATCH_QUERY_ANSWER, "BATCH_QUERY_ANSWER", payload) {
       this->estimated_start_time = estimated_job_start_time;
     }
 
@@ -115,7 +116,7 @@ namespace wrench {
                                                                                WorkflowJob *job,
                                                                                std::string job_args_to_scheduler,
                                                                                double payload)
-            : BatchServiceMessage("BATCH_JOB_SUBMISSION_TO_SCHEDULER", payload) {
+            : BatchServiceMessage(SimulationMessage::BATCH_JOB_SUBMISSION_TO_SCHEDULER, "BATCH_JOB_SUBMISSION_TO_SCHEDULER", payload) {
       if (job_args_to_scheduler.empty()) {
         throw std::invalid_argument(
                 "BatchJobSubmissionToSchedulerMessage::BatchJobSubmissionToSchedulerMessage(): Empty job arguments to scheduler");
@@ -142,7 +143,7 @@ namespace wrench {
      * @throw std::invalid_argument
      */
     BatchJobReplyFromSchedulerMessage::BatchJobReplyFromSchedulerMessage(std::string reply, double payload)
-            : BatchServiceMessage("BATCH_JOB_REPLY_FROM_SCHEDULER", payload), reply(reply) {}
+            : BatchServiceMessage(SimulationMessage::BATCH_JOB_REPLY_FROM_SCHEDULER, "BATCH_JOB_REPLY_FROM_SCHEDULER", payload), reply(reply) {}
 
 #endif
 
@@ -156,7 +157,7 @@ namespace wrench {
      */
     BatchServiceJobRequestMessage::BatchServiceJobRequestMessage(std::string answer_mailbox,
                                                                  BatchJob *job, double payload)
-            : BatchServiceMessage("SUBMIT_BATCH_JOB_REQUEST", payload) {
+            : BatchServiceMessage(SimulationMessage::BATCH_SERVICE_JOB_REQUEST, "SUBMIT_BATCH_JOB_REQUEST", payload) {
       if (job == nullptr) {
         throw std::invalid_argument(
                 "BatchServiceJobRequestMessage::BatchServiceJobRequestMessage(): Invalid arguments");
@@ -169,6 +170,24 @@ namespace wrench {
       this->answer_mailbox = answer_mailbox;
     }
 
+    /**
+     * @brief Constructor
+     * @param job: the (background) batch job
+     * @param payload: the message size in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    BatchServiceBackgroundJobSubmissionMessage::BatchServiceBackgroundJobSubmissionMessage(BatchJob *job,
+                                                                                           double payload)
+            : BatchServiceMessage(SimulationMessage::BATCH_SERVICE_BACKGROUND_JOB_SUBMISSION,
+                                  "SUBMIT_BACKGROUND_JOB", payload) {
+      if ((job == nullptr) or (not job->isBackgroundJob())) {
+        throw std::invalid_argument(
+                "BatchServiceBackgroundJobSubmissionMessage::BatchServiceBackgroundJobSubmissionMessage(): Invalid arguments");
+      }
+      this->job = job;
+    }
+
     /**
      * @brief Constructor
      * @param job: a batch job
@@ -177,7 +196,7 @@ namespace wrench {
      * @throw std::invalid_arguments
      */
     AlarmJobTimeOutMessage::AlarmJobTimeOutMessage(BatchJob *job, double payload)
-            : ServiceMessage("ALARM_JOB_TIMED_OUT", payload) {
+            : ServiceMessage(SimulationMessage::ALARM_JOB_TIME_OUT, "ALARM_JOB_TIMED_OUT", payload) {
       if (job == nullptr) {
         throw std::invalid_argument(
                 "AlarmJobTimeOutMessage::AlarmJobTimeOutMessage: Invalid argument");
@@ -194,7 +213,7 @@ namespace wrench {
      * @throw std::invalid_arguments
      */
     AlarmNotifyBatschedMessage::AlarmNotifyBatschedMessage(std::string job_id, double payload)
-            : ServiceMessage("ALARM_NOTIFY_BATSCHED", payload), job_id(job_id) {}
+            : ServiceMessage(SimulationMessage::ALARM_NOTIFY_BATSCHED, "ALARM_NOTIFY_BATSCHED", payload), job_id(job_id) {}
     #endif
 
 }
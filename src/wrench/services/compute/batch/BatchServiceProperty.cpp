@@ -11,6 +11,7 @@
 
 namespace wrench {
     SET_PROPERTY_NAME(BatchServiceProperty, THREAD_STARTUP_OVERHEAD);
+    SET_PROPERTY_NAME(BatchServiceProperty, SIMULATE_COMPUTE_THREADS);
     SET_PROPERTY_NAME(BatchServiceProperty, HOST_SELECTION_ALGORITHM);
 
     SET_PROPERTY_NAME(BatchServiceProperty, BATCH_SCHEDULING_ALGORITHM);
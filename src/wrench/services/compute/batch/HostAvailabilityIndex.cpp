@@ -0,0 +1,325 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+#include "wrench/services/compute/batch/HostAvailabilityIndex.h"
+
+namespace wrench {
+
+    /**
+     * @brief Append to a vector, in increasing order, the smallest values that are no smaller
+     *        than a lower bound in a range of sets (a k-way merge of the sets)
+     *
+     * @param sets: the sets
+     * @param first_set: the index of the first set of the range (the range ends with the last set)
+     * @param lower_bound: the lower bound
+     * @param num_values: the number of values to append (at most)
+     * @param values: the vector to which the values are appended
+     */
+    static void appendSmallestValues(const std::vector<std::set<unsigned long>> &sets,
+                                     unsigned long first_set,
+                                     unsigned long lower_bound,
+                                     unsigned long num_values,
+                                     std::vector<unsigned long> &values) {
+
+      typedef std::pair<unsigned long, unsigned long> HeapEntry; // (value, set index)
+      std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+      std::vector<std::set<unsigned long>::const_iterator> cursors(sets.size());
+
+      for (unsigned long i = first_set; i < sets.size(); i++) {
+        cursors[i] = sets[i].lower_bound(lower_bound);
+        if (cursors[i] != sets[i].end()) {
+          heap.push(std::make_pair(*cursors[i], i));
+        }
+      }
+
+      while ((num_values > 0) and (not heap.empty())) {
+        unsigned long i = heap.top().second;
+        values.push_back(heap.top().first);
+        heap.pop();
+        num_values--;
+        if (++cursors[i] != sets[i].end()) {
+          heap.push(std::make_pair(*cursors[i], i));
+        }
+      }
+    }
+
+    /**
+     * @brief Constructor (for an empty set of hosts)
+     */
+    HostAvailabilityIndex::HostAvailabilityIndex() : num_cores_per_host(0), num_idle_hosts(0) {
+    }
+
+    /**
+     * @brief Constructor (all cores of all hosts are initially available)
+     *
+     * @param hostnames: the names of the hosts, whose positions in the vector are their IDs
+     * @param num_cores_per_host: the number of cores of each host
+     *
+     * @throw std::invalid_argument
+     */
+    HostAvailabilityIndex::HostAvailabilityIndex(const std::vector<std::string> &hostnames,
+                                                 unsigned long num_cores_per_host) :
+            num_cores_per_host(num_cores_per_host), hostnames(hostnames),
+            hostname_ranks(hostnames.size()),
+            available_cores(hostnames.size(), num_cores_per_host),
+            ranks_by_cores(num_cores_per_host + 1), ids_by_cores(num_cores_per_host + 1),
+            idle_hosts(hostnames.size(), true), num_idle_hosts(hostnames.size()) {
+
+      for (unsigned long id = 0; id < hostnames.size(); id++) {
+        if (not this->host_ids.insert(std::make_pair(hostnames[id], id)).second) {
+          throw std::invalid_argument("HostAvailabilityIndex::HostAvailabilityIndex(): Duplicate host " + hostnames[id]);
+        }
+        this->ids_in_hostname_order.push_back(id);
+      }
+
+      std::sort(this->ids_in_hostname_order.begin(), this->ids_in_hostname_order.end(),
+                [&hostnames](unsigned long a, unsigned long b) { return hostnames[a] < hostnames[b]; });
+
+      for (unsigned long rank = 0; rank < this->ids_in_hostname_order.size(); rank++) {
+        this->hostname_ranks[this->ids_in_hostname_order[rank]] = rank;
+        this->ranks_by_cores[num_cores_per_host].insert(this->ranks_by_cores[num_cores_per_host].end(), rank);
+      }
+      for (unsigned long id = 0; id < hostnames.size(); id++) {
+        this->ids_by_cores[num_cores_per_host].insert(this->ids_by_cores[num_cores_per_host].end(), id);
+      }
+    }
+
+    /**
+     * @brief Get the number of hosts
+     * @return a number of hosts
+     */
+    unsigned long HostAvailabilityIndex::getNumHosts() const {
+      return this->hostnames.size();
+    }
+
+    /**
+     * @brief Get the number of cores of each host
+     * @return a number of cores
+     */
+    unsigned long HostAvailabilityIndex::getNumCoresPerHost() const {
+      return this->num_cores_per_host;
+    }
+
+    /**
+     * @brief Get the ID of a host
+     *
+     * @param hostname: the host's name
+     * @return a host ID
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned long HostAvailabilityIndex::getHostID(const std::string &hostname) const {
+      auto it = this->host_ids.find(hostname);
+      if (it == this->host_ids.end()) {
+        throw std::invalid_argument("HostAvailabilityIndex::getHostID(): Unknown host " + hostname);
+      }
+      return it->second;
+    }
+
+    /**
+     * @brief Get the name of a host
+     *
+     * @param host_id: the host's ID
+     * @return a hostname
+     */
+    const std::string &HostAvailabilityIndex::getHostname(unsigned long host_id) const {
+      return this->hostnames[host_id];
+    }
+
+    /**
+     * @brief Get the host IDs, sorted by hostname
+     * @return a vector of host IDs
+     */
+    const std::vector<unsigned long> &HostAvailabilityIndex::getHostIDsInHostnameOrder() const {
+      return this->ids_in_hostname_order;
+    }
+
+    /**
+     * @brief Get the number of available cores of a host
+     *
+     * @param host_id: the host's ID
+     * @return a number of cores
+     */
+    unsigned long HostAvailabilityIndex::getNumAvailableCores(unsigned long host_id) const {
+      return this->available_cores[host_id];
+    }
+
+    /**
+     * @brief Determine whether all cores of a host are available
+     *
+     * @param host_id: the host's ID
+     * @return true if the host is idle, false otherwise
+     */
+    bool HostAvailabilityIndex::isIdle(unsigned long host_id) const {
+      return this->idle_hosts[host_id];
+    }
+
+    /**
+     * @brief Get the number of hosts whose cores are all available
+     * @return a number of hosts
+     */
+    unsigned long HostAvailabilityIndex::getNumIdleHosts() const {
+      return this->num_idle_hosts;
+    }
+
+    /**
+     * @brief Mark cores of a host as allocated
+     *
+     * @param host_id: the host's ID
+     * @param num_cores: the number of cores
+     *
+     * @throw std::invalid_argument
+     */
+    void HostAvailabilityIndex::allocateCores(unsigned long host_id, unsigned long num_cores) {
+      if (num_cores > this->available_cores[host_id]) {
+        throw std::invalid_argument("HostAvailabilityIndex::allocateCores(): Not enough available cores on host " +
+                                    this->hostnames[host_id]);
+      }
+      this->setNumAvailableCores(host_id, this->available_cores[host_id] - num_cores);
+    }
+
+    /**
+     * @brief Mark cores of a host as available
+     *
+     * @param host_id: the host's ID
+     * @param num_cores: the number of cores
+     *
+     * @throw std::invalid_argument
+     */
+    void HostAvailabilityIndex::releaseCores(unsigned long host_id, unsigned long num_cores) {
+      if (this->available_cores[host_id] + num_cores > this->num_cores_per_host) {
+        throw std::invalid_argument("HostAvailabilityIndex::releaseCores(): Too many cores released on host " +
+                                    this->hostnames[host_id]);
+      }
+      this->setNumAvailableCores(host_id, this->available_cores[host_id] + num_cores);
+    }
+
+    /**
+     * @brief Select the first hosts, in hostname order, that have enough available cores
+     *        (no cores are allocated)
+     *
+     * @param num_hosts: the number of hosts to select
+     * @param num_cores: the number of cores needed on each host
+     *
+     * @return the IDs of the selected hosts, in hostname order (empty if there are not enough suitable hosts)
+     */
+    std::vector<unsigned long>
+    HostAvailabilityIndex::selectFirstFit(unsigned long num_hosts, unsigned long num_cores) const {
+      std::vector<unsigned long> selected;
+      if ((num_cores > this->num_cores_per_host) or (this->getNumHostsWithAtLeast(num_cores) < num_hosts)) {
+        return selected;
+      }
+
+      appendSmallestValues(this->ranks_by_cores, num_cores, 0, num_hosts, selected);
+      for (auto &h : selected) {
+        h = this->ids_in_hostname_order[h];
+      }
+      return selected;
+    }
+
+    /**
+     * @brief Select the hosts that have enough available cores and would have the fewest
+     *        cores left, ties being broken by hostname (no cores are allocated)
+     *
+     * @param num_hosts: the number of hosts to select
+     * @param num_cores: the number of cores needed on each host
+     *
+     * @return the IDs of the selected hosts, from the best fit to the worst (empty if there are not enough suitable hosts)
+     */
+    std::vector<unsigned long>
+    HostAvailabilityIndex::selectBestFit(unsigned long num_hosts, unsigned long num_cores) const {
+      std::vector<unsigned long> selected;
+      if ((num_cores > this->num_cores_per_host) or (this->getNumHostsWithAtLeast(num_cores) < num_hosts)) {
+        return selected;
+      }
+
+      for (unsigned long c = num_cores; selected.size() < num_hosts; c++) {
+        for (auto rank : this->ranks_by_cores[c]) {
+          selected.push_back(this->ids_in_hostname_order[rank]);
+          if (selected.size() == num_hosts) {
+            break;
+          }
+        }
+      }
+      return selected;
+    }
+
+    /**
+     * @brief Select the first hosts that have enough available cores, in host ID order,
+     *        starting after a given host and wrapping around (no cores are allocated)
+     *
+     * @param num_hosts: the number of hosts to select
+     * @param num_cores: the number of cores needed on each host
+     * @param last_host_id: the ID of the host after which to start (e.g., the last host selected previously)
+     *
+     * @return the IDs of the selected hosts, in selection order (empty if there are not enough suitable hosts)
+     */
+    std::vector<unsigned long>
+    HostAvailabilityIndex::selectRoundRobin(unsigned long num_hosts, unsigned long num_cores,
+                                            unsigned long last_host_id) const {
+      std::vector<unsigned long> selected;
+      if ((num_cores > this->num_cores_per_host) or (this->getNumHostsWithAtLeast(num_cores) < num_hosts)) {
+        return selected;
+      }
+
+      // Hosts after the last one, then (since there are enough suitable hosts) hosts up to the last one
+      appendSmallestValues(this->ids_by_cores, num_cores, last_host_id + 1, num_hosts, selected);
+      appendSmallestValues(this->ids_by_cores, num_cores, 0, num_hosts - selected.size(), selected);
+      return selected;
+    }
+
+    /**
+     * @brief Get the number of hosts that have at least some number of available cores
+     *
+     * @param num_cores: the number of cores
+     * @return a number of hosts
+     */
+    unsigned long HostAvailabilityIndex::getNumHostsWithAtLeast(unsigned long num_cores) const {
+      unsigned long count = 0;
+      for (unsigned long c = num_cores; c <= this->num_cores_per_host; c++) {
+        count += this->ids_by_cores[c].size();
+      }
+      return count;
+    }
+
+    /**
+     * @brief Update the number of available cores of a host, and move it to the right bucket
+     *
+     * @param host_id: the host's ID
+     * @param num_cores: the new number of available cores
+     */
+    void HostAvailabilityIndex::setNumAvailableCores(unsigned long host_id, unsigned long num_cores) {
+      unsigned long old_num_cores = this->available_cores[host_id];
+      if (num_cores == old_num_cores) {
+        return;
+      }
+
+      this->ranks_by_cores[old_num_cores].erase(this->hostname_ranks[host_id]);
+      this->ids_by_cores[old_num_cores].erase(host_id);
+      this->ranks_by_cores[num_cores].insert(this->hostname_ranks[host_id]);
+      this->ids_by_cores[num_cores].insert(host_id);
+      this->available_cores[host_id] = num_cores;
+
+      bool idle = (num_cores == this->num_cores_per_host);
+      if (idle != this->idle_hosts[host_id]) {
+        this->idle_hosts[host_id] = idle;
+        if (idle) {
+          this->num_idle_hosts++;
+        } else {
+          this->num_idle_hosts--;
+        }
+      }
+    }
+
+};
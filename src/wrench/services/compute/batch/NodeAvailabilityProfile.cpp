@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <iterator>
+#include <limits>
+
+#include "wrench/services/compute/batch/NodeAvailabilityProfile.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor (all nodes are available at all times)
+     *
+     * @param num_nodes: the number of nodes
+     */
+    NodeAvailabilityProfile::NodeAvailabilityProfile(unsigned long num_nodes) : num_nodes(num_nodes) {
+      // The first step starts at the lowest possible date, so that every date is in a step
+      this->steps.insert(std::make_pair(std::numeric_limits<double>::lowest(), (long) num_nodes));
+    }
+
+    /**
+     * @brief Account for nodes being used during a time interval
+     *
+     * @param start_date: the start of the interval
+     * @param end_date: the end of the interval (excluded)
+     * @param num_nodes: the number of nodes
+     */
+    void NodeAvailabilityProfile::allocate(double start_date, double end_date, unsigned long num_nodes) {
+      this->add(start_date, end_date, -((long) num_nodes));
+    }
+
+    /**
+     * @brief Account for nodes no longer being used during a time interval
+     *        (that of a previous call to allocate())
+     *
+     * @param start_date: the start of the interval
+     * @param end_date: the end of the interval (excluded)
+     * @param num_nodes: the number of nodes
+     */
+    void NodeAvailabilityProfile::release(double start_date, double end_date, unsigned long num_nodes) {
+      this->add(start_date, end_date, (long) num_nodes);
+    }
+
+    /**
+     * @brief Get the number of available nodes at a date
+     *
+     * @param date: the date
+     * @return a number of nodes (negative if more nodes are allocated than there are, which can
+     *         happen when jobs share nodes)
+     */
+    long NodeAvailabilityProfile::getNumAvailableNodes(double date) const {
+      return std::prev(this->steps.upper_bound(date))->second;
+    }
+
+    /**
+     * @brief Get the earliest date, no earlier than a given date, from which some number of nodes
+     *        are available for some duration
+     *
+     * @param date: the date
+     * @param duration: the duration
+     * @param num_nodes: the number of nodes
+     *
+     * @return a date, or -1.0 if there are not enough nodes
+     */
+    double NodeAvailabilityProfile::getEarliestStartDate(double date, double duration, unsigned long num_nodes) const {
+      if (num_nodes > this->num_nodes) {
+        return -1.0;
+      }
+
+      double start_date = date;
+      auto it = std::prev(this->steps.upper_bound(date));
+      while (true) {
+        auto next = std::next(it);
+        if (it->second < (long) num_nodes) {
+          // Not enough nodes in this step: the job cannot start before the next one
+          if (next == this->steps.end()) {
+            return -1.0;
+          }
+          start_date = next->first;
+        } else if ((next == this->steps.end()) or (next->first >= start_date + duration)) {
+          return start_date;
+        }
+        it = next;
+      }
+    }
+
+    /**
+     * @brief Get the number of steps of the profile
+     * @return a number of steps
+     */
+    unsigned long NodeAvailabilityProfile::getNumSteps() const {
+      return this->steps.size();
+    }
+
+    /**
+     * @brief Add a number of nodes to the available nodes during a time interval
+     *
+     * @param start_date: the start of the interval
+     * @param end_date: the end of the interval (excluded)
+     * @param num_nodes: the number of nodes (negative to remove nodes)
+     */
+    void NodeAvailabilityProfile::add(double start_date, double end_date, long num_nodes) {
+      if ((end_date <= start_date) or (num_nodes == 0)) {
+        return;
+      }
+
+      auto first = this->split(start_date);
+      auto last = this->split(end_date);
+      for (auto it = first; it != last; it++) {
+        it->second += num_nodes;
+      }
+
+      // Merge steps that no longer differ from their predecessors
+      if (std::prev(last)->second == last->second) {
+        this->steps.erase(last);
+      }
+      if ((first != this->steps.begin()) and (std::prev(first)->second == first->second)) {
+        this->steps.erase(first);
+      }
+    }
+
+    /**
+     * @brief Make sure that a step starts at a date
+     *
+     * @param date: the date
+     * @return the step that starts at the date
+     */
+    std::map<double, long>::iterator NodeAvailabilityProfile::split(double date) {
+      auto next = this->steps.upper_bound(date);
+      auto it = std::prev(next);
+      if (it->first == date) {
+        return it;
+      }
+      return this->steps.insert(next, std::make_pair(date, it->second));
+    }
+
+};
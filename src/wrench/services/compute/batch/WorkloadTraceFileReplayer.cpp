@@ -9,10 +9,12 @@
 
 
 #include <wrench/simgrid_S4U_util/S4U_Simulation.h>
+#include <wrench/simgrid_S4U_util/S4U_Mailbox.h>
 #include <wrench/services/compute/batch/BatchService.h>
+#include <wrench/services/compute/batch/BatchServiceMessage.h>
 #include <wrench-dev.h>
+#include <wrench/util/MessageManager.h>
 #include "WorkloadTraceFileReplayer.h"
-#include "OneJobWMS.h"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(workload_trace_file_replayer, "Log category for Trace File Replayer");
 
@@ -37,11 +39,15 @@ namespace wrench {
             batch_service(batch_service),
             num_cores_per_node(num_cores_per_node) {}
 
+    /**
+     * @brief main method of the trace file replayer daemon: at each job's submission time, a
+     *        background job is created and sent to the batch service, which queues, schedules and
+     *        completes it on its own (the job simply holds its nodes for its run time)
+     * @return 0 on success
+     */
     int WorkloadTraceFileReplayer::main() {
 
-      double core_flop_rate = *(this->batch_service->getCoreFlopRate().begin());
-
-      for (auto job : this->workload_trace) {
+      for (auto const &job : this->workload_trace) {
         // Sleep until the submission time
         double sub_time = std::get<1>(job);
         double curtime = S4U_Simulation::getClock();
@@ -50,24 +56,32 @@ namespace wrench {
           wrench::S4U_Simulation::sleep(sleeptime);
 
         // Get job information
-        std::string job_id = std::get<0>(job);
         double time = std::get<2>(job);
         double requested_time = std::get<3>(job);
-        double requested_ram = std::get<4>(job);
-        int num_nodes = std::get<5>(job);
-
-        // Create the OneJobWMS
-        std::shared_ptr<OneJobWMS> one_job_wms = std::shared_ptr<OneJobWMS>(
-                new OneJobWMS(this->hostname, job_id, time, requested_time, requested_ram, num_nodes,
-                              this->num_cores_per_node,
-                              this->batch_service,
-                core_flop_rate));
+        unsigned int num_nodes = std::get<5>(job);
+        if (num_nodes == 0) {
+          WRENCH_INFO("Ignoring job %s, which asks for no node", std::get<0>(job).c_str());
+          continue;
+        }
 
-        // Start the OneJobWMS
-        one_job_wms->simulation = this->simulation;
-        one_job_wms->start(one_job_wms, true); // Daemonize!
-        // will not get out of scope, but it's ok because of the cool life-saver!
+        // Create the background job (note the +1 minute on the requested time), which
+        // the batch service owns only once it has received it. The job's requested RAM is
+        // ignored, since the batch service allocates all the RAM of a job's nodes
+        std::unique_ptr<BatchJob> batch_job(new BatchJob(this->batch_service->generateUniqueJobID(), time,
+                                                         1 + (unsigned long) (requested_time / 60), num_nodes,
+                                                         this->num_cores_per_node, S4U_Simulation::getClock()));
 
+        // Add it to the batch service's queue
+        auto message = new BatchServiceBackgroundJobSubmissionMessage(batch_job.get(), 0);
+        try {
+          S4U_Mailbox::putMessage(this->batch_service->mailbox, message);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          // The batch service is likely gone, and never got the message
+          MessageManager::removeReceivedMessages(this->batch_service->mailbox_name, message);
+          delete message;
+          return 0;
+        }
+        batch_job.release();
       }
 
       return 0;
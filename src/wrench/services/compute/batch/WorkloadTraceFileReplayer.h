@@ -23,7 +23,8 @@ namespace wrench {
 
     /**
      * @brief A service that goes through a job submission trace (as loaded
-     * by a TraceFileLoader), and "replays" it on a given BatchService.
+     * by a TraceFileLoader), and "replays" it on a given BatchService by injecting
+     * each job, as a background job, in the batch service's queue at its submission time.
      */
     class WorkloadTraceFileReplayer : public Service {
 
@@ -41,13 +41,13 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       //  send a "run a standard job" message to the daemon's mailbox_name
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new ComputeServiceSubmitStandardJobRequestMessage(
-                                        answer_mailbox, job, service_specific_args,
+                                        answer_mailbox.getName(), job, service_specific_args,
                                         this->getMessagePayloadValueAsDouble(
                                                 ComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -57,10 +57,11 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -98,14 +99,14 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       // Send a "run a pilot job" message to the daemon's mailbox_name
       try {
         S4U_Mailbox::putMessage(
-                this->mailbox_name,
+                this->mailbox,
                 new ComputeServiceSubmitPilotJobRequestMessage(
-                        answer_mailbox, job, this->getMessagePayloadValueAsDouble(
+                        answer_mailbox.getName(), job, this->getMessagePayloadValueAsDouble(
                                 MultihostMulticoreComputeServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
@@ -115,10 +116,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -654,6 +656,8 @@ namespace wrench {
               this->containing_pilot_job,
               {{StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD,   this->getPropertyValueAsString(
                       MultihostMulticoreComputeServiceProperty::THREAD_STARTUP_OVERHEAD)},
+               {StandardJobExecutorProperty::SIMULATE_COMPUTE_THREADS,  this->getPropertyValueAsString(
+                       MultihostMulticoreComputeServiceProperty::SIMULATE_COMPUTE_THREADS)},
                {StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM, this->getPropertyValueAsString(
                        MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_CORE_ALLOCATION_ALGORITHM)},
                {StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM,  this->getPropertyValueAsString(
@@ -780,7 +784,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message;
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name);
+        message = S4U_Mailbox::getMessage(this->mailbox);
       } catch (std::shared_ptr<NetworkError> &cause) {
         WRENCH_INFO("Got a network error while getting some message... ignoring");
         return true;
@@ -793,68 +797,89 @@ namespace wrench {
 
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-      if (auto msg = dynamic_cast<ServiceTTLExpiredMessage *>(message.get())) {
-        WRENCH_INFO("My TTL has expired, terminating and perhaps notify a pilot job submitted");
-        if (this->containing_pilot_job != nullptr) {
-          /*** Clean up everything in the scratch space ***/
-          cleanUpScratch();
-        }
+      switch (message->type) {
+        case SimulationMessage::SERVICE_TTL_EXPIRED: {
+          WRENCH_INFO("My TTL has expired, terminating and perhaps notify a pilot job submitted");
+          if (this->containing_pilot_job != nullptr) {
+            /*** Clean up everything in the scratch space ***/
+            cleanUpScratch();
+          }
 
-        this->terminate(true);
+          this->terminate(true);
 
-        return false;
-
-      } else if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-        if (this->containing_pilot_job != nullptr) {
-          /*** Clean up everything in the scratch space ***/
-          cleanUpScratch();
+          return false;
         }
-        this->terminate(false);
 
-        // This is Synchronous
-        try {
-          S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                  new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
-                                          MultihostMulticoreComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+          if (this->containing_pilot_job != nullptr) {
+            /*** Clean up everything in the scratch space ***/
+            cleanUpScratch();
+          }
+          this->terminate(false);
+
+          // This is Synchronous
+          try {
+            S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                    new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
+                                            MultihostMulticoreComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
+          }
           return false;
         }
-        return false;
 
-      } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-        processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_SUBMIT_STANDARD_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get());
+          processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-        processSubmitPilotJob(msg->answer_mailbox, msg->job);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_SUBMIT_PILOT_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get());
+          processSubmitPilotJob(msg->answer_mailbox, msg->job);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
-        processPilotJobCompletion(msg->job);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_EXPIRED: {
+          auto msg = static_cast<ComputeServicePilotJobExpiredMessage *>(message.get());
+          processPilotJobCompletion(msg->job);
+          return true;
+        }
 
-      } else if (auto *msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-        processGetResourceInformation(msg->answer_mailbox);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_RESOURCE_INFORMATION_REQUEST: {
+          auto msg = static_cast<ComputeServiceResourceInformationRequestMessage *>(message.get());
+          processGetResourceInformation(msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto *msg = dynamic_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get())) {
-        processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_TERMINATE_STANDARD_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get());
+          processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto *msg = dynamic_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get())) {
-        processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_TERMINATE_PILOT_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get());
+          processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<StandardJobExecutorDoneMessage *>(message.get())) {
-        processStandardJobCompletion(msg->executor, msg->job);
-        return true;
+        case SimulationMessage::STANDARD_JOB_EXECUTOR_DONE: {
+          auto msg = static_cast<StandardJobExecutorDoneMessage *>(message.get());
+          processStandardJobCompletion(msg->executor, msg->job);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<StandardJobExecutorFailedMessage *>(message.get())) {
-        processStandardJobFailure(msg->executor, msg->job, msg->cause);
-        return true;
+        case SimulationMessage::STANDARD_JOB_EXECUTOR_FAILED: {
+          auto msg = static_cast<StandardJobExecutorFailedMessage *>(message.get());
+          processStandardJobFailure(msg->executor, msg->job, msg->cause);
+          return true;
+        }
 
-      } else {
-        throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        default: {
+          throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        }
       }
     }
 
@@ -1217,13 +1242,13 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_standard_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       //  send a "terminate a standard job" message to the daemon's mailbox_name
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new ComputeServiceTerminateStandardJobRequestMessage(
-                                        answer_mailbox, job, this->getMessagePayloadValueAsDouble(
+                                        answer_mailbox.getName(), job, this->getMessagePayloadValueAsDouble(
                                                 MultihostMulticoreComputeServiceMessagePayload::TERMINATE_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
@@ -1232,10 +1257,11 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceTerminateStandardJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -1263,13 +1289,13 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_pilot_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       // Send a "terminate a pilot job" message to the daemon's mailbox_name
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new ComputeServiceTerminatePilotJobRequestMessage(
-                                        answer_mailbox, job, this->getMessagePayloadValueAsDouble(
+                                        answer_mailbox.getName(), job, this->getMessagePayloadValueAsDouble(
                                                 MultihostMulticoreComputeServiceMessagePayload::TERMINATE_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
@@ -1279,10 +1305,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceTerminatePilotJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -1637,9 +1664,10 @@ namespace wrench {
                                       files_in_scratch_by_single_workunit.end());
       }
 
-      for (auto scratch_cleanup_file : this->files_in_scratch) {
+      // All the files are in the pilot job's partition
+      if (not this->files_in_scratch.empty()) {
         try {
-          getScratch()->deleteFile(scratch_cleanup_file, this->containing_pilot_job, nullptr);
+          getScratch()->deletePartition(this->containing_pilot_job);
         } catch (WorkflowExecutionException &e) {
           throw;
         }
@@ -1669,6 +1697,14 @@ namespace wrench {
                         this->getPropertyValueAsString(MultihostMulticoreComputeServiceProperty::THREAD_STARTUP_OVERHEAD));
       }
 
+      // Compute thread simulation
+      try {
+        this->getPropertyValueAsBoolean(MultihostMulticoreComputeServiceProperty::SIMULATE_COMPUTE_THREADS);
+      } catch (std::invalid_argument &e) {
+        throw std::invalid_argument("Invalid SIMULATE_COMPUTE_THREADS property specification: " +
+                                    this->getPropertyValueAsString(MultihostMulticoreComputeServiceProperty::SIMULATE_COMPUTE_THREADS));
+      }
+
       // Job selection policy
       if (this->getPropertyValueAsString(MultihostMulticoreComputeServiceProperty::JOB_SELECTION_POLICY) != "FCFS") {
         throw std::invalid_argument("Invalid JOB_SELECTION_POLICY property specification: " +
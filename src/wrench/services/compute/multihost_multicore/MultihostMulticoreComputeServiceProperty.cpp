@@ -13,6 +13,7 @@ namespace wrench {
 
 
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, THREAD_STARTUP_OVERHEAD);
+    SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, SIMULATE_COMPUTE_THREADS);
 
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, JOB_SELECTION_POLICY);
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, RESOURCE_ALLOCATION_POLICY);
@@ -499,7 +499,9 @@ namespace wrench {
                                               this->scratch_space,
                                               workflow_job,
                                               this->getPropertyValueAsDouble(
-                                                      StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD)));
+                                                      StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD),
+                                              this->getPropertyValueAsBoolean(
+                                                      StandardJobExecutorProperty::SIMULATE_COMPUTE_THREADS)));
 
         workunit_executor->simulation = this->simulation;
         workunit_executor->start(workunit_executor, true);
@@ -544,7 +546,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message;
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name);
+        message = S4U_Mailbox::getMessage(this->mailbox);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       } catch (std::shared_ptr<FatalFailure> &cause) {
@@ -559,16 +561,22 @@ namespace wrench {
 
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-      if (WorkunitExecutorDoneMessage *msg = dynamic_cast<WorkunitExecutorDoneMessage *>(message.get())) {
-        processWorkunitExecutorCompletion(msg->workunit_executor, msg->workunit);
-        return true;
+      switch (message->type) {
+        case SimulationMessage::WORKUNIT_EXECUTOR_DONE: {
+          auto msg = static_cast<WorkunitExecutorDoneMessage *>(message.get());
+          processWorkunitExecutorCompletion(msg->workunit_executor, msg->workunit);
+          return true;
+        }
 
-      } else if (WorkunitExecutorFailedMessage *msg = dynamic_cast<WorkunitExecutorFailedMessage *>(message.get())) {
-        processWorkunitExecutorFailure(msg->workunit_executor, msg->workunit, msg->cause);
-        return true;
+        case SimulationMessage::WORKUNIT_EXECUTOR_FAILED: {
+          auto msg = static_cast<WorkunitExecutorFailedMessage *>(message.get());
+          processWorkunitExecutorFailure(msg->workunit_executor, msg->workunit, msg->cause);
+          return true;
+        }
 
-      } else {
-        throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        default: {
+          throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        }
       }
     }
 
@@ -797,7 +805,7 @@ namespace wrench {
         std::set<Workunit *> parent_work_units;
         for (auto const &task : twu->tasks) {
           if (task->getInternalState() != WorkflowTask::InternalState::TASK_READY) {
-            std::vector<WorkflowTask *> parents = task->getWorkflow()->getTaskParents(task);
+            WorkflowTaskSpan parents = task->getWorkflow()->getTaskParentsSpan(task);
               for (auto const &potential_parent_twu : task_work_units) {
                 for (auto const &t : potential_parent_twu->tasks) {
                 if (std::find(parents.begin(), parents.end(), t) != parents.end()) {
@@ -928,14 +936,12 @@ namespace wrench {
      * @brief Clears the scratch space
      */
     void StandardJobExecutor::cleanUpScratch() {
-      if (this->scratch_space != nullptr) {
-        /** Perform scratch cleanup */
-        for (auto scratch_cleanup_file : files_stored_in_scratch) {
-          try {
-            this->scratch_space->deleteFile(scratch_cleanup_file, job, nullptr);
-          } catch (WorkflowExecutionException &e) {
-            throw;
-          }
+      if ((this->scratch_space != nullptr) and (not this->files_stored_in_scratch.empty())) {
+        /** Perform scratch cleanup (all the files are in the job's partition) */
+        try {
+          this->scratch_space->deletePartition(job);
+        } catch (WorkflowExecutionException &e) {
+          throw;
         }
       }
     }
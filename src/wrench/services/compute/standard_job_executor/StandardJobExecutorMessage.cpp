@@ -16,11 +16,12 @@ namespace wrench {
     /**
     * @brief Constructor
     *
+    * @param type: the message type
     * @param name: the message name
     * @param payload: the message size in bytes
     */
-    StandardJobExecutorMessage::StandardJobExecutorMessage(std::string name, double payload) :
-            SimulationMessage("StandardJobExecutorMessage::" + name, payload) {
+    StandardJobExecutorMessage::StandardJobExecutorMessage(SimulationMessage::Type type, std::string name, double payload) :
+            SimulationMessage(type, "StandardJobExecutorMessage::" + name, payload) {
     }
 
 
@@ -34,7 +35,7 @@ namespace wrench {
             WorkunitMulticoreExecutor *workunit_executor,
             Workunit *workunit,
             double payload) :
-            StandardJobExecutorMessage("WORK_UNIT_EXECUTOR_DONE", payload) {
+            StandardJobExecutorMessage(SimulationMessage::WORKUNIT_EXECUTOR_DONE, "WORK_UNIT_EXECUTOR_DONE", payload) {
       this->workunit_executor = workunit_executor;
       this->workunit = workunit;
     }
@@ -51,7 +52,7 @@ namespace wrench {
             Workunit *workunit,
             std::shared_ptr<FailureCause> cause,
             double payload):
-            StandardJobExecutorMessage("WORK_UNIT_EXECUTOR_FAILED", payload) {
+            StandardJobExecutorMessage(SimulationMessage::WORKUNIT_EXECUTOR_FAILED, "WORK_UNIT_EXECUTOR_FAILED", payload) {
       this->workunit_executor = workunit_executor;
       this->workunit = workunit;
       this->cause = cause;
@@ -67,7 +68,7 @@ namespace wrench {
             StandardJob *job,
             StandardJobExecutor *executor,
             double payload) :
-            StandardJobExecutorMessage("STANDARD_JOB_COMPLETED", payload) {
+            StandardJobExecutorMessage(SimulationMessage::STANDARD_JOB_EXECUTOR_DONE, "STANDARD_JOB_COMPLETED", payload) {
       this->job = job;
       this->executor = executor;
     }
@@ -84,7 +85,7 @@ namespace wrench {
             StandardJobExecutor *executor,
             std::shared_ptr<FailureCause> cause,
             double payload) :
-            StandardJobExecutorMessage("STANDARD_JOB_FAILED", payload) {
+            StandardJobExecutorMessage(SimulationMessage::STANDARD_JOB_EXECUTOR_FAILED, "STANDARD_JOB_FAILED", payload) {
       this->job = job;
       this->executor = executor;
       this->cause = cause;
@@ -96,7 +97,7 @@ namespace wrench {
      * @brief Constructor
      */
     ComputeThreadDoneMessage::ComputeThreadDoneMessage() :
-            StandardJobExecutorMessage("COMPUTE_THREAD_DONE", 0) {
+            StandardJobExecutorMessage(SimulationMessage::COMPUTE_THREAD_DONE, "COMPUTE_THREAD_DONE", 0) {
     }
 
 
@@ -33,7 +33,7 @@ namespace wrench {
      */
     class StandardJobExecutorMessage : public SimulationMessage {
     protected:
-        StandardJobExecutorMessage(std::string name, double payload);
+        StandardJobExecutorMessage(SimulationMessage::Type type, std::string name, double payload);
     };
 
     /**
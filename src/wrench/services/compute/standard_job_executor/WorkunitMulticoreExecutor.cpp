@@ -16,6 +16,7 @@
 #include <wrench/simgrid_S4U_util/S4U_Simulation.h>
 #include "wrench/services/compute/standard_job_executor/WorkunitMulticoreExecutor.h"
 #include "StandardJobExecutorMessage.h"
+#include "services/storage/StorageServiceMessage.h"
 #include <wrench/workflow/WorkflowTask.h>
 #include <wrench/workflow/job/StandardJob.h>
 #include <wrench/simulation/SimulationTimestampTypes.h>
@@ -44,6 +45,7 @@ namespace wrench {
      * @param workunit: the work unit to perform
      * @param scratch_space: the service's scratch storage service (nullptr if none)
      * @param thread_startup_overhead: the thread_startup overhead, in seconds
+     * @param simulate_compute_threads: whether to simulate one compute thread per core (or a single computation)
      */
     WorkunitMulticoreExecutor::WorkunitMulticoreExecutor(
             Simulation *simulation,
@@ -54,7 +56,8 @@ namespace wrench {
             Workunit *workunit,
             StorageService *scratch_space,
             WorkflowJob* job,
-            double thread_startup_overhead) :
+            double thread_startup_overhead,
+            bool simulate_compute_threads) :
             Service(hostname, "workunit_multicore_executor", "workunit_multicore_executor") {
 
       if (thread_startup_overhead < 0) {
@@ -68,6 +71,7 @@ namespace wrench {
       this->callback_mailbox = callback_mailbox;
       this->workunit = workunit;
       this->thread_startup_overhead = thread_startup_overhead;
+      this->simulate_compute_threads = simulate_compute_threads;
       this->num_cores = num_cores;
       this->ram_utilization = ram_utilization;
       this->scratch_space = scratch_space;
@@ -175,6 +179,7 @@ namespace wrench {
 //      std::set<WorkflowFile* > files_stored_in_scratch = {};
 
       /** Perform all pre file copies operations */
+      std::vector<std::tuple<WorkflowFile *, StorageService *, std::string, StorageService *, std::string>> pre_file_copies;
       for (auto file_copy : work->pre_file_copies) {
         WorkflowFile *file = std::get<0>(file_copy);
         //Even in the pre-file copies, the src can be the scratch itself???
@@ -198,27 +203,17 @@ namespace wrench {
           throw std::runtime_error("WorkunitMulticoreExecutor::performWork(): internal error: malformed workunit");
         }
 
-        try {
-          WRENCH_INFO("Copying file %s from %s to %s",
-                      file->getID().c_str(),
-                      src->getName().c_str(),
-                      dst->getName().c_str());
-
-          S4U_Simulation::sleep(this->thread_startup_overhead);
-          if (dst == this->scratch_space) {
-            dst->copyFile(file, src, nullptr, job);
-          } else {
-            dst->copyFile(file, src, nullptr, nullptr); // if there is no scratch space, then there is no notion of job's partition, it is always to / partition in such case
-          }
-        } catch (WorkflowExecutionException &e) {
-          throw;
-        }
-
+        // if there is no scratch space, then there is no notion of job's partition, it is always to / partition in such case
+        std::string dst_partition = "/";
         if (dst == this->scratch_space) {
+          dst_partition += job->getName();
           files_stored_in_scratch.insert(file);
         }
+        pre_file_copies.push_back(std::make_tuple(file, src, std::string("/"), dst, dst_partition));
       }
 
+      this->performFileCopies(pre_file_copies);
+
       /** Perform all tasks **/
       for (auto task : work->tasks) {
 
@@ -260,16 +255,9 @@ namespace wrench {
         WRENCH_INFO("Setting the internal state of %s to TASK_COMPLETED", task->getID().c_str());
         task->setInternalState(WorkflowTask::InternalState::TASK_COMPLETED);
 
-        // Deal with Children
-        for (auto child : task->getWorkflow()->getTaskChildren(task)) {
-          bool all_parents_completed = true;
-          for (auto parent : child->getWorkflow()->getTaskParents(child)) {
-            if (parent->getInternalState() != WorkflowTask::InternalState::TASK_COMPLETED) {
-              all_parents_completed = false;
-              break;
-            }
-          }
-          if (all_parents_completed) {
+        // Deal with Children (the completion of the task has updated their numbers of incomplete parents)
+        for (auto child : task->getWorkflow()->getTaskChildrenSpan(task)) {
+          if (child->getNumberOfIncompleteParents() == 0) {
             child->setInternalState(WorkflowTask::InternalState::TASK_READY);
           }
         }
@@ -286,7 +274,7 @@ namespace wrench {
 
 
       /** Perform all post file copies operations */
-      // TODO: This is sequential right now, but probably it should be concurrent in some fashion
+      std::vector<std::tuple<WorkflowFile *, StorageService *, std::string, StorageService *, std::string>> post_file_copies;
       for (auto file_copy : work->post_file_copies) {
         WorkflowFile *file = std::get<0>(file_copy);
         StorageService *src = std::get<1>(file_copy);
@@ -302,19 +290,19 @@ namespace wrench {
           );
         }
 
-        try {
-          S4U_Simulation::sleep(this->thread_startup_overhead);
-          if (src == this->scratch_space) {
-            dst->copyFile(file, src, job, nullptr);
-          } else {
-            dst->copyFile(file, src, nullptr, nullptr);
-          }
+        if ((file == nullptr) || (src == nullptr) || (dst == nullptr)) {
+          throw std::runtime_error("WorkunitMulticoreExecutor::performWork(): internal error: malformed workunit");
+        }
 
-        } catch (WorkflowExecutionException &e) {
-          throw;
+        std::string src_partition = "/";
+        if (src == this->scratch_space) {
+          src_partition += job->getName();
         }
+        post_file_copies.push_back(std::make_tuple(file, src, src_partition, dst, std::string("/")));
       }
 
+      this->performFileCopies(post_file_copies);
+
       /** Perform all cleanup file deletions */
       for (auto cleanup : work->cleanup_file_deletions) {
         WorkflowFile *file = std::get<0>(cleanup);
@@ -336,6 +324,91 @@ namespace wrench {
 
     }
 
+    /**
+     * @brief Perform a set of file copies concurrently (a copy whose source is the destination
+     *        of a previous copy in the list only starts once that previous copy has completed)
+     *
+     * @param file_copies: a list of (file, source storage service, source partition,
+     *                     destination storage service, destination partition) tuples
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    void WorkunitMulticoreExecutor::performFileCopies(
+            std::vector<std::tuple<WorkflowFile *, StorageService *, std::string, StorageService *, std::string>> file_copies) {
+
+      // The answer mailboxes of the copies that have been initiated but have not completed, and the
+      // (file, storage service, partition) locations that these copies will create (the mailbox of
+      // a copy whose answer could not be received is discarded when removed from the list)
+      std::vector<S4U_ReplyMailbox> pending_answer_mailboxes;
+      std::set<std::tuple<WorkflowFile *, StorageService *, std::string>> pending_destinations;
+      std::shared_ptr<FailureCause> failure_cause = nullptr;
+
+      auto wait_for_pending_copies = [&pending_answer_mailboxes, &pending_destinations, &failure_cause]() {
+          for (auto &answer_mailbox : pending_answer_mailboxes) {
+            std::unique_ptr<SimulationMessage> message = nullptr;
+            try {
+              message = S4U_Mailbox::getMessage(answer_mailbox.getName());
+            } catch (std::shared_ptr<NetworkError> &cause) {
+              if (failure_cause == nullptr) {
+                failure_cause = cause;
+              }
+              continue;
+            }
+            answer_mailbox.release();
+            if (auto msg = dynamic_cast<StorageServiceFileCopyAnswerMessage *>(message.get())) {
+              if ((msg->failure_cause) and (failure_cause == nullptr)) {
+                failure_cause = msg->failure_cause;
+              }
+            } else {
+              throw std::runtime_error("WorkunitMulticoreExecutor::performFileCopies(): Unexpected [" +
+                                       message->getName() + "] message");
+            }
+          }
+          pending_answer_mailboxes.clear();
+          pending_destinations.clear();
+      };
+
+      for (auto const &file_copy : file_copies) {
+        WorkflowFile *file = std::get<0>(file_copy);
+        StorageService *src = std::get<1>(file_copy);
+        std::string src_partition = std::get<2>(file_copy);
+        StorageService *dst = std::get<3>(file_copy);
+        std::string dst_partition = std::get<4>(file_copy);
+
+        // A copy that reads a file that a pending copy writes must wait for that copy
+        if (pending_destinations.find(std::make_tuple(file, src, src_partition)) != pending_destinations.end()) {
+          wait_for_pending_copies();
+        }
+        if (failure_cause != nullptr) {
+          break;
+        }
+
+        WRENCH_INFO("Copying file %s from %s to %s",
+                    file->getID().c_str(),
+                    src->getName().c_str(),
+                    dst->getName().c_str());
+
+        S4U_Simulation::sleep(this->thread_startup_overhead);
+        S4U_ReplyMailbox answer_mailbox;
+        try {
+          dst->initiateFileCopy(answer_mailbox.getName(), file, src, src_partition, dst_partition);
+        } catch (WorkflowExecutionException &e) {
+          // Do not leave the copies that have been initiated unattended
+          wait_for_pending_copies();
+          throw;
+        }
+        pending_answer_mailboxes.push_back(std::move(answer_mailbox));
+        pending_destinations.insert(std::make_tuple(file, dst, dst_partition));
+      }
+
+      wait_for_pending_copies();
+
+      if (failure_cause != nullptr) {
+        throw WorkflowExecutionException(failure_cause);
+      }
+    }
+
 
     /**
      * @brief Simulate the execution of a multicore computation
@@ -345,7 +418,23 @@ namespace wrench {
     void WorkunitMulticoreExecutor::runMulticoreComputation(double flops, double parallel_efficiency) {
       double effective_flops = (flops / (this->num_cores * parallel_efficiency));
 
-      std::string tmp_mailbox = S4U_Mailbox::generateUniqueMailboxName("workunit_executor");
+      if (not this->simulate_compute_threads) {
+        // Threads are started one after the other and then each compute the same
+        // number of flops on a core of their own, so the computation completes when the last
+        // thread, started after num_cores thread startup overheads, is done
+        WRENCH_INFO("Simulating %ld compute threads as a single computation", this->num_cores);
+        try {
+          S4U_Simulation::sleep(this->num_cores * this->thread_startup_overhead);
+          S4U_Simulation::compute(effective_flops);
+        } catch (std::exception &e) {
+          WRENCH_INFO("Got an exception while computing... perhaps I am being killed?");
+          throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new FatalFailure()));
+        }
+        return;
+      }
+
+      // Discarded, rather than released, unless all compute threads have reported their completion
+      S4U_ReplyMailbox tmp_mailbox;
 
       // Nobody kills me while I am starting compute threads!
       this->acquireDaemonLock();
@@ -364,7 +453,7 @@ namespace wrench {
         }
         std::shared_ptr<ComputeThread> compute_thread;
         try {
-          compute_thread = std::shared_ptr<ComputeThread>(new ComputeThread(this->simulation, S4U_Simulation::getHostName(), effective_flops, tmp_mailbox));
+          compute_thread = std::shared_ptr<ComputeThread>(new ComputeThread(this->simulation, S4U_Simulation::getHostName(), effective_flops, tmp_mailbox.getName()));
           compute_thread->start(compute_thread, true);
         } catch (std::exception &e) {
           // Some internal SimGrid exceptions...????
@@ -396,7 +485,7 @@ namespace wrench {
       #ifndef S4U_KILL_JOIN_WORKS
       for (unsigned long i = 0; i < this->compute_threads.size(); i++) {
         try {
-          S4U_Mailbox::getMessage(tmp_mailbox);
+          S4U_Mailbox::getMessage(tmp_mailbox.getName());
         } catch (std::shared_ptr<NetworkError> &e) {
           WRENCH_INFO("Got a network error when trying to get completion message from compute thread");
           // Do nothing, perhaps the child has died
@@ -404,6 +493,9 @@ namespace wrench {
           continue;
         }
       }
+      if (success) {
+        tmp_mailbox.release();
+      }
       #else
       for (unsigned long i=0; i < this->compute_threads.size(); i++) {
           WRENCH_INFO("JOINING WITH A COMPUTE THREAD %s", this->compute_threads[i]->process_name.c_str());
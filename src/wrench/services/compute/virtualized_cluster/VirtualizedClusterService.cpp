@@ -77,12 +77,12 @@ namespace wrench {
       serviceSanityCheck();
 
       // send a "get execution hosts" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("get_execution_hosts");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new VirtualizedClusterServiceGetExecutionHostsRequestMessage(
-                                        answer_mailbox,
+                                        answer_mailbox.getName(),
                                         this->getMessagePayloadValueAsDouble(
                                                 VirtualizedClusterServiceMessagePayload::GET_EXECUTION_HOSTS_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -93,10 +93,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<VirtualizedClusterServiceGetExecutionHostsAnswerMessage *>(message.get())) {
         return msg->execution_hosts;
@@ -132,13 +133,13 @@ namespace wrench {
       std::string vm_hostname = "vm" + std::to_string(VM_ID++) + "_" + pm_hostname;
 
       // send a "create vm" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("create_vm");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
         S4U_Mailbox::putMessage(
-                this->mailbox_name,
+                this->mailbox,
                 new VirtualizedClusterServiceCreateVMRequestMessage(
-                        answer_mailbox, pm_hostname, vm_hostname,
+                        answer_mailbox.getName(), pm_hostname, vm_hostname,
                         num_cores, ram_memory, property_list, messagepayload_list,
                         this->getMessagePayloadValueAsDouble(
                                 VirtualizedClusterServiceMessagePayload::CREATE_VM_REQUEST_MESSAGE_PAYLOAD)));
@@ -150,10 +151,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<VirtualizedClusterServiceCreateVMAnswerMessage *>(message.get())) {
         if (msg->success) {
@@ -178,12 +180,12 @@ namespace wrench {
       serviceSanityCheck();
 
       // send a "migrate vm" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("migrate_vm");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new VirtualizedClusterServiceMigrateVMRequestMessage(
-                                        answer_mailbox, vm_hostname, dest_pm_hostname,
+                                        answer_mailbox.getName(), vm_hostname, dest_pm_hostname,
                                         this->getMessagePayloadValueAsDouble(
                                                 VirtualizedClusterServiceMessagePayload::MIGRATE_VM_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -194,10 +196,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<VirtualizedClusterServiceMigrateVMAnswerMessage *>(message.get())) {
         return msg->success;
@@ -220,13 +223,13 @@ namespace wrench {
 
       serviceSanityCheck();
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       //  send a "run a standard job" message to the daemon's mailbox_name
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->mailbox,
                                 new ComputeServiceSubmitStandardJobRequestMessage(
-                                        answer_mailbox, job, service_specific_args,
+                                        answer_mailbox.getName(), job, service_specific_args,
                                         this->getMessagePayloadValueAsDouble(
                                                 ComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -236,10 +239,11 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -266,14 +270,14 @@ namespace wrench {
 
       serviceSanityCheck();
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+      S4U_ReplyMailbox answer_mailbox;
 
       // Send a "run a pilot job" message to the daemon's mailbox_name
       try {
         S4U_Mailbox::putMessage(
-                this->mailbox_name,
+                this->mailbox,
                 new ComputeServiceSubmitPilotJobRequestMessage(
-                        answer_mailbox, job, this->getMessagePayloadValueAsDouble(
+                        answer_mailbox.getName(), job, this->getMessagePayloadValueAsDouble(
                                 VirtualizedClusterServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
@@ -283,10 +287,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobAnswerMessage *>(message.get())) {
         // If no success, throw an exception
@@ -357,7 +362,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message;
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name);
+        message = S4U_Mailbox::getMessage(this->mailbox);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -369,45 +374,61 @@ namespace wrench {
 
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-      if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-        this->stopAllVMs();
-        // This is Synchronous
-        try {
-          S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                  new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
-                                          VirtualizedClusterServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+      switch (message->type) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+          this->stopAllVMs();
+          // This is Synchronous
+          try {
+            S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                    new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
+                                            VirtualizedClusterServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
+          }
           return false;
         }
-        return false;
 
-      } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-        processGetResourceInformation(msg->answer_mailbox);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_RESOURCE_INFORMATION_REQUEST: {
+          auto msg = static_cast<ComputeServiceResourceInformationRequestMessage *>(message.get());
+          processGetResourceInformation(msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<VirtualizedClusterServiceGetExecutionHostsRequestMessage *>(message.get())) {
-        processGetExecutionHosts(msg->answer_mailbox);
-        return true;
+        case SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_GET_EXECUTION_HOSTS_REQUEST: {
+          auto msg = static_cast<VirtualizedClusterServiceGetExecutionHostsRequestMessage *>(message.get());
+          processGetExecutionHosts(msg->answer_mailbox);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<VirtualizedClusterServiceCreateVMRequestMessage *>(message.get())) {
-        processCreateVM(msg->answer_mailbox, msg->pm_hostname, msg->vm_hostname, msg->num_cores, msg->ram_memory,
-                        msg->property_list, msg->messagepayload_list);
-        return true;
+        case SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_CREATE_VM_REQUEST: {
+          auto msg = static_cast<VirtualizedClusterServiceCreateVMRequestMessage *>(message.get());
+          processCreateVM(msg->answer_mailbox, msg->pm_hostname, msg->vm_hostname, msg->num_cores, msg->ram_memory,
+                          msg->property_list, msg->messagepayload_list);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<VirtualizedClusterServiceMigrateVMRequestMessage *>(message.get())) {
-        processMigrateVM(msg->answer_mailbox, msg->vm_hostname, msg->dest_pm_hostname);
-        return true;
+        case SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_MIGRATE_VM_REQUEST: {
+          auto msg = static_cast<VirtualizedClusterServiceMigrateVMRequestMessage *>(message.get());
+          processMigrateVM(msg->answer_mailbox, msg->vm_hostname, msg->dest_pm_hostname);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-        processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_SUBMIT_STANDARD_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get());
+          processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+          return true;
+        }
 
-      } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-        processSubmitPilotJob(msg->answer_mailbox, msg->job);
-        return true;
+        case SimulationMessage::COMPUTE_SERVICE_SUBMIT_PILOT_JOB_REQUEST: {
+          auto msg = static_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get());
+          processSubmitPilotJob(msg->answer_mailbox, msg->job);
+          return true;
+        }
 
-      } else {
-        throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        default: {
+          throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        }
       }
     }
 
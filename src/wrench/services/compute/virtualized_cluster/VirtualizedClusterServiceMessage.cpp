@@ -15,11 +15,12 @@ namespace wrench {
     /**
      * @brief Constructor
      *
+     * @param type: the message type
      * @param name: the message name
      * @param payload: the message size in bytes
      */
-    VirtualizedClusterServiceMessage::VirtualizedClusterServiceMessage(const std::string &name, double payload) :
-            ComputeServiceMessage("VirtualizedClusterServiceMessage::" + name, payload) {
+    VirtualizedClusterServiceMessage::VirtualizedClusterServiceMessage(SimulationMessage::Type type, const std::string &name, double payload) :
+            ComputeServiceMessage(type, "VirtualizedClusterServiceMessage::" + name, payload) {
     }
 
     /**
@@ -32,7 +33,7 @@ namespace wrench {
      */
     VirtualizedClusterServiceGetExecutionHostsRequestMessage::VirtualizedClusterServiceGetExecutionHostsRequestMessage(
             const std::string &answer_mailbox, double payload) : VirtualizedClusterServiceMessage(
-            "GET_EXECUTION_HOSTS_REQUEST",
+            SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_GET_EXECUTION_HOSTS_REQUEST, "GET_EXECUTION_HOSTS_REQUEST",
             payload) {
 
       if (answer_mailbox.empty()) {
@@ -51,7 +52,7 @@ namespace wrench {
      */
     VirtualizedClusterServiceGetExecutionHostsAnswerMessage::VirtualizedClusterServiceGetExecutionHostsAnswerMessage(
             std::vector<std::string> &execution_hosts, double payload) : VirtualizedClusterServiceMessage(
-            "GET_EXECUTION_HOSTS_ANSWER", payload), execution_hosts(execution_hosts) {}
+            SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_GET_EXECUTION_HOSTS_ANSWER, "GET_EXECUTION_HOSTS_ANSWER", payload), execution_hosts(execution_hosts) {}
 
     /**
      * @brief Constructor
@@ -78,7 +79,7 @@ namespace wrench {
             std::map<std::string, std::string> &property_list,
             std::map<std::string, std::string> &messagepayload_list,
             double payload) :
-            VirtualizedClusterServiceMessage("CREATE_VM_REQUEST", payload),
+            VirtualizedClusterServiceMessage(SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_CREATE_VM_REQUEST, "CREATE_VM_REQUEST", payload),
             num_cores(num_cores), ram_memory(ram_memory),
             property_list(property_list), messagepayload_list(messagepayload_list) {
 
@@ -99,7 +100,7 @@ namespace wrench {
      */
     VirtualizedClusterServiceCreateVMAnswerMessage::VirtualizedClusterServiceCreateVMAnswerMessage(bool success,
                                                                                                    double payload) :
-            VirtualizedClusterServiceMessage("CREATE_VM_ANSWER", payload), success(success) {}
+            VirtualizedClusterServiceMessage(SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_CREATE_VM_ANSWER, "CREATE_VM_ANSWER", payload), success(success) {}
 
     /**
      * @brief Constructor
@@ -116,7 +117,7 @@ namespace wrench {
             const std::string &vm_hostname,
             const std::string &dest_pm_hostname,
             double payload) :
-            VirtualizedClusterServiceMessage("MIGRATE_VM_REQUEST", payload) {
+            VirtualizedClusterServiceMessage(SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_MIGRATE_VM_REQUEST, "MIGRATE_VM_REQUEST", payload) {
 
       if (answer_mailbox.empty() || dest_pm_hostname.empty() || vm_hostname.empty()) {
         throw std::invalid_argument(
@@ -135,6 +136,6 @@ namespace wrench {
      */
     VirtualizedClusterServiceMigrateVMAnswerMessage::VirtualizedClusterServiceMigrateVMAnswerMessage(bool success,
                                                                                                      double payload) :
-            VirtualizedClusterServiceMessage("MIGRATE_VM_ANSWER", payload), success(success) {}
+            VirtualizedClusterServiceMessage(SimulationMessage::VIRTUALIZED_CLUSTER_SERVICE_MIGRATE_VM_ANSWER, "MIGRATE_VM_ANSWER", payload), success(success) {}
 
 }
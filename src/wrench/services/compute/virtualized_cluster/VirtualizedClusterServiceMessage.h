@@ -28,7 +28,7 @@ namespace wrench {
      */
     class VirtualizedClusterServiceMessage : public ComputeServiceMessage {
     protected:
-        VirtualizedClusterServiceMessage(const std::string &name, double payload);
+        VirtualizedClusterServiceMessage(SimulationMessage::Type type, const std::string &name, double payload);
     };
 
     /**
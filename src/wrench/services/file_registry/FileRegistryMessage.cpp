@@ -14,11 +14,12 @@ namespace wrench {
 
     /**
      * @brief Constructor
+     * @param type: the message type
      * @param name: the message name
      * @param payload: the message size in bytes
      */
-    FileRegistryMessage::FileRegistryMessage(std::string name, double payload) :
-            ServiceMessage("FileRegistry::" + name, payload) {
+    FileRegistryMessage::FileRegistryMessage(SimulationMessage::Type type, std::string name, double payload) :
+            ServiceMessage(type, "FileRegistry::" + name, payload) {
 
     }
 
@@ -30,7 +31,7 @@ namespace wrench {
      */
     FileRegistryFileLookupRequestMessage::FileRegistryFileLookupRequestMessage(std::string answer_mailbox,
                                                                                WorkflowFile *file, double payload) :
-            FileRegistryMessage("FILE_LOOKUP_REQUEST", payload) {
+            FileRegistryMessage(SimulationMessage::FILE_REGISTRY_FILE_LOOKUP_REQUEST, "FILE_LOOKUP_REQUEST", payload) {
 
       if ((answer_mailbox == "") || file == nullptr) {
         throw std::invalid_argument("FileRegistryFileLookupRequestMessage::FileRegistryFileLookupRequestMessage(): Invalid argument");
@@ -48,7 +49,7 @@ namespace wrench {
     FileRegistryFileLookupAnswerMessage::FileRegistryFileLookupAnswerMessage(WorkflowFile *file,
                                                                              std::set<StorageService *> locations,
                                                                              double payload) :
-            FileRegistryMessage("FILE_LOOKUP_ANSWER", payload) {
+            FileRegistryMessage(SimulationMessage::FILE_REGISTRY_FILE_LOOKUP_ANSWER, "FILE_LOOKUP_ANSWER", payload) {
       if (file == nullptr) {
         throw std::invalid_argument("FileRegistryFileLookupAnswerMessage::FileRegistryFileLookupAnswerMessage(): Invalid argument");
       }
@@ -67,7 +68,7 @@ namespace wrench {
     FileRegistryFileLookupByProximityRequestMessage::FileRegistryFileLookupByProximityRequestMessage(
             std::string answer_mailbox, WorkflowFile *file, std::string reference_host,
            NetworkProximityService *network_proximity_service, double payload) :
-    FileRegistryMessage("FILE_LOOKUP_BY_PROXIMITY_REQUEST", payload) {
+    FileRegistryMessage(SimulationMessage::FILE_REGISTRY_FILE_LOOKUP_BY_PROXIMITY_REQUEST, "FILE_LOOKUP_BY_PROXIMITY_REQUEST", payload) {
         if ((file == nullptr) || (answer_mailbox == "") || (reference_host == "") || (network_proximity_service == nullptr)) {
             throw std::invalid_argument("FileRegistryFileLookupByProximityRequestMessage::FileRegistryFileLookupByProximityRequestMessage(): Invalid Argument");
         }
@@ -86,16 +87,16 @@ namespace wrench {
      */
     FileRegistryFileLookupByProximityAnswerMessage::FileRegistryFileLookupByProximityAnswerMessage(
             WorkflowFile *file, std::string reference_host,
-            std::map<double, StorageService *> locations,
+            std::multimap<double, StorageService *> locations,
             double payload) :
-            FileRegistryMessage("FILE_LOOKUP_BY_PROXIMITY_ANSWER", payload) {
+            FileRegistryMessage(SimulationMessage::FILE_REGISTRY_FILE_LOOKUP_BY_PROXIMITY_ANSWER, "FILE_LOOKUP_BY_PROXIMITY_ANSWER", payload) {
         if ((file == nullptr) || (reference_host == "")) {
             throw std::invalid_argument(
                     "FileRegistryFileLookupByProximityAnswertMessage::FileRegistryFileLookupByProximityAnswerMessage(): Invalid Argument");
         }
         this->file = file;
         this->reference_host = reference_host;
-        this->locations = locations;
+        this->locations = std::move(locations);
     }
     /**
      * @brief Constructor
@@ -108,7 +109,7 @@ namespace wrench {
                                                                                  WorkflowFile *file,
                                                                                  StorageService *storage_service,
                                                                                  double payload) :
-            FileRegistryMessage("REMOVE_ENTRY_REQUEST", payload) {
+            FileRegistryMessage(SimulationMessage::FILE_REGISTRY_REMOVE_ENTRY_REQUEST, "REMOVE_ENTRY_REQUEST", payload) {
       if ((answer_mailbox == "") || (file == nullptr) || (storage_service == nullptr)) {
         throw std::invalid_argument("FileRegistryRemoveEntryRequestMessage::FileRegistryRemoveEntryRequestMessage(): Invalid argument");
       }
@@ -125,7 +126,7 @@ namespace wrench {
      */
     FileRegistryRemoveEntryAnswerMessage::FileRegistryRemoveEntryAnswerMessage(bool success,
                                                                                double payload) :
-            FileRegistryMessage("REMOVE_ENTRY_ANSWER", payload) {
+            FileRegistryMessage(SimulationMessage::FILE_REGISTRY_REMOVE_ENTRY_ANSWER, "REMOVE_ENTRY_ANSWER", payload) {
       this->success = success;
     }
 
@@ -140,7 +141,7 @@ namespace wrench {
                                                                            WorkflowFile *file,
                                                                            StorageService *storage_service,
                                                                            double payload) :
-            FileRegistryMessage("ADD_ENTRY_REQUEST", payload) {
+            FileRegistryMessage(SimulationMessage::FILE_REGISTRY_ADD_ENTRY_REQUEST, "ADD_ENTRY_REQUEST", payload) {
       if ((answer_mailbox == "") || (file == nullptr) || (storage_service == nullptr)) {
         throw std::invalid_argument("FileRegistryAddEntryRequestMessage::FileRegistryAddEntryRequestMessage(): Invalid argument");
       }
@@ -155,7 +156,7 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     FileRegistryAddEntryAnswerMessage::FileRegistryAddEntryAnswerMessage(double payload) :
-            FileRegistryMessage("ADD_ENTRY_ANSWER", payload) {
+            FileRegistryMessage(SimulationMessage::FILE_REGISTRY_ADD_ENTRY_ANSWER, "ADD_ENTRY_ANSWER", payload) {
     }
 
 };
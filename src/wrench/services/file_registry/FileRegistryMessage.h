@@ -27,7 +27,7 @@ namespace wrench {
      */
     class FileRegistryMessage : public ServiceMessage {
     protected:
-        FileRegistryMessage(std::string name, double payload);
+        FileRegistryMessage(SimulationMessage::Type type, std::string name, double payload);
 
     };
 
@@ -94,7 +94,7 @@ namespace wrench {
     public:
         FileRegistryFileLookupByProximityAnswerMessage(WorkflowFile *file,
                                                        std::string reference_host,
-                                                       std::map<double, StorageService *> locations,
+                                                       std::multimap<double, StorageService *> locations,
                                                        double payload);
 
         /** @brief The file to lookup */
@@ -109,9 +109,9 @@ namespace wrench {
         std::string reference_host;
         /**
          * @brief A map of all locations where the file resides sorted with respect to their distance from
-         * the host 'host_to_measure_from'
+         * the host 'host_to_measure_from' (locations at the same distance all appear)
          */
-        std::map<double, StorageService *> locations;
+        std::multimap<double, StorageService *> locations;
     };
 
     /**
@@ -83,10 +83,10 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<ServiceIsDown>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new FileRegistryFileLookupRequestMessage(answer_mailbox, file,
+        S4U_Mailbox::putMessage(this->mailbox, new FileRegistryFileLookupRequestMessage(answer_mailbox.getName(), file,
                                                                                              this->getMessagePayloadValueAsDouble(
                                                                                                      FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -96,10 +96,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<FileRegistryFileLookupAnswerMessage *>(message.get())) {
         std::set<StorageService *> result = msg->locations;
@@ -118,11 +119,11 @@ namespace wrench {
      * @param reference_host: reference host from which network proximity values are to be measured
      * @param network_proximity_service: the network proximity service to use
      *
-     * @return a map of <distance , storage service> pairs
+     * @return a map of <distance , storage service> pairs (storage services at the same distance all appear)
      */
-    std::map<double, StorageService *> FileRegistryService::lookupEntry(WorkflowFile *file,
-                                                                        std::string reference_host,
-                                                                        NetworkProximityService *network_proximity_service) {
+    std::multimap<double, StorageService *> FileRegistryService::lookupEntry(WorkflowFile *file,
+                                                                             std::string reference_host,
+                                                                             NetworkProximityService *network_proximity_service) {
 
       if (file == nullptr) {
         throw std::invalid_argument("FileRegistryService::lookupEntryByProximity(): Invalid argument, no file");
@@ -133,15 +134,15 @@ namespace wrench {
       }
 
       // check to see if the 'reference_host' is valid
-      std::vector<std::string> monitored_hosts = network_proximity_service->getHostnameList();
+      const std::vector<std::string> &monitored_hosts = network_proximity_service->getHostnameList();
       if(std::find(monitored_hosts.cbegin(), monitored_hosts.cend(), reference_host) == monitored_hosts.cend()) {
         throw std::invalid_argument("FileRegistryService::lookupEntryByProximity(): Invalid argument, host " + reference_host + " does not exist");
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry_by_proximity");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new FileRegistryFileLookupByProximityRequestMessage(answer_mailbox, file, reference_host, network_proximity_service,
+        S4U_Mailbox::putMessage(this->mailbox, new FileRegistryFileLookupByProximityRequestMessage(answer_mailbox.getName(), file, reference_host, network_proximity_service,
                                                                                                         this->getMessagePayloadValueAsDouble(
                                                                                                                 FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -151,10 +152,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (FileRegistryFileLookupByProximityAnswerMessage *msg = dynamic_cast<FileRegistryFileLookupByProximityAnswerMessage *> (message.get())) {
         return msg->locations;
@@ -182,11 +184,11 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<ServiceIsDown>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("add_entry");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new FileRegistryAddEntryRequestMessage(answer_mailbox, file, storage_service,
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new FileRegistryAddEntryRequestMessage(answer_mailbox.getName(), file, storage_service,
                                                                        this->getMessagePayloadValueAsDouble(
                                                                                FileRegistryServiceMessagePayload::ADD_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -196,10 +198,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<FileRegistryAddEntryAnswerMessage *>(message.get())) {
         return;
@@ -227,11 +230,11 @@ namespace wrench {
         throw WorkflowExecutionException(std::shared_ptr<ServiceIsDown>(new ServiceIsDown(this)));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("remove_entry");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new FileRegistryRemoveEntryRequestMessage(answer_mailbox, file, storage_service,
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new FileRegistryRemoveEntryRequestMessage(answer_mailbox.getName(), file, storage_service,
                                                                           this->getMessagePayloadValueAsDouble(
                                                                                   FileRegistryServiceMessagePayload::REMOVE_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -241,10 +244,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<FileRegistryRemoveEntryAnswerMessage *>(message.get())) {
         if (!msg->success) {
@@ -289,7 +293,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name);
+        message = S4U_Mailbox::getMessage(this->mailbox);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -301,89 +305,109 @@ namespace wrench {
 
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-      if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-        // This is Synchronous
-        try {
-          S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                  new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
-                                          FileRegistryServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+      switch (message->type) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+          // This is Synchronous
+          try {
+            S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                    new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
+                                            FileRegistryServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
+          }
           return false;
         }
-        return false;
 
-      } else if (auto msg = dynamic_cast<FileRegistryFileLookupRequestMessage *>(message.get())) {
-        std::set<StorageService *> locations;
-        if (this->entries.find(msg->file) != this->entries.end()) {
-          locations = this->entries[msg->file];
-        }
-        // Simulate a lookup overhead
-        S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
-        try {
-          S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                   new FileRegistryFileLookupAnswerMessage(msg->file, locations,
-                                                                           this->getMessagePayloadValueAsDouble(
-                                                                                   FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+        case SimulationMessage::FILE_REGISTRY_FILE_LOOKUP_REQUEST: {
+          auto msg = static_cast<FileRegistryFileLookupRequestMessage *>(message.get());
+          std::set<StorageService *> locations;
+          if (this->entries.find(msg->file) != this->entries.end()) {
+            locations = this->entries[msg->file];
+          }
+          // Simulate a lookup overhead
+          S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new FileRegistryFileLookupAnswerMessage(msg->file, locations,
+                                                                             this->getMessagePayloadValueAsDouble(
+                                                                                     FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
           return true;
         }
-        return true;
-
-      } else if (FileRegistryFileLookupByProximityRequestMessage *msg = dynamic_cast<FileRegistryFileLookupByProximityRequestMessage *> (message.get())) {
-
-        std::string reference_host = msg->reference_host;
-
-        std::map<double, StorageService *> locations;
-        std::set<StorageService *> storage_services_with_file;
-        if (this->entries.find(msg->file) != this->entries.end()) {
-          storage_services_with_file = this->entries[msg->file];
-        }
-
-        double proximity;
-        auto locations_itr = locations.cbegin();
-
-        for (auto &storage_service: storage_services_with_file) {
-          proximity = msg->network_proximity_service->query(std::make_pair(reference_host, storage_service->hostname));
-          locations_itr = locations.insert(locations_itr, std::make_pair(proximity, storage_service));
-        }
 
-        S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
-        try {
-          S4U_Mailbox::dputMessage(msg->answer_mailbox, new FileRegistryFileLookupByProximityAnswerMessage(msg->file,
-                                                                                                           msg->reference_host, locations, 
-                                                                                                           this->getMessagePayloadValueAsDouble(FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+        case SimulationMessage::FILE_REGISTRY_FILE_LOOKUP_BY_PROXIMITY_REQUEST: {
+          auto msg = static_cast<FileRegistryFileLookupByProximityRequestMessage *>(message.get());
+          std::string reference_host = msg->reference_host;
+
+          std::multimap<double, StorageService *> locations;
+          auto entry = this->entries.find(msg->file);
+          if (entry != this->entries.end()) {
+            // Obtain all proximity values with a single request to the network proximity service
+            std::vector<StorageService *> storage_services_with_file(entry->second.begin(), entry->second.end());
+            std::vector<std::string> hostnames;
+            hostnames.reserve(storage_services_with_file.size());
+            for (auto const &storage_service : storage_services_with_file) {
+              hostnames.push_back(storage_service->hostname);
+            }
+
+            std::vector<double> proximity_values;
+            try {
+              proximity_values = msg->network_proximity_service->queryMany(reference_host, std::move(hostnames));
+            } catch (WorkflowExecutionException &e) {
+              // No proximity estimate is available
+              proximity_values.assign(storage_services_with_file.size(), NetworkProximityService::NOT_AVAILABLE);
+            }
+
+            for (unsigned long i = 0; i < storage_services_with_file.size(); i++) {
+              locations.insert(std::make_pair(proximity_values[i], storage_services_with_file[i]));
+            }
+          }
+
+          S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox, new FileRegistryFileLookupByProximityAnswerMessage(msg->file,
+                                                                                                             msg->reference_host, locations, 
+                                                                                                             this->getMessagePayloadValueAsDouble(FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
           return true;
         }
-        return true;
 
-      } else if (auto msg = dynamic_cast<FileRegistryAddEntryRequestMessage *>(message.get())) {
-        addEntryToDatabase(msg->file, msg->storage_service);
-        try {
-          S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                   new FileRegistryAddEntryAnswerMessage(this->getMessagePayloadValueAsDouble(
-                                           FileRegistryServiceMessagePayload::ADD_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+        case SimulationMessage::FILE_REGISTRY_ADD_ENTRY_REQUEST: {
+          auto msg = static_cast<FileRegistryAddEntryRequestMessage *>(message.get());
+          addEntryToDatabase(msg->file, msg->storage_service);
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new FileRegistryAddEntryAnswerMessage(this->getMessagePayloadValueAsDouble(
+                                             FileRegistryServiceMessagePayload::ADD_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
           return true;
         }
-        return true;
 
-      } else if (auto msg = dynamic_cast<FileRegistryRemoveEntryRequestMessage *>(message.get())) {
-
-        bool success = removeEntryFromDatabase(msg->file, msg->storage_service);
-        try {
-          S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                   new FileRegistryRemoveEntryAnswerMessage(success,
-                                                                            this->getMessagePayloadValueAsDouble(
-                                                                                    FileRegistryServiceMessagePayload::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+        case SimulationMessage::FILE_REGISTRY_REMOVE_ENTRY_REQUEST: {
+          auto msg = static_cast<FileRegistryRemoveEntryRequestMessage *>(message.get());
+          bool success = removeEntryFromDatabase(msg->file, msg->storage_service);
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new FileRegistryRemoveEntryAnswerMessage(success,
+                                                                              this->getMessagePayloadValueAsDouble(
+                                                                                      FileRegistryServiceMessagePayload::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
           return true;
         }
-        return true;
 
-      } else {
-        throw std::runtime_error(
-                "FileRegistryService::waitForNextMessage(): Unknown message type: " + std::to_string(message->payload));
+        default: {
+          throw std::runtime_error(
+                  "FileRegistryService::waitForNextMessage(): Unknown message type: " + std::to_string(message->payload));
+        }
       }
     }
 
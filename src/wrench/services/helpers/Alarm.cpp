@@ -7,77 +7,40 @@
  * (at your option) any later version.
  */
 
-#include "wrench/logging/TerminalOutput.h"
-#include "wrench/services/ServiceMessage.h"
 #include "wrench/services/helpers/Alarm.h"
-#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/services/helpers/AlarmService.h"
 #include "wrench/simgrid_S4U_util/S4U_Simulation.h"
 
-XBT_LOG_NEW_DEFAULT_CATEGORY(alarm_service, "Log category for Alarm Service");
-
 namespace wrench {
 
     /**
      * @brief Constructor
      *
-     * @param date: the date at which the message should be sent. If date is in the past
-     *              message will be sent immediately.
-     * @param hostname: the name of the host on which the Alarm daemon should run
+     * @param date: the date at which the message should be sent
      * @param reply_mailbox_name: the mailbox to which the message should be sent
      * @param msg: the message to send
-     * @param suffix: a (possibly empty) suffix to append to the daemon name
+     * @param suffix: a (possibly empty) suffix that identifies the alarm in debug output
      */
-    Alarm::Alarm(double date, std::string hostname, std::string &reply_mailbox_name,
-                 SimulationMessage *msg, std::string suffix) : Service(hostname, "alarm_service_" + suffix,
-                                                                       "alarm_service_" + suffix) {
+    Alarm::Alarm(double date, std::string &reply_mailbox_name,
+                 SimulationMessage *msg, std::string suffix) {
 
       this->date = date;
-//      if (this->date <= S4U_Simulation::getClock()) {
-//        WRENCH_INFO(
-//                "Alarm is being started but notification date is in the past. Notification will be sent immediately.");
-//      }
+      this->sequence_number = 0;
       this->reply_mailbox_name = reply_mailbox_name;
+      this->suffix = suffix;
       this->msg = std::unique_ptr<SimulationMessage>(msg);
     }
 
     /**
-     * @brief Main method of the daemon
-     *
-     * @return 0 on termination
-     */
-    int Alarm::main() {
-      TerminalOutput::setThisProcessLoggingColor(TerminalOutput::COLOR_MAGENTA);
-      WRENCH_INFO("Alarm Service starting on host %s!", S4U_Simulation::getHostName().c_str());
-
-      double time_to_sleep = this->date - S4U_Simulation::getClock();
-
-      if (time_to_sleep > 0) {
-        S4U_Simulation::sleep(time_to_sleep);
-        WRENCH_INFO("Alarm Service Sending a message to %s", this->reply_mailbox_name.c_str());
-        try {
-          S4U_Mailbox::putMessage(this->reply_mailbox_name,
-                                  msg.release());
-        } catch (std::shared_ptr<NetworkError> &cause) {
-          WRENCH_WARN("AlarmService was not able to send the trigger to its upper service");
-        }
-      }
-
-      WRENCH_INFO("Alarm Service on host %s terminated!", S4U_Simulation::getHostName().c_str());
-      this->setStateToDown();
-      return 0;
-    }
-
-
-    /**
-     * @brief Create and start an alarm service
+     * @brief Create and start an alarm
      * @param simulation: a pointer to the simulation object
      * @param date: the date at which the message should be sent (if date is in the past
-     *              then the message will be sent immediately)
-     * @param hostname: the name of the host on which to start the alarm service
+     *              then the message is not sent)
+     * @param hostname: the name of the host whose alarm service will send the message
      * @param reply_mailbox_name: the mailbox to which the alarm service will send a message
      * @param msg: the message to send
-     * @param suffix: a (possibly empty) suffix to append to the daemon name (useful in debug output)
-     * @return a shared_ptr reference to the alarm service
+     * @param suffix: a (possibly empty) suffix that identifies the alarm in debug output
+     * @return a shared_ptr reference to the alarm
      *
      * @throw std::invalid_argument
      */
@@ -85,21 +48,32 @@ namespace wrench {
     Alarm::createAndStartAlarm(Simulation *simulation, double date, std::string hostname, std::string &reply_mailbox_name,
                                SimulationMessage *msg, std::string suffix) {
       std::shared_ptr<Alarm> alarm_ptr = std::shared_ptr<Alarm>(
-              new Alarm(date, hostname, reply_mailbox_name, msg, suffix));
-      alarm_ptr->simulation = simulation;
-      try {
-        alarm_ptr->start(alarm_ptr, true); // daemonize
-      } catch (std::invalid_argument &e) {
-        throw;
+              new Alarm(date, reply_mailbox_name, msg, suffix));
+
+      std::shared_ptr<AlarmService> alarm_service = AlarmService::getAlarmService(simulation, hostname);
+      if (date > S4U_Simulation::getClock()) {
+        alarm_ptr->alarm_service = alarm_service;
+        alarm_service->arm(alarm_ptr);
       }
       return alarm_ptr;
     }
 
     /**
-     * @brief Immediately (i.e., brutally) terminate the alarm service
+     * @brief Immediately cancel the alarm (does nothing if the alarm's message has already been sent)
      */
     void Alarm::kill() {
-      this->killActor();
+      std::shared_ptr<AlarmService> alarm_service = this->alarm_service.lock();
+      if (alarm_service != nullptr) {
+        alarm_service->disarm(this);
+      }
+    }
+
+    /**
+     * @brief Get the date at which the alarm's message is sent
+     * @return a date
+     */
+    double Alarm::getDate() {
+      return this->date;
     }
 
 };
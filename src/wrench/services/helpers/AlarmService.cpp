@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/logging/TerminalOutput.h"
+#include "wrench/services/helpers/AlarmService.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simgrid_S4U_util/S4U_Simulation.h"
+#include "wrench/util/MessageManager.h"
+#include "wrench/workflow/execution_events/FailureCause.h"
+#include "services/helpers/AlarmServiceMessage.h"
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(alarm_service, "Log category for Alarm Service");
+
+namespace wrench {
+
+    std::map<std::string, std::shared_ptr<AlarmService>> AlarmService::alarm_services;
+
+    /**
+     * @brief Constructor
+     *
+     * @param hostname: the name of the host on which the service's daemon runs
+     */
+    AlarmService::AlarmService(const std::string &hostname) : Service(hostname, "alarm_service", "alarm_service") {
+    }
+
+    /**
+     * @brief Get the alarm service of a host, starting it if needed
+     *
+     * @param simulation: a pointer to the simulation object
+     * @param hostname: the hostname
+     * @return the alarm service
+     *
+     * @throw std::invalid_argument
+     */
+    std::shared_ptr<AlarmService> AlarmService::getAlarmService(Simulation *simulation, const std::string &hostname) {
+      auto it = alarm_services.find(hostname);
+      if ((it != alarm_services.end()) and (it->second->simulation == simulation) and (it->second->isUp())) {
+        return it->second;
+      }
+
+      std::shared_ptr<AlarmService> alarm_service = std::shared_ptr<AlarmService>(new AlarmService(hostname));
+      alarm_service->simulation = simulation;
+      try {
+        alarm_service->start(alarm_service, true); // daemonize
+      } catch (std::runtime_error &e) {
+        throw std::invalid_argument("AlarmService::getAlarmService(): " + std::string(e.what()));
+      }
+      alarm_services[hostname] = alarm_service;
+      return alarm_service;
+    }
+
+    /**
+     * @brief Arm an alarm (whose message will be sent at the alarm's date)
+     *
+     * @param alarm: the alarm
+     *
+     * @throw std::invalid_argument
+     */
+    void AlarmService::arm(std::shared_ptr<Alarm> alarm) {
+      if (alarm->heap_index >= 0) {
+        throw std::invalid_argument("AlarmService::arm(): Alarm is already armed");
+      }
+
+      alarm->sequence_number = this->next_sequence_number++;
+      alarm->heap_index = this->heap.size();
+      this->heap.push_back(alarm);
+      this->siftUp(this->heap.size() - 1);
+
+      // If the alarm is now the earliest one, the daemon must recompute its wake-up date
+      if ((alarm->heap_index == 0) and (not this->wake_up_pending)) {
+        this->wake_up_pending = true;
+        try {
+          S4U_Mailbox::dputMessage(this->mailbox, new AlarmServiceWakeUpMessage(0));
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          this->wake_up_pending = false;
+        }
+      }
+    }
+
+    /**
+     * @brief Disarm an alarm (does nothing if the alarm is not armed with this service)
+     *
+     * @param alarm: the alarm
+     */
+    void AlarmService::disarm(Alarm *alarm) {
+      if ((alarm->heap_index < 0) or ((unsigned long) alarm->heap_index >= this->heap.size()) or
+          (this->heap[alarm->heap_index].get() != alarm)) {
+        return;
+      }
+
+      // The daemon, which may be waiting for this alarm's date, simply wakes up for nothing
+      unsigned long index = alarm->heap_index;
+      unsigned long last = this->heap.size() - 1;
+      if (index != last) {
+        this->swap(index, last);
+      }
+      this->heap.pop_back();
+      alarm->heap_index = -1;
+      if (index != last) {
+        this->siftUp(index);
+        this->siftDown(index);
+      }
+    }
+
+    /**
+     * @brief Get the number of alarms that are currently armed
+     *
+     * @return a number of alarms
+     */
+    unsigned long AlarmService::getNumArmedAlarms() {
+      return this->heap.size();
+    }
+
+    /**
+     * @brief Main method of the daemon
+     *
+     * @return 0 on termination
+     */
+    int AlarmService::main() {
+      TerminalOutput::setThisProcessLoggingColor(TerminalOutput::COLOR_MAGENTA);
+      WRENCH_INFO("Alarm Service starting on host %s!", S4U_Simulation::getHostName().c_str());
+
+      while (true) {
+
+        // Send the messages of all the alarms that are due
+        while ((not this->heap.empty()) and (this->heap.front()->date <= S4U_Simulation::getClock())) {
+          std::shared_ptr<Alarm> alarm = this->heap.front();
+          this->disarm(alarm.get());
+          this->sendAlarmMessage(alarm);
+        }
+
+        // Wait until the next alarm's date, or until an earlier alarm is armed
+        double timeout = -1.0;
+        if (not this->heap.empty()) {
+          timeout = this->heap.front()->date - S4U_Simulation::getClock();
+        }
+
+        std::unique_ptr<SimulationMessage> message = nullptr;
+        try {
+          message = S4U_Mailbox::getMessage(this->mailbox, timeout);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          if (cause->isTimeout()) {
+            continue;
+          }
+          break;
+        }
+
+        switch (message->type) {
+          case SimulationMessage::ALARM_SERVICE_WAKE_UP: {
+            this->wake_up_pending = false;
+            continue;
+          }
+
+          case SimulationMessage::SERVICE_STOP_DAEMON: {
+            auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+            try {
+              S4U_Mailbox::putMessage(msg->ack_mailbox, new ServiceDaemonStoppedMessage(0));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+              // Nothing to do
+            }
+            break;
+          }
+
+          default: {
+            throw std::runtime_error(
+                    "AlarmService::main(): Unexpected [" + message->getName() + "] message");
+          }
+        }
+        // Only a stop request leaves the switch
+        break;
+      }
+
+      WRENCH_INFO("Alarm Service on host %s terminated!", S4U_Simulation::getHostName().c_str());
+      this->setStateToDown();
+      return 0;
+    }
+
+    /**
+     * @brief Cleanup function called when the daemon terminates (for whatever reason)
+     */
+    void AlarmService::cleanup() {
+      this->setStateToDown();
+    }
+
+    /**
+     * @brief Send the message of an alarm, asynchronously since the daemon
+     *        cannot wait for the message to be received
+     *
+     * @param alarm: the alarm
+     */
+    void AlarmService::sendAlarmMessage(std::shared_ptr<Alarm> alarm) {
+      WRENCH_INFO("Alarm Service Sending a message to %s (%s)",
+                  alarm->reply_mailbox_name.c_str(), alarm->suffix.c_str());
+      SimulationMessage *msg = alarm->msg.release();
+      // Let the MessageManager manage the message, in case it is never received
+      MessageManager::manageMessage(alarm->reply_mailbox_name, msg);
+      try {
+        S4U_Mailbox::dputMessage(alarm->reply_mailbox_name, msg);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        WRENCH_WARN("AlarmService was not able to send the trigger to its upper service");
+      }
+    }
+
+    /**
+     * @brief Determine whether an alarm goes off before another one
+     *
+     * @param a: an alarm
+     * @param b: another alarm
+     * @return true if alarm a goes off first (alarms with the same date go off in the order in which they were armed)
+     */
+    bool AlarmService::precedes(const std::shared_ptr<Alarm> &a, const std::shared_ptr<Alarm> &b) {
+      if (a->date != b->date) {
+        return a->date < b->date;
+      }
+      return a->sequence_number < b->sequence_number;
+    }
+
+    /**
+     * @brief Swap two alarms in the heap
+     *
+     * @param i: a heap index
+     * @param j: another heap index
+     */
+    void AlarmService::swap(unsigned long i, unsigned long j) {
+      std::swap(this->heap[i], this->heap[j]);
+      this->heap[i]->heap_index = i;
+      this->heap[j]->heap_index = j;
+    }
+
+    /**
+     * @brief Move an alarm up the heap until the heap property is restored
+     *
+     * @param index: the alarm's heap index
+     */
+    void AlarmService::siftUp(unsigned long index) {
+      while (index > 0) {
+        unsigned long parent = (index - 1) / 2;
+        if (not this->precedes(this->heap[index], this->heap[parent])) {
+          break;
+        }
+        this->swap(index, parent);
+        index = parent;
+      }
+    }
+
+    /**
+     * @brief Move an alarm down the heap until the heap property is restored
+     *
+     * @param index: the alarm's heap index
+     */
+    void AlarmService::siftDown(unsigned long index) {
+      while (true) {
+        unsigned long smallest = index;
+        unsigned long left = 2 * index + 1;
+        unsigned long right = 2 * index + 2;
+        if ((left < this->heap.size()) and (this->precedes(this->heap[left], this->heap[smallest]))) {
+          smallest = left;
+        }
+        if ((right < this->heap.size()) and (this->precedes(this->heap[right], this->heap[smallest]))) {
+          smallest = right;
+        }
+        if (smallest == index) {
+          break;
+        }
+        this->swap(index, smallest);
+        index = smallest;
+      }
+    }
+
+};
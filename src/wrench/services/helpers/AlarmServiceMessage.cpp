@@ -0,0 +1,32 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "services/helpers/AlarmServiceMessage.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     *
+     * @param type: the message type
+     * @param name: the message name
+     * @param payload: the message size in bytes
+     */
+    AlarmServiceMessage::AlarmServiceMessage(SimulationMessage::Type type, std::string name, double payload) :
+            ServiceMessage(type, "AlarmServiceMessage::" + name, payload) {}
+
+    /**
+     * @brief Constructor
+     * @param payload: message size in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    AlarmServiceWakeUpMessage::AlarmServiceWakeUpMessage(double payload) : AlarmServiceMessage(SimulationMessage::ALARM_SERVICE_WAKE_UP, "WAKE_UP", payload) {}
+
+};
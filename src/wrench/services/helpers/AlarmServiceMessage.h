@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_ALARMSERVICEMESSAGE_H
+#define WRENCH_ALARMSERVICEMESSAGE_H
+
+#include "wrench/services/ServiceMessage.h"
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief Top-level class for messages received/sent by an AlarmService
+     */
+    class AlarmServiceMessage : public ServiceMessage {
+    protected:
+        AlarmServiceMessage(SimulationMessage::Type type, std::string name, double payload);
+    };
+
+    /**
+     * @brief A message sent to an AlarmService to tell it that an alarm with an earlier
+     *        date than that of all other armed alarms has been armed
+     */
+    class AlarmServiceWakeUpMessage : public AlarmServiceMessage {
+    public:
+        AlarmServiceWakeUpMessage(double payload);
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+};
+
+#endif //WRENCH_ALARMSERVICEMESSAGE_H
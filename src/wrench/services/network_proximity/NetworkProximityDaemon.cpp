@@ -155,6 +155,17 @@ namespace wrench {
 
             time_for_next_measurement = this->getTimeUntilNextMeasurement();
 
+            // Find out who to talk to next right away, so as to be ready for the next measurement
+            try {
+              S4U_Mailbox::dputMessage(this->network_proximity_service_mailbox,
+                                       new NextContactDaemonRequestMessage(this,
+                                                                           this->getMessagePayloadValueAsDouble(
+                                                                                   NetworkProximityServiceMessagePayload::NETWORK_DAEMON_CONTACT_REQUEST_PAYLOAD)));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+              // Couldn't find out who to talk to next... aborting
+              life = false;
+            }
+
           } else {
             time_for_next_measurement = this->getTimeUntilNextMeasurement();
 
@@ -185,7 +196,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name, timeout);
+        message = S4U_Mailbox::getMessage(this->mailbox, timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -197,33 +208,38 @@ namespace wrench {
 
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-      if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-        // This is Synchronous
-        try {
-          S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                  new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
-                                          NetworkProximityServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+      switch (message->type) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+          // This is Synchronous
+          try {
+            S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                    new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
+                                            NetworkProximityServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
+          }
           return false;
         }
-        return false;
-
-      } else if (auto msg = dynamic_cast<NextContactDaemonAnswerMessage *>(message.get())) {
 
-        this->next_host_to_send = msg->next_host_to_send;
-        this->next_mailbox_to_send = msg->next_mailbox_to_send;
-
-        return true;
+        case SimulationMessage::NEXT_CONTACT_DAEMON_ANSWER: {
+          auto msg = static_cast<NextContactDaemonAnswerMessage *>(message.get());
+          this->next_host_to_send = msg->next_host_to_send;
+          this->next_mailbox_to_send = msg->next_mailbox_to_send;
 
-      } else if (auto msg = dynamic_cast<NetworkProximityTransferMessage *>(message.get())) {
+          return true;
+        }
 
-        WRENCH_INFO("NetworkProximityTransferMessage: Got a [%s] message", message->getName().c_str());
-        return true;
+        case SimulationMessage::NETWORK_PROXIMITY_TRANSFER: {
+          WRENCH_INFO("NetworkProximityTransferMessage: Got a [%s] message", message->getName().c_str());
+          return true;
+        }
 
-      } else {
-        throw std::runtime_error(
-                "NetworkProximityService::waitForNextMessage(): Unknown message type: " +
-                std::to_string(message->payload));
+        default: {
+          throw std::runtime_error(
+                  "NetworkProximityService::waitForNextMessage(): Unknown message type: " +
+                  std::to_string(message->payload));
+        }
       }
     }
 
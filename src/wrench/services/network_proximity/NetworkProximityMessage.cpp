@@ -12,11 +12,12 @@
 namespace wrench {
     /**
      * @brief Constructor
+     * @param type: the message type
      * @param name: the message name
      * @param payload: the message size in bytes
      */
-    NetworkProximityMessage::NetworkProximityMessage(std::string name, double payload) :
-            ServiceMessage("NetworkProximity::" + name, payload) {
+    NetworkProximityMessage::NetworkProximityMessage(SimulationMessage::Type type, std::string name, double payload) :
+            ServiceMessage(type, "NetworkProximity::" + name, payload) {
     }
 
 
@@ -29,7 +30,7 @@ namespace wrench {
     NetworkProximityLookupRequestMessage::NetworkProximityLookupRequestMessage(std::string answer_mailbox,
                                                                                std::pair<std::string, std::string> hosts,
                                                                                double payload) :
-            NetworkProximityMessage("PROXIMITY_LOOKUP_REQUEST", payload) {
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_LOOKUP_REQUEST, "PROXIMITY_LOOKUP_REQUEST", payload) {
 
       if ((answer_mailbox == "") || (std::get<0>(hosts) == "") || (std::get<1>(hosts) == "")) {
         throw std::invalid_argument(
@@ -48,7 +49,7 @@ namespace wrench {
      */
     NetworkProximityLookupAnswerMessage::NetworkProximityLookupAnswerMessage(std::pair<std::string, std::string> hosts,
                                                                              double proximityvalue, double payload) :
-            NetworkProximityMessage("PROXIMITY_LOOKUP_ANSWER", payload) {
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_LOOKUP_ANSWER, "PROXIMITY_LOOKUP_ANSWER", payload) {
       if ((std::get<0>(hosts) == "") || (std::get<1>(hosts) == "")) {
         throw std::invalid_argument(
                 "NetworkProximityLookupAnswerMessage::NetworkProximityLookupAnswerMessage(): Invalid argument");
@@ -57,6 +58,73 @@ namespace wrench {
       this->proximityValue = proximityvalue;
     }
 
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param reference_host: the host from which proximity values are calculated
+     * @param hosts: the hosts whose proximity to the reference host should be calculated
+     * @param payload: the message size in bytes
+     */
+    NetworkProximityBulkLookupRequestMessage::NetworkProximityBulkLookupRequestMessage(std::string answer_mailbox,
+                                                                                       std::string reference_host,
+                                                                                       std::vector<std::string> hosts,
+                                                                                       double payload) :
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_BULK_LOOKUP_REQUEST, "PROXIMITY_BULK_LOOKUP_REQUEST", payload) {
+
+      if ((answer_mailbox == "") || (reference_host == "")) {
+        throw std::invalid_argument(
+                "NetworkProximityBulkLookupRequestMessage::NetworkProximityBulkLookupRequestMessage(): Invalid argument");
+      }
+      this->answer_mailbox = answer_mailbox;
+      this->reference_host = reference_host;
+      this->hosts = std::move(hosts);
+    }
+
+
+    /**
+     * @brief Constructor
+     * @param reference_host: the host from which proximity values were calculated
+     * @param proximity_values: the proximity values, in the order of the hosts in the request
+     * @param payload: the message size in bytes
+     */
+    NetworkProximityBulkLookupAnswerMessage::NetworkProximityBulkLookupAnswerMessage(std::string reference_host,
+                                                                                     std::vector<double> proximity_values,
+                                                                                     double payload) :
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_BULK_LOOKUP_ANSWER, "PROXIMITY_BULK_LOOKUP_ANSWER", payload) {
+      if (reference_host == "") {
+        throw std::invalid_argument(
+                "NetworkProximityBulkLookupAnswerMessage::NetworkProximityBulkLookupAnswerMessage(): Invalid argument");
+      }
+      this->reference_host = reference_host;
+      this->proximity_values = std::move(proximity_values);
+    }
+
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param payload: the message size in bytes
+     */
+    NetworkProximityAllLookupRequestMessage::NetworkProximityAllLookupRequestMessage(std::string answer_mailbox,
+                                                                                     double payload) :
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_ALL_LOOKUP_REQUEST, "PROXIMITY_ALL_LOOKUP_REQUEST", payload) {
+      if (answer_mailbox == "") {
+        throw std::invalid_argument(
+                "NetworkProximityAllLookupRequestMessage::NetworkProximityAllLookupRequestMessage(): Invalid argument");
+      }
+      this->answer_mailbox = answer_mailbox;
+    }
+
+    /**
+     * @brief Constructor
+     * @param proximity_values: the proximity values, as a row-major matrix in the order of the monitored hosts
+     * @param payload: the message size in bytes
+     */
+    NetworkProximityAllLookupAnswerMessage::NetworkProximityAllLookupAnswerMessage(std::vector<double> proximity_values,
+                                                                                   double payload) :
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_ALL_LOOKUP_ANSWER, "PROXIMITY_ALL_LOOKUP_ANSWER", payload) {
+      this->proximity_values = std::move(proximity_values);
+    }
+
     /**
      * @brief Constructor
      * @param hosts: a pair of hosts
@@ -65,7 +133,7 @@ namespace wrench {
      */
     NetworkProximityComputeAnswerMessage::NetworkProximityComputeAnswerMessage(
             std::pair<std::string, std::string> hosts, double proximityvalue, double payload) :
-            NetworkProximityMessage("PROXIMITY_COMPUTE_ANSWER", payload) {
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_COMPUTE_ANSWER, "PROXIMITY_COMPUTE_ANSWER", payload) {
       if ((std::get<0>(hosts) == "") || (std::get<1>(hosts) == "")) {
         throw std::invalid_argument(
                 "NetworkProximityComputeAnswerMessage::NetworkProximityComputeAnswerMessage(): Invalid argument");
@@ -81,7 +149,7 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     NextContactDaemonRequestMessage::NextContactDaemonRequestMessage(NetworkProximityDaemon *daemon, double payload) :
-            NetworkProximityMessage("NEXT_CONTACT_DAEMON_REQUEST", payload) {
+            NetworkProximityMessage(SimulationMessage::NEXT_CONTACT_DAEMON_REQUEST, "NEXT_CONTACT_DAEMON_REQUEST", payload) {
       if (daemon == nullptr) {
         throw std::invalid_argument(
                 "NextContactDaemonRequestMessage::NextContactDaemonRequestMessage(): Invalid argument");
@@ -97,7 +165,7 @@ namespace wrench {
      */
     NextContactDaemonAnswerMessage::NextContactDaemonAnswerMessage(std::string next_host_to_send,
                                                                    std::string next_mailbox_to_send, double payload) :
-            NetworkProximityMessage("NEXT_CONTACT_DAEMON_ANSWER", payload) {
+            NetworkProximityMessage(SimulationMessage::NEXT_CONTACT_DAEMON_ANSWER, "NEXT_CONTACT_DAEMON_ANSWER", payload) {
       this->next_host_to_send = next_host_to_send;
       this->next_mailbox_to_send = next_mailbox_to_send;
     }
@@ -108,7 +176,7 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     NetworkProximityTransferMessage::NetworkProximityTransferMessage(double payload) :
-            NetworkProximityMessage("NETWORK_PROXIMITY_TRANSFER", payload) {
+            NetworkProximityMessage(SimulationMessage::NETWORK_PROXIMITY_TRANSFER, "NETWORK_PROXIMITY_TRANSFER", payload) {
     }
 
     /**
@@ -119,7 +187,7 @@ namespace wrench {
      */
     CoordinateLookupRequestMessage::CoordinateLookupRequestMessage(std::string answer_mailbox,
                                                                    std::string requested_host, double payload) :
-            NetworkProximityMessage("COORDINATE_LOOKUP_REQUEST", payload) {
+            NetworkProximityMessage(SimulationMessage::COORDINATE_LOOKUP_REQUEST, "COORDINATE_LOOKUP_REQUEST", payload) {
       if (answer_mailbox == "" || requested_host == "") {
         throw std::invalid_argument(
                 "CoordinateLookupRequestMessage::CoordinateLookupRequestMessage(): Invalid argument");
@@ -137,7 +205,7 @@ namespace wrench {
     CoordinateLookupAnswerMessage::CoordinateLookupAnswerMessage(std::string requested_host,
                                                                  std::pair<double, double> xy_coordinate,
                                                                  double payload) :
-            NetworkProximityMessage("COORDINATE_LOOKUP_ANSWER", payload) {
+            NetworkProximityMessage(SimulationMessage::COORDINATE_LOOKUP_ANSWER, "COORDINATE_LOOKUP_ANSWER", payload) {
       if (requested_host == "") {
         throw std::invalid_argument("CoordinateLookupAnswerMessage::CoordinateLookupAnswerMessage(): Invalid argument");
       }
@@ -24,7 +24,7 @@ namespace wrench {
      */
     class NetworkProximityMessage : public ServiceMessage {
     protected:
-        NetworkProximityMessage(std::string name, double payload);
+        NetworkProximityMessage(SimulationMessage::Type type, std::string name, double payload);
 
     };
 
@@ -57,6 +57,65 @@ namespace wrench {
     };
 
 
+    /**
+     * @brief A message sent to a NetworkProximityService to request the proximity values between
+     *        a reference host and a list of hosts
+     */
+    class NetworkProximityBulkLookupRequestMessage : public NetworkProximityMessage {
+    public:
+        NetworkProximityBulkLookupRequestMessage(std::string answer_mailbox, std::string reference_host,
+                                                 std::vector<std::string> hosts, double payload);
+
+        /** @brief The mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+        /** @brief The host from which proximity values are calculated */
+        std::string reference_host;
+        /** @brief The hosts whose proximity to the reference host should be calculated */
+        std::vector<std::string> hosts;
+    };
+
+
+    /**
+     * @brief A message sent by a NetworkProximityService in answer to a bulk network proximity lookup request
+     */
+    class NetworkProximityBulkLookupAnswerMessage : public NetworkProximityMessage {
+    public:
+        NetworkProximityBulkLookupAnswerMessage(std::string reference_host, std::vector<double> proximity_values,
+                                                double payload);
+
+        /** @brief The host from which proximity values were calculated */
+        std::string reference_host;
+        /** @brief The calculated proximity values, in the order of the hosts in the request */
+        std::vector<double> proximity_values;
+    };
+
+
+    /**
+     * @brief A message sent to a NetworkProximityService to request the proximity values between all
+     *        pairs of monitored hosts
+     */
+    class NetworkProximityAllLookupRequestMessage : public NetworkProximityMessage {
+    public:
+        NetworkProximityAllLookupRequestMessage(std::string answer_mailbox, double payload);
+
+        /** @brief The mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+    };
+
+
+    /**
+     * @brief A message sent by a NetworkProximityService in answer to a request for the proximity values
+     *        between all pairs of monitored hosts
+     */
+    class NetworkProximityAllLookupAnswerMessage : public NetworkProximityMessage {
+    public:
+        NetworkProximityAllLookupAnswerMessage(std::vector<double> proximity_values, double payload);
+
+        /** @brief The calculated proximity values, as a row-major matrix in the order of the monitored hosts */
+        std::vector<double> proximity_values;
+    };
+
+
     /**
      * @brief A message received by a NetworkProximityService that updates its database of proximity values
      */
@@ -16,6 +16,8 @@
 #include "NetworkProximityMessage.h"
 
 #include <wrench/exceptions/WorkflowExecutionException.h>
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <fstream>
 #include <limits>
@@ -62,6 +64,20 @@ namespace wrench {
 
       validateProperties();
 
+      // Index the hosts, and set up the proximity matrix (alltoall) or the coordinates (vivaldi)
+      for (auto const &h : this->hosts_in_network) {
+        this->host_indices.insert(std::make_pair(h, this->host_indices.size()));
+      }
+      unsigned long num_hosts = this->host_indices.size();
+      this->is_vivaldi = boost::iequals(
+              this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE), "vivaldi");
+      if (this->is_vivaldi) {
+        this->coordinates_x.assign(num_hosts, 0.0);
+        this->coordinates_y.assign(num_hosts, 0.0);
+      } else {
+        this->proximity_matrix.assign(num_hosts * num_hosts, NetworkProximityService::NOT_AVAILABLE);
+      }
+
       // Seed the master_rng
       this->master_rng.seed((unsigned int)(this->getPropertyValueAsDouble(wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_PEER_LOOKUP_SEED)));
     }
@@ -89,11 +105,11 @@ namespace wrench {
 
       WRENCH_INFO("Obtaining current coordinates of network daemon on host %s", requested_host.c_str());
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("network_get_coordinate_entry");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new CoordinateLookupRequestMessage(answer_mailbox, requested_host,
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new CoordinateLookupRequestMessage(answer_mailbox.getName(), requested_host,
                                                                    this->getMessagePayloadValueAsDouble(
                                                                            NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -103,10 +119,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<CoordinateLookupAnswerMessage *>(message.get())) {
         return msg->xy_coordinate;
@@ -140,11 +157,11 @@ namespace wrench {
                     hosts.second.c_str());
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("network_query_entry");
+      S4U_ReplyMailbox answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new NetworkProximityLookupRequestMessage(answer_mailbox, std::move(hosts),
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new NetworkProximityLookupRequestMessage(answer_mailbox.getName(), std::move(hosts),
                                                                          this->getMessagePayloadValueAsDouble(
                                                                                  NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -154,10 +171,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<NetworkProximityLookupAnswerMessage *>(message.get())) {
         return msg->proximityValue;
@@ -168,18 +186,203 @@ namespace wrench {
     }
 
     /**
-     * @brief Internal method to add an entry to the database
-     * @param pair: a pair of hosts
-     * @param proximity_value: proximity value between the pair of hosts
+     * @brief Look up the proximity values between a reference host and a list of hosts, in
+     *        a single request to the service
+     * @param reference_host: the host from which proximity values are of interest
+     * @param hosts: the hosts whose proximity to the reference host is of interest
+     * @return The proximity values between the reference host and each host, in the order of the hosts
+     *         (NetworkProximityService::NOT_AVAILABLE for hosts for which no estimate is available)
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
      */
-    void NetworkProximityService::addEntryToDatabase(std::pair<std::string, std::string> pair_hosts,
-                                                     double proximity_value) {
-      if (this->entries.find(pair_hosts) != this->entries.end()) {
-        std::pair<std::pair<std::string, std::string>, double> value = std::make_pair(pair_hosts, proximity_value);
-        this->entries.insert(value);
+    std::vector<double> NetworkProximityService::queryMany(std::string reference_host, std::vector<std::string> hosts) {
+
+      if (this->state == DOWN) {
+        throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
+      }
+
+      if (hosts.empty()) {
+        return {};
+      }
+
+      WRENCH_INFO("Obtaining the proximity values between %s and %ld hosts", reference_host.c_str(), hosts.size());
+
+      S4U_ReplyMailbox answer_mailbox;
+
+      try {
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new NetworkProximityBulkLookupRequestMessage(answer_mailbox.getName(), std::move(reference_host),
+                                                                             std::move(hosts),
+                                                                             this->getMessagePayloadValueAsDouble(
+                                                                                     NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+
+      std::unique_ptr<SimulationMessage> message = nullptr;
+
+      try {
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+      answer_mailbox.release();
+
+      if (auto msg = dynamic_cast<NetworkProximityBulkLookupAnswerMessage *>(message.get())) {
+        return std::move(msg->proximity_values);
       } else {
-        this->entries[pair_hosts] = proximity_value;
+        throw std::runtime_error(
+                "NetworkProximityService::queryMany(): Unexpected [" + message->getName() + "] message");
+      }
+    }
+
+    /**
+     * @brief Look up the proximity values between all pairs of monitored hosts, in a single request
+     *        to the service
+     * @return The proximity values, as a row-major matrix whose rows and columns are in the order
+     *         of the monitored hosts (see getHostnameList()), with NetworkProximityService::NOT_AVAILABLE
+     *         for pairs of hosts for which no estimate is available
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    std::vector<double> NetworkProximityService::queryAll() {
+
+      if (this->state == DOWN) {
+        throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
+      }
+
+      WRENCH_INFO("Obtaining the proximity values between all pairs of hosts");
+
+      S4U_ReplyMailbox answer_mailbox;
+
+      try {
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new NetworkProximityAllLookupRequestMessage(answer_mailbox.getName(),
+                                                                            this->getMessagePayloadValueAsDouble(
+                                                                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+
+      std::unique_ptr<SimulationMessage> message = nullptr;
+
+      try {
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+      answer_mailbox.release();
+
+      if (auto msg = dynamic_cast<NetworkProximityAllLookupAnswerMessage *>(message.get())) {
+        return std::move(msg->proximity_values);
+      } else {
+        throw std::runtime_error(
+                "NetworkProximityService::queryAll(): Unexpected [" + message->getName() + "] message");
+      }
+    }
+
+    /**
+     * @brief Internal method to compute the current proximity value between two hosts
+     * @param hosts: a pair of hosts
+     * @return The proximity value between the pair of hosts (NetworkProximityService::NOT_AVAILABLE if
+     *         no estimate is available)
+     */
+    double NetworkProximityService::getProximityValue(const std::pair<std::string, std::string> &hosts) {
+
+      long index1 = this->getHostIndex(hosts.first);
+      long index2 = this->getHostIndex(hosts.second);
+      if ((index1 < 0) or (index2 < 0)) {
+        return NetworkProximityService::NOT_AVAILABLE;
+      }
+
+      if (this->is_vivaldi) {
+        double dx = this->coordinates_x[index2] - this->coordinates_x[index1];
+        double dy = this->coordinates_y[index2] - this->coordinates_y[index1];
+        return std::sqrt(dx * dx + dy * dy);
+      } else { // alltoall
+        return this->proximity_matrix[index1 * this->host_indices.size() + index2];
+      }
+    }
+
+    /**
+     * @brief Internal method to compute the current proximity values between a host and all monitored hosts
+     * @param reference_index: the index of the host
+     * @param proximity_values: the array, of one element per monitored host, in which to write the proximity
+     *        values (in host index order)
+     */
+    void NetworkProximityService::computeProximityValues(unsigned long reference_index, double *proximity_values) {
+
+      unsigned long num_hosts = this->host_indices.size();
+
+      if (this->is_vivaldi) {
+        // A loop over contiguous arrays without branches, which the compiler can vectorize
+        const double x = this->coordinates_x[reference_index];
+        const double y = this->coordinates_y[reference_index];
+        const double *coordinates_x = this->coordinates_x.data();
+        const double *coordinates_y = this->coordinates_y.data();
+        for (unsigned long i = 0; i < num_hosts; i++) {
+          double dx = coordinates_x[i] - x;
+          double dy = coordinates_y[i] - y;
+          proximity_values[i] = std::sqrt(dx * dx + dy * dy);
+        }
+      } else { // alltoall
+        auto row = this->proximity_matrix.cbegin() + reference_index * num_hosts;
+        std::copy(row, row + num_hosts, proximity_values);
+      }
+    }
+
+    /**
+     * @brief Internal method to compute the current proximity values between all pairs of monitored hosts
+     * @param proximity_values: the array, of one element per pair of monitored hosts, in which to write the
+     *        proximity values (as a row-major matrix in host index order)
+     */
+    void NetworkProximityService::computeAllProximityValues(double *proximity_values) {
+
+      if (this->is_vivaldi) {
+        NetworkProximityService::computeAllProximityValues(this->coordinates_x.data(), this->coordinates_y.data(),
+                                                           this->host_indices.size(), proximity_values);
+      } else { // alltoall
+        std::copy(this->proximity_matrix.cbegin(), this->proximity_matrix.cend(), proximity_values);
+      }
+    }
+
+    /**
+     * @brief Compute the Euclidean distances between all pairs of points, in one pass over
+     *        their coordinates (each row is a loop over contiguous arrays without branches,
+     *        which the compiler can vectorize)
+     * @param coordinates_x: the x coordinates of the points
+     * @param coordinates_y: the y coordinates of the points
+     * @param num_hosts: the number of points
+     * @param proximity_values: the array, of num_hosts * num_hosts elements, in which to write the
+     *        distances (as a row-major matrix)
+     */
+    void NetworkProximityService::computeAllProximityValues(const double *coordinates_x, const double *coordinates_y,
+                                                            unsigned long num_hosts, double *proximity_values) {
+      for (unsigned long i = 0; i < num_hosts; i++) {
+        const double x = coordinates_x[i];
+        const double y = coordinates_y[i];
+        double *row = proximity_values + i * num_hosts;
+        for (unsigned long j = 0; j < num_hosts; j++) {
+          double dx = coordinates_x[j] - x;
+          double dy = coordinates_y[j] - y;
+          row[j] = std::sqrt(dx * dx + dy * dy);
+        }
+      }
+    }
+
+    /**
+     * @brief Internal method to get the index of a monitored host
+     * @param hostname: the name of the host
+     * @return the index of the host, or -1 if the host is not monitored
+     */
+    long NetworkProximityService::getHostIndex(const std::string &hostname) {
+      auto it = this->host_indices.find(hostname);
+      if (it == this->host_indices.end()) {
+        return -1;
       }
+      return (long) it->second;
     }
 
     /**
@@ -205,12 +408,8 @@ namespace wrench {
                                                    NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD_MAX_NOISE),
                                             this->messagepayload_list));
         this->network_daemons.push_back(np_daemon);
-
-        // if this network service type is 'vivaldi', setup the coordinate lookup table
-        if (boost::iequals(this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE), "vivaldi")) {
-          this->coordinate_lookup_table.insert(std::pair<std::string, std::complex<double>>(h, (0.0)));
-        }
       }
+      this->setUpMeasurementSchedule();
 
       // Start all network daemons
       try {
@@ -236,7 +435,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(this->mailbox_name);
+        message = S4U_Mailbox::getMessage(this->mailbox);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -248,187 +447,245 @@ namespace wrench {
 
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-      if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-
-        // This is Synchronous
-        try {
-          //Stop the network daemons
-          std::vector<std::shared_ptr<NetworkProximityDaemon>>::iterator it;
-          for (it = this->network_daemons.begin(); it != this->network_daemons.end(); it++) {
-            if ((*it)->isUp()) {
-              (*it)->stop();
+      switch (message->type) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+          // This is Synchronous
+          try {
+            //Stop the network daemons
+            std::vector<std::shared_ptr<NetworkProximityDaemon>>::iterator it;
+            for (it = this->network_daemons.begin(); it != this->network_daemons.end(); it++) {
+              if ((*it)->isUp()) {
+                (*it)->stop();
+              }
             }
+            this->network_daemons.clear();
+            this->hosts_in_network.clear();
+            S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                    new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
+                                            NetworkProximityServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
           }
-          this->network_daemons.clear();
-          this->hosts_in_network.clear();
-          S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                  new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
-                                          NetworkProximityServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-          return false;
+          break;
         }
 
-      } else if (NetworkProximityLookupRequestMessage *msg = dynamic_cast<NetworkProximityLookupRequestMessage *>(message.get())) {
-        double proximityValue = NetworkProximityService::NOT_AVAILABLE;
+        case SimulationMessage::NETWORK_PROXIMITY_LOOKUP_REQUEST: {
+          auto msg = static_cast<NetworkProximityLookupRequestMessage *>(message.get());
+          double proximityValue = this->getProximityValue(msg->hosts);
 
-        std::string network_service_type = this->getPropertyValueAsString("NETWORK_PROXIMITY_SERVICE_TYPE");
-
-        if (boost::iequals(network_service_type, "vivaldi")) {
-          auto host1 = this->coordinate_lookup_table.find(msg->hosts.first);
-          auto host2 = this->coordinate_lookup_table.find(msg->hosts.second);
-
-          if (host1 != this->coordinate_lookup_table.end() && host2 != this->coordinate_lookup_table.end()) {
-            proximityValue = std::sqrt(norm(host2->second - host1->second));
+          try {
+            //auto proximity_msg = dynamic_cast<NetworkProximityComputeAnswerMessage *>(message.get());
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new NetworkProximityLookupAnswerMessage(msg->hosts, proximityValue,
+                                                                             this->getMessagePayloadValueAsDouble(
+                                                                                     NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
           }
-        } else { // alltoall
-          if (this->entries.find(msg->hosts) != this->entries.end()) {
-            proximityValue = this->entries[msg->hosts];
-            //this->addEntryToDatabase(msg->hosts,proximityValue);
+          catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
           }
+          return true;
         }
 
-        try {
-          //auto proximity_msg = dynamic_cast<NetworkProximityComputeAnswerMessage *>(message.get());
-          S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                   new NetworkProximityLookupAnswerMessage(msg->hosts, proximityValue,
-                                                                           this->getMessagePayloadValueAsDouble(
-                                                                                   NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-        }
-        catch (std::shared_ptr<NetworkError> &cause) {
+        case SimulationMessage::NETWORK_PROXIMITY_BULK_LOOKUP_REQUEST: {
+          auto msg = static_cast<NetworkProximityBulkLookupRequestMessage *>(message.get());
+          std::vector<double> proximity_values(msg->hosts.size(), NetworkProximityService::NOT_AVAILABLE);
+          long reference_index = this->getHostIndex(msg->reference_host);
+          if (reference_index >= 0) {
+            // Compute the proximity values from the reference host to all hosts at once
+            std::vector<double> all_proximity_values(this->host_indices.size());
+            this->computeProximityValues((unsigned long) reference_index, all_proximity_values.data());
+            for (unsigned long i = 0; i < msg->hosts.size(); i++) {
+              long index = this->getHostIndex(msg->hosts[i]);
+              if (index >= 0) {
+                proximity_values[i] = all_proximity_values[index];
+              }
+            }
+          }
+
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new NetworkProximityBulkLookupAnswerMessage(msg->reference_host,
+                                                                                 std::move(proximity_values),
+                                                                                 this->getMessagePayloadValueAsDouble(
+                                                                                         NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
           return true;
         }
-        return true;
 
-      } else if (auto msg = dynamic_cast<NetworkProximityComputeAnswerMessage *>(message.get())) {
-        WRENCH_INFO(
-                "NetworkProximityService::processNextMessage()::Adding proximity value between %s and %s into the database",
-                msg->hosts.first.c_str(), msg->hosts.second.c_str());
-        this->addEntryToDatabase(msg->hosts, msg->proximityValue);
+        case SimulationMessage::NETWORK_PROXIMITY_ALL_LOOKUP_REQUEST: {
+          auto msg = static_cast<NetworkProximityAllLookupRequestMessage *>(message.get());
+          unsigned long num_hosts = this->host_indices.size();
+          std::vector<double> proximity_values(num_hosts * num_hosts);
+          this->computeAllProximityValues(proximity_values.data());
 
-        if (boost::iequals(
-                this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
-                "vivaldi")) {
-          vivaldiUpdate(msg->proximityValue, msg->hosts.first, msg->hosts.second);
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new NetworkProximityAllLookupAnswerMessage(std::move(proximity_values),
+                                                                                this->getMessagePayloadValueAsDouble(
+                                                                                        NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
+          return true;
         }
 
-        return true;
+        case SimulationMessage::NETWORK_PROXIMITY_COMPUTE_ANSWER: {
+          auto msg = static_cast<NetworkProximityComputeAnswerMessage *>(message.get());
+          WRENCH_INFO(
+                  "NetworkProximityService::processNextMessage()::Adding proximity value between %s and %s into the database",
+                  msg->hosts.first.c_str(), msg->hosts.second.c_str());
+          long sender_index = this->getHostIndex(msg->hosts.first);
+          long peer_index = this->getHostIndex(msg->hosts.second);
+          if ((sender_index < 0) or (peer_index < 0)) {
+            return true;
+          }
+
+          if (this->is_vivaldi) {
+            NetworkProximityService::vivaldiUpdate(msg->proximityValue, this->coordinates_x.data(),
+                                                   this->coordinates_y.data(),
+                                                   (unsigned long) sender_index, (unsigned long) peer_index);
+          } else {
+            this->proximity_matrix[sender_index * this->host_indices.size() + peer_index] = msg->proximityValue;
+          }
 
-      } else if (auto msg = dynamic_cast<NextContactDaemonRequestMessage *>(message.get())) {
+          return true;
+        }
 
-        std::shared_ptr<NetworkProximityDaemon> chosen_peer = NetworkProximityService::getCommunicationPeer(
-                msg->daemon);
+        case SimulationMessage::NEXT_CONTACT_DAEMON_REQUEST: {
+          auto msg = static_cast<NextContactDaemonRequestMessage *>(message.get());
+          std::shared_ptr<NetworkProximityDaemon> chosen_peer = NetworkProximityService::getCommunicationPeer(
+                  msg->daemon);
 
 //            unsigned long randNum = (std::rand()%(this->hosts_in_network.size()));
 
-        try {
-          S4U_Mailbox::dputMessage(msg->daemon->mailbox_name,
-                                   new NextContactDaemonAnswerMessage(chosen_peer->getHostname(),
-                                                                      chosen_peer->mailbox_name,
-                                                                      this->getMessagePayloadValueAsDouble(
-                                                                              NetworkProximityServiceMessagePayload::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-          return true;
-        }
-        return true;
-      } else if (auto msg = dynamic_cast<CoordinateLookupRequestMessage *> (message.get())) {
-        std::string requested_host = msg->requested_host;
-        auto const coordinate_itr = this->coordinate_lookup_table.find(requested_host);
-        if (coordinate_itr != this->coordinate_lookup_table.cend()) {
           try {
-            S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                     new CoordinateLookupAnswerMessage(requested_host,
-                                                                       std::make_pair(
-                                                                               coordinate_itr->second.real(),
-                                                                               coordinate_itr->second.imag()),
-                                                                       this->getMessagePayloadValueAsDouble(
-                                                                               NetworkProximityServiceMessagePayload::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)));
+            S4U_Mailbox::dputMessage(msg->daemon->mailbox,
+                                     new NextContactDaemonAnswerMessage(chosen_peer->getHostname(),
+                                                                        chosen_peer->mailbox_name,
+                                                                        this->getMessagePayloadValueAsDouble(
+                                                                                NetworkProximityServiceMessagePayload::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)));
           } catch (std::shared_ptr<NetworkError> &cause) {
             return true;
           }
+          return true;
+        }
+
+        case SimulationMessage::COORDINATE_LOOKUP_REQUEST: {
+          auto msg = static_cast<CoordinateLookupRequestMessage *>(message.get());
+          std::string requested_host = msg->requested_host;
+          long index = this->getHostIndex(requested_host);
+          if (this->is_vivaldi and (index >= 0)) {
+            try {
+              S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                       new CoordinateLookupAnswerMessage(requested_host,
+                                                                         std::make_pair(
+                                                                                 this->coordinates_x[index],
+                                                                                 this->coordinates_y[index]),
+                                                                         this->getMessagePayloadValueAsDouble(
+                                                                                 NetworkProximityServiceMessagePayload::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+              return true;
+            }
+          }
+          return true;
+        }
+
+        default: {
+          throw std::runtime_error(
+                  "NetworkProximityService::processNextMessage(): Unknown message type: " +
+                  std::to_string(message->payload));
         }
-        return true;
-      } else {
-        throw std::runtime_error(
-                "NetworkProximityService::processNextMessage(): Unknown message type: " +
-                std::to_string(message->payload));
       }
       return false;
     }
 
     /**
-     * @brief Internal method to choose a communication peer for the requesting network proximity daemon
-     * @param sender_daemon: the network daemon requesting a peer to communicate with next
-     * @return a shared_ptr to the network daemon that is the selected communication peer
+     * @brief Internal method to set up the schedule according to which network proximity daemons
+     *        pick their communication peers.
+     *
+     *        Each daemon goes round-robin through a pool of peers that is a fraction (the coverage) of all
+     *        the other daemons, so that it measures its proximity to each of its peers within a number of
+     *        measurements equal to the size of the pool. The pools are rotations of one another: the i-th daemon's
+     *        peers are the daemons at offsets i+o (modulo the number of daemons) for the same randomly
+     *        picked set of offsets o. Daemons go through the offsets in the same order, so that
+     *        at each round of measurements each daemon is the peer of exactly one daemon.
      */
-    std::shared_ptr<NetworkProximityDaemon>
-    NetworkProximityService::getCommunicationPeer(const NetworkProximityDaemon * sender_daemon) {
+    void NetworkProximityService::setUpMeasurementSchedule() {
 
-      WRENCH_INFO("Obtaining communication peer for %s", sender_daemon->mailbox_name.c_str());
+      unsigned long num_daemons = this->network_daemons.size();
 
       // coverage will be (0 < coverage <= 1.0) if this is a 'vivaldi' network service
       // else if it is an 'alltoall' network service, coverage is set at 1.0
-      double coverage = this->getPropertyValueAsDouble("NETWORK_DAEMON_COMMUNICATION_COVERAGE");
-      unsigned long max_pool_size = this->network_daemons.size() - 1;
+      double coverage = this->getPropertyValueAsDouble(NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE);
+      unsigned long max_pool_size = num_daemons - 1;
+      unsigned long pool_size = std::max<unsigned long>(1, (unsigned long) (std::ceil(coverage * max_pool_size)));
 
-      // if the network_service type is 'alltoall', sender_daemon selects from a pool of all other network daemons
-      // if the network_service type is 'vivaldi', sender_daemon selects from a subset of the max_pool_size
-      unsigned long pool_size = (unsigned long) (std::ceil(coverage * max_pool_size));
+      this->peer_offsets.clear();
+      for (unsigned long offset = 1; offset < num_daemons; offset++) {
+        this->peer_offsets.push_back(offset);
+      }
+      std::shuffle(this->peer_offsets.begin(), this->peer_offsets.end(), this->master_rng);
+      this->peer_offsets.resize(pool_size);
 
-      std::hash<std::string> hash_func;
-      std::default_random_engine sender_rng;
-      // uniform distribution to be used by the sending daemon's rng
-      std::uniform_int_distribution<unsigned long> s_udist;
+      this->next_peer_offset_positions.assign(num_daemons, 0);
+      this->daemon_indices.clear();
+      for (unsigned long index = 0; index < num_daemons; index++) {
+        this->daemon_indices.insert(std::make_pair(this->network_daemons[index].get(), index));
+      }
+    }
 
-      // uniform distribution to be used by master rng
-      static std::uniform_int_distribution<unsigned long> m_udist(0, pool_size - 1);
+    /**
+     * @brief Internal method to choose a communication peer for the requesting network proximity daemon
+     * @param sender_daemon: the network daemon requesting a peer to communicate with next
+     * @return a shared_ptr to the network daemon that is the selected communication peer
+     */
+    std::shared_ptr<NetworkProximityDaemon>
+    NetworkProximityService::getCommunicationPeer(const NetworkProximityDaemon * sender_daemon) {
 
-      std::vector<unsigned long> peer_list;
+      WRENCH_INFO("Obtaining communication peer for %s", sender_daemon->mailbox_name.c_str());
 
-      // all the network daemons EXCEPT the sender get pushed into this vector
-      for (unsigned long index = 0; index < this->network_daemons.size(); ++index) {
-        if (this->network_daemons[index]->mailbox_name != sender_daemon->mailbox_name) {
-          peer_list.push_back(index);
-        }
+      auto it = this->daemon_indices.find(sender_daemon);
+      if (it == this->daemon_indices.end()) {
+        throw std::runtime_error("NetworkProximityService::getCommunicationPeer(): Unknown network daemon " +
+                                 sender_daemon->mailbox_name);
       }
+      unsigned long sender_index = it->second;
 
-      // set the seed unique to the sending daemon
-      sender_rng.seed((unsigned long) hash_func(sender_daemon->mailbox_name));
-
-      std::shuffle(peer_list.begin(), peer_list.end(), sender_rng);
+      unsigned long &position = this->next_peer_offset_positions[sender_index];
+      unsigned long offset = this->peer_offsets[position];
+      position = (position + 1) % this->peer_offsets.size();
 
-      unsigned long chosen_peer_index = peer_list.at(m_udist(master_rng));
-
-      return std::shared_ptr<NetworkProximityDaemon>(this->network_daemons.at(chosen_peer_index));
+      return this->network_daemons[(sender_index + offset) % this->network_daemons.size()];
     }
 
     /**
-     * @brief Internal method to compute and update coordinates based on Vivaldi algorithm
+     * @brief Compute and update coordinates based on Vivaldi algorithm
      * @param proximity_value: one way elapsed time to send a message from the sender to the receiving peer
-     * @param sender_hostname: the host at which the sending network daemon resides
-     * @param peer_hostname: the host at which the receiving network daemon resides
+     * @param coordinates_x: the x coordinates of the hosts
+     * @param coordinates_y: the y coordinates of the hosts
+     * @param sender_index: the index of the host at which the sending network daemon resides
+     * @param peer_index: the index of the host at which the receiving network daemon resides
      */
-    void NetworkProximityService::vivaldiUpdate(double proximity_value, std::string sender_hostname,
-                                                std::string peer_hostname) {
-
-      const std::complex<double> sensitivity(0.25, 0.25);
+    void NetworkProximityService::vivaldiUpdate(double proximity_value, double *coordinates_x, double *coordinates_y,
+                                                unsigned long sender_index, unsigned long peer_index) {
 
-      std::complex<double> sender_coordinates, peer_coordinates;
+      // The sensitivity is the complex number (0.25, 0.25), by which the scaled direction is multiplied
+      const double sensitivity = 0.25;
 
-      auto search = this->coordinate_lookup_table.find(
-              sender_hostname);
-      if (search != this->coordinate_lookup_table.end()) {
-        sender_coordinates = search->second;
-      }
-
-      search = this->coordinate_lookup_table.find(peer_hostname);
-      if (search != this->coordinate_lookup_table.end()) {
-        peer_coordinates = search->second;
-      }
+      const double sender_x = coordinates_x[sender_index];
+      const double sender_y = coordinates_y[sender_index];
+      const double peer_x = coordinates_x[peer_index];
+      const double peer_y = coordinates_y[peer_index];
 
-      double estimated_distance = std::sqrt(norm(peer_coordinates - sender_coordinates));
+      double dx = peer_x - sender_x;
+      double dy = peer_y - sender_y;
+      double estimated_distance = std::sqrt(dx * dx + dy * dy);
       double error = proximity_value - estimated_distance;
 
-      std::complex<double> error_direction, scaled_direction;
+      double direction_x, direction_y;
 
       // if both coordinates are at the origin, we need a random direction vector
       if (estimated_distance == 0.0) {
@@ -436,35 +693,30 @@ namespace wrench {
         static std::default_random_engine direction_rng(0);
         static std::uniform_real_distribution<double> dir_dist(-0.00000000001, 0.00000000001);
 
-        error_direction.real(dir_dist(direction_rng));
-        error_direction.imag(dir_dist(direction_rng));
+        direction_x = dir_dist(direction_rng);
+        direction_y = dir_dist(direction_rng);
       } else {
-        error_direction = sender_coordinates - peer_coordinates;
+        direction_x = sender_x - peer_x;
+        direction_y = sender_y - peer_y;
       }
 
-      // scaled_direction will get start to approach 0 when error_direction gets small
-      scaled_direction = error_direction * error;
+      // the scaled direction will get start to approach 0 when the direction gets small
+      double scaled_x = direction_x * error;
+      double scaled_y = direction_y * error;
 
-      // compute the updated sender coordinates
-      auto updated_sender_coordinates = sender_coordinates + (scaled_direction * sensitivity);
-
-      // update the coordinate_lookup_table with the updated sender_coordinates
-      search = this->coordinate_lookup_table.find(sender_hostname);
-      if (search != this->coordinate_lookup_table.end()) {
-        search->second = updated_sender_coordinates;
-      }
+      // compute and store the updated sender coordinates
+      coordinates_x[sender_index] = sender_x + (scaled_x * sensitivity - scaled_y * sensitivity);
+      coordinates_y[sender_index] = sender_y + (scaled_x * sensitivity + scaled_y * sensitivity);
 
-      WRENCH_DEBUG("Vivaldi updated coordinates of %s from (%f,%f) to (%f,%f)", sender_hostname.c_str(),
-                   sender_coordinates.real(), sender_coordinates.imag(), updated_sender_coordinates.real(),
-                   updated_sender_coordinates.imag());
+      WRENCH_DEBUG("Vivaldi updated coordinates of host #%lu from (%f,%f) to (%f,%f)", sender_index,
+                   sender_x, sender_y, coordinates_x[sender_index], coordinates_y[sender_index]);
 
       // WRITING VIVALDI RESULTS FOR DEBUGGING
 //        std::ofstream output("/home/ryan/Dropbox/Spring18/GRAD_PROJECT/vivaldi_visual/coordinate_table.txt", std::ofstream::app);
 //
-//        std::map<std::string, std::complex<double>>::iterator it;
 //        output.precision(std::numeric_limits<double>::max_digits10);
-//        for (it = this->coordinate_lookup_table.begin(); it != this->coordinate_lookup_table.end(); ++it) {
-//            output << std::setw(15) << it->first + " | " << std::fixed << it->second.real() << " | " << std::fixed << it->second.imag() << std::endl;
+//        for (unsigned long i = 0; i < num_hosts; i++) {
+//            output << std::setw(15) << "#" + std::to_string(i) + " | " << std::fixed << coordinates_x[i] << " | " << std::fixed << coordinates_y[i] << std::endl;
 //        }
 //        output << "*" << std::endl;
 //        output.close();
@@ -591,7 +843,7 @@ namespace wrench {
      * @brief Gets the list of hosts monitored by this service (does not involve simulated network communications with the service)
      * @return a list of hostnames
      */
-    std::vector<std::string> NetworkProximityService::getHostnameList() {
+    const std::vector<std::string> &NetworkProximityService::getHostnameList() {
       return this->hosts_in_network;
     }
 }
@@ -7,12 +7,15 @@
  * (at your option) any later version.
  */
 
+#include <exception>
+
 #include "wrench/exceptions/WorkflowExecutionException.h"
 #include "wrench/logging/TerminalOutput.h"
 #include "wrench/services/storage/StorageService.h"
 #include "services/storage/StorageServiceMessage.h"
 #include "wrench/services/storage/StorageServiceMessagePayload.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simgrid_S4U_util/S4U_PendingCommunication.h"
 #include "wrench/simulation/Simulation.h"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(storage_service, "Log category for Storage Service");
@@ -63,12 +66,10 @@ namespace wrench {
                     file->getSize(), (this->capacity - this->occupied_space));
         throw std::runtime_error("StorageService::stageFile(): File exceeds free space capacity on storage service");
       }
-      if (this->stored_files.find("/") != this->stored_files.end()) {
-        this->stored_files["/"].insert(file);
-      } else {
-        this->stored_files["/"] = {file}; // By default all the staged files will go to the "/" partition
+      // By default all the staged files will go to the "/" partition
+      if (this->stored_files.insert("/", file)) {
+        this->occupied_space += file->getSize();
       }
-      this->occupied_space += file->getSize();
       WRENCH_INFO("Stored file %s (storage usage: %.10lf%%)", file->getID().c_str(),
                   100.0 * this->occupied_space / this->capacity);
     }
@@ -93,20 +94,36 @@ namespace wrench {
         dst_partition = "/";
       }
 
-      std::set<WorkflowFile*> files = this->stored_files[dst_partition];
-      if (files.size() > 0) {
-        if (files.find(file) == files.end()) {
-          throw std::runtime_error(
-                  "StorageService::removeFileFromStorage(): Attempting to remove a file that is not on the storage service");
-        }
-        this->stored_files[dst_partition].erase(file);
-        this->occupied_space -= file->getSize();
-        WRENCH_INFO("Deleted file %s (storage usage: %.2lf%%)", file->getID().c_str(),
-                    100.0 * this->occupied_space / this->capacity);
-      } else {
+      if (not this->stored_files.remove(dst_partition, file)) {
         throw std::runtime_error(
                 "StorageService::removeFileFromStorage(): Attempting to remove a file that is not on the storage service");
       }
+      this->occupied_space -= file->getSize();
+      WRENCH_INFO("Deleted file %s (storage usage: %.2lf%%)", file->getID().c_str(),
+                  100.0 * this->occupied_space / this->capacity);
+    }
+
+    /**
+     * @brief Remove a partition and all its files from storage (internal method)
+     *
+     * @param partition: the partition
+     *
+     * @return the number of files that were removed
+     */
+    unsigned long StorageService::removePartitionFromStorage(std::string partition) {
+
+      // Empty partition means "/"
+      if (partition.empty()) {
+        partition = "/";
+      }
+
+      this->occupied_space -= this->stored_files.getOccupiedSpace(partition);
+      unsigned long num_removed_files = this->stored_files.removePartition(partition);
+      if (num_removed_files > 0) {
+        WRENCH_INFO("Deleted %lu files in partition %s (storage usage: %.2lf%%)", num_removed_files,
+                    partition.c_str(), 100.0 * this->occupied_space / this->capacity);
+      }
+      return num_removed_files;
     }
 
     /**
@@ -137,10 +154,10 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("how_much_free_space");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFreeSpaceRequestMessage(
-                answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox, new StorageServiceFreeSpaceRequestMessage(
+                answer_mailbox.getName(),
                 this->getMessagePayloadValueAsDouble(StorageServiceMessagePayload::FREE_SPACE_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
@@ -149,10 +166,11 @@ namespace wrench {
       // Wait for a reply
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<StorageServiceFreeSpaceAnswerMessage *>(message.get())) {
         return msg->free_space;
@@ -234,10 +252,10 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_file");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFileLookupRequestMessage(
-                answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox, new StorageServiceFileLookupRequestMessage(
+                answer_mailbox.getName(),
                 file,
                 dst_partition,
                 this->getMessagePayloadValueAsDouble(StorageServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
@@ -248,10 +266,11 @@ namespace wrench {
       // Wait for a reply
       std::unique_ptr<SimulationMessage> message;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<StorageServiceFileLookupAnswerMessage *>(message.get())) {
         return msg->file_is_available;
@@ -321,17 +340,48 @@ namespace wrench {
 
     void StorageService::readFile(WorkflowFile *file, std::string src_partition) {
 
+      std::unique_ptr<S4U_PendingCommunication> pending_read = this->startFileRead(file, src_partition);
+
+      // Retrieve the file
+      std::unique_ptr<SimulationMessage> file_content_message = nullptr;
+      try {
+        file_content_message = pending_read->wait();
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        WRENCH_INFO("Unknown Error while getting a file content.... means we should just die. but throwing");
+        throw WorkflowExecutionException(cause);
+      }
+      pending_read->reply_mailbox->release();
+
+      if (not dynamic_cast<StorageServiceFileContentMessage *>(file_content_message.get())) {
+        throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
+                                 file_content_message->getName() + "] message!");
+      }
+    }
+
+    /**
+     * @brief Ask the storage service for a file, and start receiving the file's content
+     *
+     * @param file: the file
+     * @param src_partition: the partition from which to read the file
+     * @return the pending reception of the file's content (which holds the reply mailbox, to be released once
+     *         the content has been received)
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    std::unique_ptr<S4U_PendingCommunication> StorageService::startFileRead(WorkflowFile *file, std::string src_partition) {
+
       // Empty partition means "/"
       if (src_partition.empty()) {
         src_partition = "/";
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("read_file");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new StorageServiceFileReadRequestMessage(answer_mailbox,
-                                                                         answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new StorageServiceFileReadRequestMessage(answer_mailbox.getName(),
+                                                                         answer_mailbox.getName(),
                                                                          file,
                                                                          src_partition,
                                                                          this->getMessagePayloadValueAsDouble(
@@ -344,7 +394,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -352,30 +402,27 @@ namespace wrench {
       if (auto msg = dynamic_cast<StorageServiceFileReadAnswerMessage *>(message.get())) {
         // If it's not a success, throw an exception
         if (not msg->success) {
+          // No file content will be sent
+          answer_mailbox.release();
           std::shared_ptr<FailureCause> &cause = msg->failure_cause;
           throw WorkflowExecutionException(cause);
         }
-
-        // Otherwise, retrieve  the file
-        std::unique_ptr<SimulationMessage> file_content_message = nullptr;
-        try {
-          file_content_message = S4U_Mailbox::getMessage(answer_mailbox);
-        } catch (std::shared_ptr<NetworkError> &cause) {
-          WRENCH_INFO("Unknown Error while getting a file content.... means we should just die. but throwing");
-          throw WorkflowExecutionException(cause);
-        }
-
-        if (auto file_content_msg = dynamic_cast<StorageServiceFileContentMessage *>(file_content_message.get())) {
-          // do nothing
-        } else {
-          throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
-                                   file_content_message->getName() + "] message!");
-        }
-
       } else {
         throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
                                  message->getName() + "] message!");
       }
+
+      // Otherwise, start receiving the file (which the storage service sends to the same mailbox, which
+      // is now held by the pending communication, and which the caller should release once the file
+      // content has been received)
+      std::unique_ptr<S4U_PendingCommunication> pending_read = nullptr;
+      try {
+        pending_read = S4U_Mailbox::igetMessage(answer_mailbox.getName());
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+      pending_read->reply_mailbox.reset(new S4U_ReplyMailbox(std::move(answer_mailbox)));
+      return pending_read;
     }
 
     /**
@@ -436,16 +483,37 @@ namespace wrench {
      */
     void StorageService::writeFile(WorkflowFile *file, std::string dst_partition) {
 
+      std::unique_ptr<S4U_PendingCommunication> pending_write = this->startFileWrite(file, dst_partition);
+
+      try {
+        pending_write->wait();
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+    }
+
+    /**
+     * @brief Ask the storage service to accept a file, and start sending the file's content
+     *
+     * @param file: the file
+     * @param dst_partition: the partition in which to write the file
+     * @return the pending sending of the file's content
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    std::unique_ptr<S4U_PendingCommunication> StorageService::startFileWrite(WorkflowFile *file, std::string dst_partition) {
+
       // Empty partition means "/"
       if (dst_partition.empty()) {
         dst_partition = "/";
       }
 
       // Send a  message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("write_file");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new StorageServiceFileWriteRequestMessage(answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new StorageServiceFileWriteRequestMessage(answer_mailbox.getName(),
                                                                           file,
                                                                           dst_partition,
                                                                           this->getMessagePayloadValueAsDouble(
@@ -458,10 +526,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<StorageServiceFileWriteAnswerMessage *>(message.get())) {
         // If not a success, throw an exception
@@ -469,9 +538,9 @@ namespace wrench {
           throw WorkflowExecutionException(msg->failure_cause);
         }
 
-        // Otherwise, synchronously send the file up!
+        // Otherwise, start sending the file up
         try {
-          S4U_Mailbox::putMessage(msg->data_write_mailbox_name, new StorageServiceFileContentMessage(file));
+          return S4U_Mailbox::iputMessage(msg->data_write_mailbox_name, new StorageServiceFileContentMessage(file));
         } catch (std::shared_ptr<NetworkError> &cause) {
           throw WorkflowExecutionException(cause);
         }
@@ -483,7 +552,7 @@ namespace wrench {
     }
 
     /**
-     * @brief Synchronously and sequentially read a set of files from storage services
+     * @brief Synchronously and concurrently read a set of files from storage services
      *
      * @param files: the set of files to read
      * @param file_locations: a map of files to storage services
@@ -509,7 +578,7 @@ namespace wrench {
     }
 
     /**
-     * @brief Synchronously and sequentially uppload a set of files from storage services
+     * @brief Synchronously and concurrently upload a set of files from storage services
      *
      * @param files: the set of files to write
      * @param file_locations: a map of files to storage services
@@ -536,7 +605,7 @@ namespace wrench {
     }
 
     /**
-     * @brief Synchronously and sequentially write/read a set of files to/from storage services
+     * @brief Synchronously and concurrently write/read a set of files to/from storage services
      *
      * @param action: FileOperation::DONWLOAD or FileOperation::WRITE
      * @param files: the set of files to read/write
@@ -565,9 +634,9 @@ namespace wrench {
           throw std::invalid_argument("StorageService::writeOrReadFiles(): invalid file location argument");
         }
       }
+      // Identify the storage services, and make sure that they are all up before starting any transfer
+      std::vector<std::pair<WorkflowFile *, StorageService *>> transfers;
       for (auto const &f : files) {
-
-        // Identify the Storage Service
         StorageService *storage_service = default_storage_service;
         if (file_locations.find(f) != file_locations.end()) {
           storage_service = file_locations[f];
@@ -575,41 +644,82 @@ namespace wrench {
         if (storage_service == nullptr) {
           throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new NoStorageServiceForFile(f)));
         }
+        if (storage_service->state == DOWN) {
+          throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(storage_service)));
+        }
+        transfers.push_back(std::make_pair(f, storage_service));
+      }
 
-        if (action == READ) {
-          try {
+      // Start all the file transfers, so that they proceed concurrently (stop at the first
+      // one that cannot be started, but still wait for those already started)
+      std::vector<std::pair<WorkflowFile *, std::unique_ptr<S4U_PendingCommunication>>> pending_transfers;
+      std::exception_ptr failure = nullptr;
+
+      for (auto const &transfer : transfers) {
+        WorkflowFile *f = transfer.first;
+        StorageService *storage_service = transfer.second;
+
+        // Only files on the default storage service (scratch) are in the job's partition
+        std::string partition = "/";
+        if ((storage_service == default_storage_service) and (job != nullptr)) {
+          partition += job->getName();
+        }
+
+        try {
+          if (action == READ) {
             WRENCH_INFO("Reading file %s from storage service %s", f->getID().c_str(), storage_service->getName().c_str());
-            if (storage_service != default_storage_service) {
-              //if the storage service where I am going to read from is not the default storage service (scratch), then I
-              // don't want to read from job's temp partition, rather I would like to read from / partition of the storage service
-              storage_service->readFile(f, nullptr);
-            } else {
-              storage_service->readFile(f, job);
-            }
-            WRENCH_INFO("File %s read", f->getID().c_str());
-          } catch (std::runtime_error &e) {
-            throw;
-          } catch (WorkflowExecutionException &e) {
-            throw;
-          }
-        } else {
-          try {
+            pending_transfers.push_back(std::make_pair(f, storage_service->startFileRead(f, partition)));
+          } else {
             WRENCH_INFO("Writing file %s to storage service %s", f->getID().c_str(), storage_service->getName().c_str());
-            // Write the file
             if (storage_service == default_storage_service) {
               files_in_scratch.insert(f);
-              storage_service->writeFile(f, job);
-            } else {
-              storage_service->writeFile(f, nullptr);
             }
-            WRENCH_INFO("Wrote file %s", f->getID().c_str());
-          } catch (std::runtime_error &e) {
-            throw;
-          } catch (WorkflowExecutionException &e) {
-            throw;
+            pending_transfers.push_back(std::make_pair(f, storage_service->startFileWrite(f, partition)));
+          }
+        } catch (...) {
+          failure = std::current_exception();
+          break;
+        }
+      }
+
+      // Wait for all the started file transfers to complete, even after a failure, so that
+      // no storage service is left with a data connection that never completes
+      for (auto &pending_transfer : pending_transfers) {
+        std::unique_ptr<SimulationMessage> message = nullptr;
+        try {
+          message = pending_transfer.second->wait();
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          if (failure == nullptr) {
+            failure = std::make_exception_ptr(WorkflowExecutionException(cause));
+          }
+        }
+
+        if (message == nullptr) {
+          // The mailbox of a failed reception is discarded along with the pending communication
+          continue;
+        }
+        if (action == READ) {
+          // The file content has been received, so nothing else will arrive on the mailbox
+          pending_transfer.second->reply_mailbox->release();
+        }
+
+        if (action == READ) {
+          if (not dynamic_cast<StorageServiceFileContentMessage *>(message.get())) {
+            if (failure == nullptr) {
+              failure = std::make_exception_ptr(std::runtime_error(
+                      "StorageService::writeOrReadFiles(): Received an unexpected [" + message->getName() + "] message!"));
+            }
+            continue;
           }
+          WRENCH_INFO("File %s read", pending_transfer.first->getID().c_str());
+        } else {
+          WRENCH_INFO("Wrote file %s", pending_transfer.first->getID().c_str());
         }
       }
+
+      if (failure != nullptr) {
+        std::rethrow_exception(failure);
+      }
     }
 
 
@@ -687,10 +797,10 @@ namespace wrench {
 
       bool unregister = (file_registry_service != nullptr);
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("delete_file");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFileDeleteRequestMessage(
-                answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox, new StorageServiceFileDeleteRequestMessage(
+                answer_mailbox.getName(),
                 file,
                 dst_partition,
                 this->getMessagePayloadValueAsDouble(StorageServiceMessagePayload::FILE_DELETE_REQUEST_MESSAGE_PAYLOAD)));
@@ -702,10 +812,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<StorageServiceFileDeleteAnswerMessage *>(message.get())) {
         // On failure, throw an exception
@@ -723,6 +834,73 @@ namespace wrench {
       }
     }
 
+    /**
+     * @brief Synchronously ask the storage service to delete a partition and all the files in it
+     *        (deleting a partition that holds no file is not an error)
+     *
+     * @param partition: the partition
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    void StorageService::deletePartition(std::string partition) {
+
+      if (this->state == DOWN) {
+        throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ServiceIsDown(this)));
+      }
+
+      // Empty partition means "/"
+      if (partition.empty()) {
+        partition = "/";
+      }
+
+      // Send a message to the daemon
+      S4U_ReplyMailbox answer_mailbox;
+      try {
+        S4U_Mailbox::putMessage(this->mailbox, new StorageServicePartitionDeleteRequestMessage(
+                answer_mailbox.getName(),
+                partition,
+                this->getMessagePayloadValueAsDouble(StorageServiceMessagePayload::FILE_DELETE_REQUEST_MESSAGE_PAYLOAD)));
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+
+      // Wait for a reply
+      std::unique_ptr<SimulationMessage> message = nullptr;
+
+      try {
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName(), this->network_timeout);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+      answer_mailbox.release();
+
+      if (auto msg = dynamic_cast<StorageServicePartitionDeleteAnswerMessage *>(message.get())) {
+        WRENCH_INFO("Deleted %lu files in partition %s on storage service %s", msg->num_deleted_files,
+                    partition.c_str(), this->getName().c_str());
+      } else {
+        throw std::runtime_error("StorageService::deletePartition(): Unexpected [" + message->getName() + "] message");
+      }
+    }
+
+    /**
+     * @brief Synchronously ask the storage service to delete the partition of a job and all the files in it
+     *
+     * @param job: the job
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     * @throw std::invalid_argument
+     */
+    void StorageService::deletePartition(WorkflowJob *job) {
+
+      if (job == nullptr) {
+        throw std::invalid_argument("StorageService::deletePartition(): Invalid arguments");
+      }
+
+      this->deletePartition("/" + job->getName());
+    }
+
     /**
      * @brief Synchronously and sequentially delete a set of files from storage services
      *
@@ -857,10 +1035,10 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("copy_file");
+      S4U_ReplyMailbox answer_mailbox;
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFileCopyRequestMessage(
-                answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox, new StorageServiceFileCopyRequestMessage(
+                answer_mailbox.getName(),
                 file,
                 src,
                 src_partition,
@@ -875,10 +1053,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getMessage(answer_mailbox.getName());
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
+      answer_mailbox.release();
 
       if (auto msg = dynamic_cast<StorageServiceFileCopyAnswerMessage *>(message.get())) {
         if (msg->failure_cause) {
@@ -928,7 +1107,7 @@ namespace wrench {
 
       // Send a message to the daemon
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFileCopyRequestMessage(
+        S4U_Mailbox::putMessage(this->mailbox, new StorageServiceFileCopyRequestMessage(
                 answer_mailbox,
                 file,
                 src,
@@ -972,11 +1151,11 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string request_answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("read_file");
+      S4U_ReplyMailbox request_answer_mailbox;
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
-                                new StorageServiceFileReadRequestMessage(request_answer_mailbox,
+        S4U_Mailbox::putMessage(this->mailbox,
+                                new StorageServiceFileReadRequestMessage(request_answer_mailbox.getName(),
                                                                          mailbox_that_should_receive_file_content,
                                                                          file,
                                                                          src_partition,
@@ -991,10 +1170,11 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(request_answer_mailbox, this->network_timeout);
+        message = S4U_Mailbox::getMessage(request_answer_mailbox.getName(), this->network_timeout);
       } catch (std::shared_ptr<NetworkError> cause) {
         throw WorkflowExecutionException(cause);
       }
+      request_answer_mailbox.release();
 
       if (auto msg = dynamic_cast<StorageServiceFileReadAnswerMessage *>(message.get())) {
         // If it's not a success, throw an exception
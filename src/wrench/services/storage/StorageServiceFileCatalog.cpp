@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/services/storage/StorageServiceFileCatalog.h"
+#include "wrench/workflow/WorkflowFile.h"
+
+namespace wrench {
+
+    /**
+     * @brief Check whether a file is in a partition
+     *
+     * @param partition: the partition
+     * @param file: the file
+     *
+     * @return true if the file is in the partition, false otherwise
+     */
+    bool StorageServiceFileCatalog::lookup(const std::string &partition, WorkflowFile *file) const {
+      Partition *p = this->getPartition(partition);
+      return (p != nullptr) and (p->files.find(file) != p->files.end());
+    }
+
+    /**
+     * @brief Add a file to a partition (which is created if need be)
+     *
+     * @param partition: the partition
+     * @param file: the file
+     *
+     * @return true if the file was added, false if it was already in the partition
+     */
+    bool StorageServiceFileCatalog::insert(const std::string &partition, WorkflowFile *file) {
+      unsigned long index = this->partition_ids.insert(partition).first;
+      if (index >= this->partitions.size()) {
+        this->partitions.resize(index + 1);
+      }
+      if (this->partitions[index] == nullptr) {
+        this->partitions[index] = std::unique_ptr<Partition>(new Partition());
+      }
+
+      Partition *p = this->partitions[index].get();
+      if (not p->files.insert(file).second) {
+        return false;
+      }
+      p->occupied_space += file->getSize();
+      this->num_files++;
+      return true;
+    }
+
+    /**
+     * @brief Remove a file from a partition
+     *
+     * @param partition: the partition
+     * @param file: the file
+     *
+     * @return true if the file was removed, false if it was not in the partition
+     */
+    bool StorageServiceFileCatalog::remove(const std::string &partition, WorkflowFile *file) {
+      Partition *p = this->getPartition(partition);
+      if ((p == nullptr) or (p->files.erase(file) == 0)) {
+        return false;
+      }
+      p->occupied_space -= file->getSize();
+      this->num_files--;
+      return true;
+    }
+
+    /**
+     * @brief Remove a partition and all its files
+     *
+     * @param partition: the partition
+     *
+     * @return the number of files that were removed
+     */
+    unsigned long StorageServiceFileCatalog::removePartition(const std::string &partition) {
+      unsigned long index = this->partition_ids.find(partition);
+      if (index == IDTable::NOT_FOUND) {
+        return 0;
+      }
+
+      unsigned long num_removed_files = this->partitions[index]->files.size();
+      this->num_files -= num_removed_files;
+      this->partitions[index].reset();
+      this->partition_ids.erase(index);
+      return num_removed_files;
+    }
+
+    /**
+     * @brief Get the number of bytes occupied by the files of a partition
+     *
+     * @param partition: the partition
+     *
+     * @return a number of bytes
+     */
+    double StorageServiceFileCatalog::getOccupiedSpace(const std::string &partition) const {
+      Partition *p = this->getPartition(partition);
+      return (p != nullptr) ? p->occupied_space : 0.0;
+    }
+
+    /**
+     * @brief Get the number of files in a partition
+     *
+     * @param partition: the partition
+     *
+     * @return a number of files
+     */
+    unsigned long StorageServiceFileCatalog::getNumFiles(const std::string &partition) const {
+      Partition *p = this->getPartition(partition);
+      return (p != nullptr) ? p->files.size() : 0;
+    }
+
+    /**
+     * @brief Get the number of files in all partitions
+     *
+     * @return a number of files
+     */
+    unsigned long StorageServiceFileCatalog::getNumFiles() const {
+      return this->num_files;
+    }
+
+    /**
+     * @brief Find a partition
+     *
+     * @param partition: the partition name
+     *
+     * @return the partition, or nullptr if there is no such partition
+     */
+    StorageServiceFileCatalog::Partition *StorageServiceFileCatalog::getPartition(const std::string &partition) const {
+      unsigned long index = this->partition_ids.find(partition);
+      return (index == IDTable::NOT_FOUND) ? nullptr : this->partitions[index].get();
+    }
+
+};
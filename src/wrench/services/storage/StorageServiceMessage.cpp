@@ -15,11 +15,12 @@ namespace wrench {
 
     /**
      * @brief Constructor
+     * @param type: the message type
      * @param name: the message name
      * @param payload: the message size in bytes
      */
-    StorageServiceMessage::StorageServiceMessage(std::string name, double payload) :
-            ServiceMessage("StorageService::" + name, payload) {
+    StorageServiceMessage::StorageServiceMessage(SimulationMessage::Type type, std::string name, double payload) :
+            ServiceMessage(type, "StorageService::" + name, payload) {
 
     }
 
@@ -32,7 +33,7 @@ namespace wrench {
     */
     StorageServiceFreeSpaceRequestMessage::StorageServiceFreeSpaceRequestMessage(std::string answer_mailbox,
                                                                                  double payload)
-            : StorageServiceMessage("FREE_SPACE_REQUEST", payload) {
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_FREE_SPACE_REQUEST, "FREE_SPACE_REQUEST", payload) {
       if ((answer_mailbox == "")) {
         throw std::invalid_argument("StorageServiceFreeSpaceRequestMessage::StorageServiceFreeSpaceRequestMessage(): Invalid arguments");
       }
@@ -48,7 +49,7 @@ namespace wrench {
      */
     StorageServiceFreeSpaceAnswerMessage::StorageServiceFreeSpaceAnswerMessage(double free_space, double payload)
             : StorageServiceMessage(
-            "FREE_SPACE_ANSWER", payload) {
+            SimulationMessage::STORAGE_SERVICE_FREE_SPACE_ANSWER, "FREE_SPACE_ANSWER", payload) {
       if ((free_space < 0.0)) {
         throw std::invalid_argument("StorageServiceFreeSpaceAnswerMessage::StorageServiceFreeSpaceAnswerMessage(): Invalid arguments");
       }
@@ -68,7 +69,7 @@ namespace wrench {
                                                                                    WorkflowFile *file,
                                                                                    std::string& dst_partition,
                                                                                    double payload)
-            : StorageServiceMessage("FILE_LOOKUP_REQUEST",
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_FILE_LOOKUP_REQUEST, "FILE_LOOKUP_REQUEST",
                                     payload) {
       if ((file == nullptr) || (answer_mailbox == "")) {
         throw std::invalid_argument("StorageServiceFileLookupRequestMessage::StorageServiceFileLookupRequestMessage(): Invalid arguments");
@@ -90,7 +91,7 @@ namespace wrench {
                                                                                  bool file_is_available,
                                                                                  double payload)
             : StorageServiceMessage(
-            "FILE_LOOKUP_ANSWER", payload) {
+            SimulationMessage::STORAGE_SERVICE_FILE_LOOKUP_ANSWER, "FILE_LOOKUP_ANSWER", payload) {
 
       if (file == nullptr) {
         throw std::invalid_argument("StorageServiceFileLookupAnswerMessage::StorageServiceFileLookupAnswerMessage(): Invalid arguments");
@@ -112,7 +113,7 @@ namespace wrench {
                                                                                    WorkflowFile *file,
                                                                                    std::string& dst_partition,
                                                                                    double payload)
-            : StorageServiceMessage("FILE_DELETE_REQUEST",
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_FILE_DELETE_REQUEST, "FILE_DELETE_REQUEST",
                                     payload) {
       if ((answer_mailbox == "") || (file == nullptr)) {
         throw std::invalid_argument("StorageServiceFileDeleteRequestMessage::StorageServiceFileDeleteRequestMessage(): Invalid arguments");
@@ -137,7 +138,7 @@ namespace wrench {
                                                                                  bool success,
                                                                                  std::shared_ptr<FailureCause> failure_cause,
                                                                                  double payload)
-            : StorageServiceMessage("FILE_DELETE_ANSWER", payload) {
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_FILE_DELETE_ANSWER, "FILE_DELETE_ANSWER", payload) {
 
       if ((file == nullptr) || (storage_service == nullptr) ||
               (success && (failure_cause != nullptr)) ||
@@ -150,6 +151,49 @@ namespace wrench {
       this->failure_cause = std::move(failure_cause);
     }
 
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which to send the answer
+     * @param partition: the partition to delete
+     * @param payload: the message size in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    StorageServicePartitionDeleteRequestMessage::StorageServicePartitionDeleteRequestMessage(std::string answer_mailbox,
+                                                                                             std::string partition,
+                                                                                             double payload)
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_PARTITION_DELETE_REQUEST,
+                                    "PARTITION_DELETE_REQUEST", payload) {
+      if ((answer_mailbox == "") || (partition == "")) {
+        throw std::invalid_argument("StorageServicePartitionDeleteRequestMessage::StorageServicePartitionDeleteRequestMessage(): Invalid arguments");
+      }
+      this->answer_mailbox = answer_mailbox;
+      this->partition = partition;
+    }
+
+    /**
+     * @brief Constructor
+     * @param partition: the partition that was deleted
+     * @param storage_service: the storage service on which the partition was deleted
+     * @param num_deleted_files: the number of files that were deleted
+     * @param payload: the message size in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    StorageServicePartitionDeleteAnswerMessage::StorageServicePartitionDeleteAnswerMessage(std::string partition,
+                                                                                           StorageService *storage_service,
+                                                                                           unsigned long num_deleted_files,
+                                                                                           double payload)
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_PARTITION_DELETE_ANSWER,
+                                    "PARTITION_DELETE_ANSWER", payload) {
+      if ((partition == "") || (storage_service == nullptr)) {
+        throw std::invalid_argument("StorageServicePartitionDeleteAnswerMessage::StorageServicePartitionDeleteAnswerMessage(): Invalid arguments");
+      }
+      this->partition = partition;
+      this->storage_service = storage_service;
+      this->num_deleted_files = num_deleted_files;
+    }
+
     /**
     * @brief Constructor
     * @param answer_mailbox: the mailbox to which to send the answer
@@ -169,7 +213,7 @@ namespace wrench {
                                                                                std::string& dst_partition,
                                                                                FileRegistryService *file_registry_service,
                                                                                double payload) : StorageServiceMessage(
-            "FILE_COPY_REQUEST", payload) {
+            SimulationMessage::STORAGE_SERVICE_FILE_COPY_REQUEST, "FILE_COPY_REQUEST", payload) {
       if ((answer_mailbox == "") || (file == nullptr) || (src == nullptr)) {
         throw std::invalid_argument("StorageServiceFileCopyRequestMessage::StorageServiceFileCopyRequestMessage(): Invalid arguments");
       }
@@ -202,7 +246,7 @@ namespace wrench {
                                                                              bool success,
                                                                              std::shared_ptr<FailureCause> failure_cause,
                                                                              double payload)
-            : StorageServiceMessage("FILE_COPY_ANSWER", payload) {
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_FILE_COPY_ANSWER, "FILE_COPY_ANSWER", payload) {
       if ((file == nullptr) || (storage_service == nullptr) || (dst_partition.empty()) ||
               (success && (failure_cause != nullptr)) ||
               (!success && (failure_cause == nullptr)) ||
@@ -231,7 +275,7 @@ namespace wrench {
                                                                                  WorkflowFile *file,
                                                                                  std::string& dst_partition,
                                                                                  double payload)
-            : StorageServiceMessage("FILE_WRITE_REQUEST",
+            : StorageServiceMessage(SimulationMessage::STORAGE_SERVICE_FILE_WRITE_REQUEST, "FILE_WRITE_REQUEST",
                                     payload) {
       if ((answer_mailbox == "") || (file == nullptr)) {
         throw std::invalid_argument("StorageServiceFileWriteRequestMessage::StorageServiceFileWriteRequestMessage(): Invalid arguments");
@@ -259,7 +303,7 @@ namespace wrench {
                                                                                std::shared_ptr<FailureCause> failure_cause,
                                                                                std::string data_write_mailbox_name,
                                                                                double payload) : StorageServiceMessage(
-            "FILE_WRITE_ANSWER", payload) {
+            SimulationMessage::STORAGE_SERVICE_FILE_WRITE_ANSWER, "FILE_WRITE_ANSWER", payload) {
       if ((file == nullptr) || (storage_service == nullptr) || (data_write_mailbox_name == "") ||
               (success && (failure_cause != nullptr)) || (!success && (failure_cause == nullptr))) {
         throw std::invalid_argument("StorageServiceFileWriteAnswerMessage::StorageServiceFileWriteAnswerMessage(): Invalid arguments");
@@ -285,7 +329,7 @@ namespace wrench {
                                                                                WorkflowFile *file,
                                                                                std::string& src_partition,
                                                                                double payload) : StorageServiceMessage(
-            "FILE_READ_REQUEST",
+            SimulationMessage::STORAGE_SERVICE_FILE_READ_REQUEST, "FILE_READ_REQUEST",
             payload) {
       if ((answer_mailbox == "") || (mailbox_to_receive_the_file_content == "") || (file == nullptr)) {
         throw std::invalid_argument("StorageServiceFileReadRequestMessage::StorageServiceFileReadRequestMessage(): Invalid arguments");
@@ -311,7 +355,7 @@ namespace wrench {
                                                                              bool success,
                                                                              std::shared_ptr<FailureCause> failure_cause,
                                                                              double payload) : StorageServiceMessage(
-            "FILE_READ_ANSWER",
+            SimulationMessage::STORAGE_SERVICE_FILE_READ_ANSWER, "FILE_READ_ANSWER",
             payload) {
       if ((file == nullptr) || (storage_service == nullptr) ||
               (success && (failure_cause != nullptr)) || (!success && (failure_cause == nullptr))) {
@@ -328,7 +372,7 @@ namespace wrench {
     * @param file: the workflow data file
     */
     StorageServiceFileContentMessage::StorageServiceFileContentMessage(WorkflowFile *file) : StorageServiceMessage(
-            "FILE_CONTENT", 0) {
+            SimulationMessage::STORAGE_SERVICE_FILE_CONTENT, "FILE_CONTENT", 0) {
       if (file == nullptr) {
         throw std::invalid_argument("StorageServiceFileContentMessage::StorageServiceFileContentMessage(): Invalid arguments");
       }
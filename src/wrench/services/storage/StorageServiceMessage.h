@@ -30,7 +30,7 @@ namespace wrench {
      */
     class StorageServiceMessage : public ServiceMessage {
     protected:
-        StorageServiceMessage(std::string name, double payload);
+        StorageServiceMessage(SimulationMessage::Type type, std::string name, double payload);
     };
 
 
@@ -122,6 +122,39 @@ namespace wrench {
         std::shared_ptr<FailureCause> failure_cause;
     };
 
+    /**
+     * @brief A message sent to a StorageService to delete a partition and all the files in it
+     */
+    class StorageServicePartitionDeleteRequestMessage : public StorageServiceMessage {
+    public:
+        StorageServicePartitionDeleteRequestMessage(std::string answer_mailbox,
+                                                    std::string partition,
+                                                    double payload);
+
+        /** @brief Mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+        /** @brief The partition to delete */
+        std::string partition;
+    };
+
+    /**
+     * @brief A message sent by a StorageService in answer to a partition deletion request
+     */
+    class StorageServicePartitionDeleteAnswerMessage : public StorageServiceMessage {
+    public:
+        StorageServicePartitionDeleteAnswerMessage(std::string partition,
+                                                   StorageService *storage_service,
+                                                   unsigned long num_deleted_files,
+                                                   double payload);
+
+        /** @brief The partition that was deleted */
+        std::string partition;
+        /** @brief The storage service on which the deletion happened */
+        StorageService *storage_service;
+        /** @brief The number of files that were deleted */
+        unsigned long num_deleted_files;
+    };
+
     /**
     * @brief A message sent to a StorageService to copy a file from another StorageService
     */
@@ -101,7 +101,7 @@ namespace wrench {
                   this->getName().c_str(),
                   S4U_Simulation::getHostName().c_str(),
                   this->capacity,
-                  this->stored_files.size(),
+                  this->stored_files.getNumFiles(),
                   this->mailbox_name.c_str());
 
       /** Main loop **/
@@ -171,91 +171,114 @@ namespace wrench {
 
       WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-      if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-        try {
-          S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                  new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
-                                          SimpleStorageServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+      switch (message->type) {
+        case SimulationMessage::SERVICE_STOP_DAEMON: {
+          auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+          try {
+            S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                    new ServiceDaemonStoppedMessage(this->getMessagePayloadValueAsDouble(
+                                            SimpleStorageServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
+          }
           return false;
         }
-        return false;
 
-      } else if (auto msg = dynamic_cast<StorageServiceFreeSpaceRequestMessage *>(message.get())) {
-        double free_space = this->capacity - this->occupied_space;
+        case SimulationMessage::STORAGE_SERVICE_FREE_SPACE_REQUEST: {
+          auto msg = static_cast<StorageServiceFreeSpaceRequestMessage *>(message.get());
+          double free_space = this->capacity - this->occupied_space;
 
-        try {
-          S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                   new StorageServiceFreeSpaceAnswerMessage(free_space, this->getMessagePayloadValueAsDouble(
-                                           SimpleStorageServiceMessagePayload::FREE_SPACE_ANSWER_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-          return false;
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new StorageServiceFreeSpaceAnswerMessage(free_space, this->getMessagePayloadValueAsDouble(
+                                             SimpleStorageServiceMessagePayload::FREE_SPACE_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return false;
+          }
+          return true;
         }
-        return true;
 
-      } else if (auto msg = dynamic_cast<StorageServiceFileDeleteRequestMessage *>(message.get())) {
-
-        bool success = true;
-        std::shared_ptr<FailureCause> failure_cause = nullptr;
-        if (this->stored_files.find(msg->dst_partition) != this->stored_files.end()) {
-          std::set<WorkflowFile*> files = this->stored_files[msg->dst_partition];
-          if (files.find(msg->file) == files.end()) {
+        case SimulationMessage::STORAGE_SERVICE_FILE_DELETE_REQUEST: {
+          auto msg = static_cast<StorageServiceFileDeleteRequestMessage *>(message.get());
+          bool success = true;
+          std::shared_ptr<FailureCause> failure_cause = nullptr;
+          if (this->stored_files.lookup(msg->dst_partition, msg->file)) {
+            this->removeFileFromStorage(msg->file, msg->dst_partition);
+          } else {
             success = false;
             failure_cause = std::shared_ptr<FailureCause>(new FileNotFound(msg->file, this));
-          } else {
-            this->removeFileFromStorage(msg->file, msg->dst_partition);
           }
-        } else {
-          success = false;
-          failure_cause = std::shared_ptr<FailureCause>(new FileNotFound(msg->file, this));
-        }
 
 
-        // Send an asynchronous reply
-        try {
-          S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                   new StorageServiceFileDeleteAnswerMessage(msg->file,
-                                                                             this,
-                                                                             success,
-                                                                             failure_cause,
-                                                                             this->getMessagePayloadValueAsDouble(
-                                                                                     SimpleStorageServiceMessagePayload::FILE_DELETE_ANSWER_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
+          // Send an asynchronous reply
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new StorageServiceFileDeleteAnswerMessage(msg->file,
+                                                                               this,
+                                                                               success,
+                                                                               failure_cause,
+                                                                               this->getMessagePayloadValueAsDouble(
+                                                                                       SimpleStorageServiceMessagePayload::FILE_DELETE_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
+
           return true;
         }
 
-        return true;
+        case SimulationMessage::STORAGE_SERVICE_PARTITION_DELETE_REQUEST: {
+          auto msg = static_cast<StorageServicePartitionDeleteRequestMessage *>(message.get());
+          unsigned long num_deleted_files = this->removePartitionFromStorage(msg->partition);
 
-      } else if (auto msg = dynamic_cast<StorageServiceFileLookupRequestMessage *>(message.get())) {
+          // Send an asynchronous reply
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new StorageServicePartitionDeleteAnswerMessage(msg->partition,
+                                                                                    this,
+                                                                                    num_deleted_files,
+                                                                                    this->getMessagePayloadValueAsDouble(
+                                                                                            SimpleStorageServiceMessagePayload::FILE_DELETE_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
 
-        std::set<WorkflowFile*> files = this->stored_files[msg->dst_partition];
-        bool file_found = (files.find(msg->file) != files.end());
-        try {
-          S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                   new StorageServiceFileLookupAnswerMessage(msg->file, file_found,
-                                                                             this->getMessagePayloadValueAsDouble(
-                                                                                     SimpleStorageServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
 
-        return true;
-
-      } else if (auto msg = dynamic_cast<StorageServiceFileWriteRequestMessage *>(message.get())) {
-
-        return processFileWriteRequest(msg->file, msg->dst_partition, msg->answer_mailbox);
+        case SimulationMessage::STORAGE_SERVICE_FILE_LOOKUP_REQUEST: {
+          auto msg = static_cast<StorageServiceFileLookupRequestMessage *>(message.get());
+          bool file_found = this->stored_files.lookup(msg->dst_partition, msg->file);
+          try {
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new StorageServiceFileLookupAnswerMessage(msg->file, file_found,
+                                                                               this->getMessagePayloadValueAsDouble(
+                                                                                       SimpleStorageServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+          }
 
-      } else if (auto msg = dynamic_cast<StorageServiceFileReadRequestMessage *>(message.get())) {
+          return true;
+        }
 
-        return processFileReadRequest(msg->file, msg->src_partition, msg->answer_mailbox, msg->mailbox_to_receive_the_file_content);
+        case SimulationMessage::STORAGE_SERVICE_FILE_WRITE_REQUEST: {
+          auto msg = static_cast<StorageServiceFileWriteRequestMessage *>(message.get());
+          return processFileWriteRequest(msg->file, msg->dst_partition, msg->answer_mailbox);
+        }
 
-      } else if (auto msg = dynamic_cast<StorageServiceFileCopyRequestMessage *>(message.get())) {
+        case SimulationMessage::STORAGE_SERVICE_FILE_READ_REQUEST: {
+          auto msg = static_cast<StorageServiceFileReadRequestMessage *>(message.get());
+          return processFileReadRequest(msg->file, msg->src_partition, msg->answer_mailbox, msg->mailbox_to_receive_the_file_content);
+        }
 
-        return processFileCopyRequest(msg->file, msg->src, msg->src_partition, msg->dst_partition, msg->answer_mailbox);
+        case SimulationMessage::STORAGE_SERVICE_FILE_COPY_REQUEST: {
+          auto msg = static_cast<StorageServiceFileCopyRequestMessage *>(message.get());
+          return processFileCopyRequest(msg->file, msg->src, msg->src_partition, msg->dst_partition, msg->answer_mailbox);
+        }
 
-      } else {
-        throw std::runtime_error(
-                "SimpleStorageService::processControlMessage(): Unexpected [" + message->getName() + "] message");
+        default: {
+          throw std::runtime_error(
+                  "SimpleStorageService::processControlMessage(): Unexpected [" + message->getName() + "] message");
+        }
       }
     }
 
@@ -355,14 +378,8 @@ namespace wrench {
       // Figure out whether this succeeds or not
       bool success = true;
       std::shared_ptr<FailureCause> failure_cause = nullptr;
-      if (this->stored_files.find(src_partition) != this->stored_files.end()) {
-        std::set<WorkflowFile*> files = this->stored_files[src_partition];
-        if (files.find(file) == files.end()) {
-          WRENCH_INFO("Received a a read request for a file I don't have (%s)", this->getName().c_str());
-          success = false;
-          failure_cause = std::shared_ptr<FailureCause>(new FileNotFound(file, this));
-        }
-      } else {
+      if (not this->stored_files.lookup(src_partition, file)) {
+        WRENCH_INFO("Received a a read request for a file I don't have (%s)", this->getName().c_str());
         success = false;
         failure_cause = std::shared_ptr<FailureCause>(new FileNotFound(file, this));
       }
@@ -499,7 +516,7 @@ namespace wrench {
         // Process the failure, meaning, just re-decrease the occupied space
         this->occupied_space -= connection->file->getSize();
         // And if this was an overwrite, now we lost the file!!!
-        this->stored_files[connection->file_partition].erase(connection->file);
+        this->stored_files.remove(connection->file_partition, connection->file);
 
         WRENCH_INFO(
                 "Sending back an ack since this was a file copy and some client is waiting for me to say something");
@@ -524,8 +541,8 @@ namespace wrench {
                   "SimpleStorageService::processDataConnection(): Mismatch between received file and expected file... a bug in SimpleStorageService");
         }
 
-        // Add the file to my storage (this will not add a duplicate in case of an overwrite, because it's a set)
-        this->stored_files[connection->file_partition].insert(connection->file);
+        // Add the file to my storage (this will not add a duplicate in case of an overwrite)
+        this->stored_files.insert(connection->file_partition, connection->file);
 
         // Send back the corresponding ack?
         if (not connection->ack_mailbox.empty()) {
@@ -39,6 +39,7 @@ namespace wrench {
       this->simulation = nullptr;
       unsigned long seq = S4U_Mailbox::generateUniqueSequenceNumber();
       this->mailbox_name = mailbox_prefix + "_" + std::to_string(seq);
+      this->mailbox = S4U_MailboxHandle(this->mailbox_name, seq);
       this->process_name = process_name_prefix + "_" + std::to_string(seq);
       this->terminated = false;
     }
@@ -132,8 +133,7 @@ namespace wrench {
         this->s4u_actor->on_exit([](int a, void* b) { daemon_goodbye((void*)(intptr_t)a, b); }, (void *) (this));
 
         // Set the mailbox_name receiver
-        simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::by_name(this->mailbox_name);
-        mailbox->set_receiver(this->s4u_actor);
+        this->mailbox.getMailbox()->set_receiver(this->s4u_actor);
       }
     }
 
@@ -30,111 +30,73 @@ namespace wrench {
     class WorkflowTask;
 
     /**
-     * @brief Synchronously receive a message from a mailbox
-     *
-     * @param mailbox_name: the mailbox name
-     * @return the message, or nullptr (in which case it's likely a brutal termination)
-     *
-     * @throw std::shared_ptr<NetworkError>
-     *
-     */
-    std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(std::string mailbox_name) {
-      WRENCH_DEBUG("Getting a message from mailbox_name '%s'", mailbox_name.c_str());
-      simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::by_name(mailbox_name);
-      SimulationMessage *msg = nullptr;
-      try {
-        msg = static_cast<SimulationMessage *>(mailbox->get());
-      } catch (xbt_ex &e) {
-        if (e.category == network_error) {
-          throw std::shared_ptr<NetworkError>(
-                  new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
-        } else if (e.category == timeout_error) {
-            throw std::shared_ptr<NetworkError>(
-                    new NetworkError(NetworkError::RECEIVING, NetworkError::TIMEOUT, mailbox_name));
-        } else {
-          throw std::runtime_error("S4U_Mailbox::getMessage(): Unexpected xbt_ex exception (" + std::to_string(e.category) + ")");
-        }
-      } catch (std::exception &e) {
-        throw std::shared_ptr<NetworkError>(
-                new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
-      }
-      // This is just because it seems that after something like a killAll() we get a nullptr
-      if (msg == nullptr) {
-        throw std::shared_ptr<NetworkError>(
-                new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
-      }
-
-      //Remove this message from the message manager list
-      MessageManager::removeReceivedMessages(mailbox_name,msg);
-      WRENCH_DEBUG("Received a '%s' message from mailbox_name %s", msg->getName().c_str(), mailbox_name.c_str());
-      return std::unique_ptr<SimulationMessage>(msg);
-    }
-
-    /**
-     * @brief Synchronously receive a message from a mailbox, with a timeout
+     * @brief Synchronously receive a message from an S4U mailbox
      *
+     * @param mailbox: the S4U mailbox
      * @param mailbox_name: the mailbox name
      * @param timeout:  a timeout value in seconds (<0 means never timeout)
-     * @return the message, or nullptr (in which case it's likely a brutal termination)
+     * @return the message
      *
      * @throw std::shared_ptr<NetworkError>
      */
-    std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(std::string mailbox_name, double timeout) {
-
+    static std::unique_ptr<SimulationMessage> receiveMessage(simgrid::s4u::MailboxPtr mailbox,
+                                                             const std::string &mailbox_name, double timeout) {
       if (timeout < 0) {
-        return S4U_Mailbox::getMessage(mailbox_name);
+        WRENCH_DEBUG("Getting a message from mailbox_name '%s'", mailbox_name.c_str());
+      } else {
+        WRENCH_DEBUG("Getting a message from mailbox_name '%s' with timeout %lf sec", mailbox_name.c_str(), timeout);
       }
 
-      WRENCH_DEBUG("Getting a message from mailbox_name '%s' with timeout %lf sec", mailbox_name.c_str(), timeout);
-      simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::by_name(mailbox_name);
       void *data = nullptr;
-
       try {
-        data = mailbox->get(timeout);
+        data = (timeout < 0) ? mailbox->get() : mailbox->get(timeout);
       } catch (xbt_ex &e) {
-        if (e.category == timeout_error) {
-          throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, NetworkError::TIMEOUT, mailbox_name));
-        }
         if (e.category == network_error) {
-          throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
+          throw std::shared_ptr<NetworkError>(
+                  new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
+        } else if (e.category == timeout_error) {
+          throw std::shared_ptr<NetworkError>(
+                  new NetworkError(NetworkError::RECEIVING, NetworkError::TIMEOUT, mailbox_name));
         } else {
           throw std::runtime_error("S4U_Mailbox::getMessage(): Unexpected xbt_ex exception (" + std::to_string(e.category) + ")");
         }
       } catch (std::exception &e) {
-        throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
+        throw std::shared_ptr<NetworkError>(
+                new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
       }
 
       // This is just because it seems that after something like a killAll() we get a nullptr
       if (data == nullptr) {
-        throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
+        throw std::shared_ptr<NetworkError>(
+                new NetworkError(NetworkError::RECEIVING, NetworkError::FAILURE, mailbox_name));
       }
 
       auto msg = static_cast<SimulationMessage *>(data);
 
       //Remove this message from the message manager list
-      MessageManager::removeReceivedMessages(mailbox_name,msg);
-
-      WRENCH_INFO("Received a '%s' message from mailbox_name '%s'", msg->getName().c_str(), mailbox_name.c_str());
-
+      MessageManager::removeReceivedMessages(mailbox_name, msg);
+      if (timeout < 0) {
+        WRENCH_DEBUG("Received a '%s' message from mailbox_name %s", msg->getName().c_str(), mailbox_name.c_str());
+      } else {
+        WRENCH_INFO("Received a '%s' message from mailbox_name '%s'", msg->getName().c_str(), mailbox_name.c_str());
+      }
       return std::unique_ptr<SimulationMessage>(msg);
     }
 
     /**
-     * @brief Synchronously send a message to a mailbox
+     * @brief Synchronously send a (managed) message to an S4U mailbox
      *
+     * @param mailbox: the S4U mailbox
      * @param mailbox_name: the mailbox name
      * @param msg: the SimulationMessage
      *
      * @throw std::shared_ptr<NetworkError>
      */
-    void S4U_Mailbox::putMessage(std::string mailbox_name, SimulationMessage *msg) {
+    static void sendMessage(simgrid::s4u::MailboxPtr mailbox, const std::string &mailbox_name, SimulationMessage *msg) {
       WRENCH_DEBUG("Putting a %s message (%.2lf bytes) to mailbox_name '%s'",
                    msg->getName().c_str(), msg->payload,
                    mailbox_name.c_str());
-      simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::by_name(mailbox_name);
       try {
-        //also let the MessageManager manage this message
-        MessageManager::manageMessage(mailbox_name,msg);
         mailbox->put(msg, (uint64_t) msg->payload);
       } catch (xbt_ex &e) {
         if (e.category == network_error) {
@@ -147,28 +109,22 @@ namespace wrench {
       } catch (std::exception &e) {
         throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::SENDING, NetworkError::FAILURE, mailbox_name));
       }
-
-      return;
     }
 
     /**
-     * @brief Asynchronously send a message to a mailbox in a "fire and forget" fashion
+     * @brief Asynchronously send a message to an S4U mailbox in a "fire and forget" fashion
      *
+     * @param mailbox: the S4U mailbox
      * @param mailbox_name: the mailbox name
      * @param msg: the SimulationMessage
      *
      * @throw std::shared_ptr<NetworkError>
      */
-    void S4U_Mailbox::dputMessage(std::string mailbox_name, SimulationMessage *msg) {
-
+    static void detachedSendMessage(simgrid::s4u::MailboxPtr mailbox, const std::string &mailbox_name,
+                                    SimulationMessage *msg) {
       WRENCH_DEBUG("Dputting a %s message (%.2lf bytes) to mailbox_name '%s'",
                    msg->getName().c_str(), msg->payload,
                    mailbox_name.c_str());
-
-      simgrid::s4u::CommPtr comm = nullptr;
-
-      simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::by_name(mailbox_name);
-
       try {
         mailbox->put_init(msg, (uint64_t) msg->payload)->detach();
       } catch (xbt_ex &e) {
@@ -182,8 +138,109 @@ namespace wrench {
       } catch (std::exception &e) {
         throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::SENDING, NetworkError::FAILURE, mailbox_name));
       }
+    }
+
+    /**
+     * @brief Synchronously receive a message from a mailbox
+     *
+     * @param mailbox_name: the mailbox name
+     * @return the message, or nullptr (in which case it's likely a brutal termination)
+     *
+     * @throw std::shared_ptr<NetworkError>
+     *
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(const std::string &mailbox_name) {
+      return receiveMessage(simgrid::s4u::Mailbox::by_name(mailbox_name), mailbox_name, -1);
+    }
+
+    /**
+     * @brief Synchronously receive a message from a mailbox
+     *
+     * @param mailbox: the mailbox handle
+     * @return the message, or nullptr (in which case it's likely a brutal termination)
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(const S4U_MailboxHandle &mailbox) {
+      return receiveMessage(mailbox.getMailbox(), mailbox.getName(), -1);
+    }
+
+    /**
+     * @brief Synchronously receive a message from a mailbox, with a timeout
+     *
+     * @param mailbox_name: the mailbox name
+     * @param timeout:  a timeout value in seconds (<0 means never timeout)
+     * @return the message, or nullptr (in which case it's likely a brutal termination)
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(const std::string &mailbox_name, double timeout) {
+      return receiveMessage(simgrid::s4u::Mailbox::by_name(mailbox_name), mailbox_name, timeout);
+    }
+
+    /**
+     * @brief Synchronously receive a message from a mailbox, with a timeout
+     *
+     * @param mailbox: the mailbox handle
+     * @param timeout:  a timeout value in seconds (<0 means never timeout)
+     * @return the message, or nullptr (in which case it's likely a brutal termination)
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(const S4U_MailboxHandle &mailbox, double timeout) {
+      return receiveMessage(mailbox.getMailbox(), mailbox.getName(), timeout);
+    }
+
+    /**
+     * @brief Synchronously send a message to a mailbox
+     *
+     * @param mailbox_name: the mailbox name
+     * @param msg: the SimulationMessage
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    void S4U_Mailbox::putMessage(const std::string &mailbox_name, SimulationMessage *msg) {
+      //also let the MessageManager manage this message
+      MessageManager::manageMessage(mailbox_name, msg);
+      sendMessage(simgrid::s4u::Mailbox::by_name(mailbox_name), mailbox_name, msg);
+    }
+
+    /**
+     * @brief Synchronously send a message to a mailbox
+     *
+     * @param mailbox: the mailbox handle
+     * @param msg: the SimulationMessage
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    void S4U_Mailbox::putMessage(const S4U_MailboxHandle &mailbox, SimulationMessage *msg) {
+      //also let the MessageManager manage this message
+      MessageManager::manageMessage(mailbox, msg);
+      sendMessage(mailbox.getMailbox(), mailbox.getName(), msg);
+    }
 
-      return;
+    /**
+     * @brief Asynchronously send a message to a mailbox in a "fire and forget" fashion
+     *
+     * @param mailbox_name: the mailbox name
+     * @param msg: the SimulationMessage
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    void S4U_Mailbox::dputMessage(const std::string &mailbox_name, SimulationMessage *msg) {
+      detachedSendMessage(simgrid::s4u::Mailbox::by_name(mailbox_name), mailbox_name, msg);
+    }
+
+    /**
+     * @brief Asynchronously send a message to a mailbox in a "fire and forget" fashion
+     *
+     * @param mailbox: the mailbox handle
+     * @param msg: the SimulationMessage
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    void S4U_Mailbox::dputMessage(const S4U_MailboxHandle &mailbox, SimulationMessage *msg) {
+      detachedSendMessage(mailbox.getMailbox(), mailbox.getName(), msg);
     }
 
     /**
@@ -196,7 +253,7 @@ namespace wrench {
     *
     * @throw std::shared_ptr<NetworkError>
     */
-    std::unique_ptr<S4U_PendingCommunication> S4U_Mailbox::iputMessage(std::string mailbox_name, SimulationMessage *msg) {
+    std::unique_ptr<S4U_PendingCommunication> S4U_Mailbox::iputMessage(const std::string &mailbox_name, SimulationMessage *msg) {
 
       WRENCH_DEBUG("Iputting a %s message (%.2lf bytes) to mailbox_name '%s'",
                    msg->getName().c_str(), msg->payload,
@@ -234,7 +291,7 @@ namespace wrench {
     *
      * @throw std::shared_ptr<NetworkError>
     */
-    std::unique_ptr<S4U_PendingCommunication> S4U_Mailbox::igetMessage(std::string mailbox_name) {
+    std::unique_ptr<S4U_PendingCommunication> S4U_Mailbox::igetMessage(const std::string &mailbox_name) {
 
       simgrid::s4u::CommPtr comm_ptr = nullptr;
 
@@ -274,6 +331,67 @@ namespace wrench {
     }
 
 
+    std::vector<std::string> S4U_Mailbox::free_reply_mailboxes;
+    std::unordered_set<std::string> S4U_Mailbox::reply_mailboxes_in_use;
+
+    /**
+     * @brief Get a mailbox on which to receive the answer(s) to a request, reusing one of the
+     *        mailboxes that have been released if possible (SimGrid never frees mailboxes, so that
+     *        a new mailbox per request would leak memory over long simulations). Callers should
+     *        use an S4U_ReplyMailbox, which releases or discards the mailbox on every path.
+     *
+     *        The mailbox should be released with releaseReplyMailbox() once all messages sent to it have been
+     *        received, and only then. A mailbox on which a message may still arrive (e.g., because of a
+     *        timeout or a network error) should be discarded with discardReplyMailbox() instead, so that it
+     *        never delivers a stale answer to a later request.
+     *
+     * @return a mailbox name
+     */
+    std::string S4U_Mailbox::getReplyMailbox() {
+      std::string mailbox_name;
+      if (S4U_Mailbox::free_reply_mailboxes.empty()) {
+        mailbox_name = S4U_Mailbox::generateUniqueMailboxName("reply");
+      } else {
+        mailbox_name = std::move(S4U_Mailbox::free_reply_mailboxes.back());
+        S4U_Mailbox::free_reply_mailboxes.pop_back();
+      }
+      S4U_Mailbox::reply_mailboxes_in_use.insert(mailbox_name);
+      return mailbox_name;
+    }
+
+    /**
+     * @brief Release a mailbox obtained from getReplyMailbox(), so that it can be reused
+     *
+     * @param mailbox_name: the mailbox name
+     *
+     * @throw std::invalid_argument
+     */
+    void S4U_Mailbox::releaseReplyMailbox(const std::string &mailbox_name) {
+      // A mailbox released twice would be handed out to two requests at once
+      if (S4U_Mailbox::reply_mailboxes_in_use.erase(mailbox_name) == 0) {
+        throw std::invalid_argument("S4U_Mailbox::releaseReplyMailbox(): Mailbox '" + mailbox_name +
+                                    "' is not an in-use reply mailbox");
+      }
+      S4U_Mailbox::free_reply_mailboxes.push_back(mailbox_name);
+    }
+
+    /**
+     * @brief Discard a mailbox obtained from getReplyMailbox() on which a message may still arrive:
+     *        the mailbox is never handed out again, and the messages that were sent to it (and will
+     *        never be received) are deleted
+     *
+     * @param mailbox_name: the mailbox name
+     *
+     * @throw std::invalid_argument
+     */
+    void S4U_Mailbox::discardReplyMailbox(const std::string &mailbox_name) {
+      if (S4U_Mailbox::reply_mailboxes_in_use.erase(mailbox_name) == 0) {
+        throw std::invalid_argument("S4U_Mailbox::discardReplyMailbox(): Mailbox '" + mailbox_name +
+                                    "' is not an in-use reply mailbox");
+      }
+      MessageManager::cleanUpMessages(mailbox_name);
+    }
+
     /**
      * @brief Generate a unique mailbox name given a prefix (this method
      *        simply appends an increasing sequence number to the prefix)
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/simgrid_S4U_util/S4U_MailboxHandle.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor (for a handle that does not refer to any mailbox)
+     */
+    S4U_MailboxHandle::S4U_MailboxHandle() : record(nullptr) {
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param name: the mailbox name
+     * @param id: the mailbox's unique integer identity
+     */
+    S4U_MailboxHandle::S4U_MailboxHandle(const std::string &name, unsigned long id) :
+            record(std::make_shared<Record>()) {
+      this->record->id = id;
+      this->record->name = name;
+    }
+
+    /**
+     * @brief Get the mailbox's integer identity
+     *
+     * @return an id
+     *
+     * @throw std::runtime_error
+     */
+    unsigned long S4U_MailboxHandle::getID() const {
+      if (this->record == nullptr) {
+        throw std::runtime_error("S4U_MailboxHandle::getID(): Handle does not refer to any mailbox");
+      }
+      return this->record->id;
+    }
+
+    /**
+     * @brief Get the mailbox name
+     *
+     * @return the mailbox name
+     *
+     * @throw std::runtime_error
+     */
+    const std::string &S4U_MailboxHandle::getName() const {
+      if (this->record == nullptr) {
+        throw std::runtime_error("S4U_MailboxHandle::getName(): Handle does not refer to any mailbox");
+      }
+      return this->record->name;
+    }
+
+    /**
+     * @brief Get the S4U mailbox, which is looked up by name only upon the first call
+     *
+     * @return the S4U mailbox
+     *
+     * @throw std::runtime_error
+     */
+    simgrid::s4u::MailboxPtr S4U_MailboxHandle::getMailbox() const {
+      if (this->record == nullptr) {
+        throw std::runtime_error("S4U_MailboxHandle::getMailbox(): Handle does not refer to any mailbox");
+      }
+      if (this->record->mailbox == nullptr) {
+        this->record->mailbox = simgrid::s4u::Mailbox::by_name(this->record->name);
+      }
+      return this->record->mailbox;
+    }
+
+};
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <stdexcept>
+
+#include "wrench/simgrid_S4U_util/S4U_ReplyMailbox.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor: get a reply mailbox
+     */
+    S4U_ReplyMailbox::S4U_ReplyMailbox() : name(S4U_Mailbox::getReplyMailbox()) {
+    }
+
+    /**
+     * @brief Move constructor: the mailbox is now held by the new object
+     *
+     * @param other: the reply mailbox to move from
+     */
+    S4U_ReplyMailbox::S4U_ReplyMailbox(S4U_ReplyMailbox &&other) : name(std::move(other.name)) {
+      other.name.clear();
+    }
+
+    /**
+     * @brief Destructor: discard the mailbox if it has not been released
+     */
+    S4U_ReplyMailbox::~S4U_ReplyMailbox() {
+      if (not this->name.empty()) {
+        S4U_Mailbox::discardReplyMailbox(this->name);
+      }
+    }
+
+    /**
+     * @brief Get the mailbox name
+     *
+     * @return the mailbox name
+     *
+     * @throw std::runtime_error
+     */
+    const std::string &S4U_ReplyMailbox::getName() const {
+      if (this->name.empty()) {
+        throw std::runtime_error("S4U_ReplyMailbox::getName(): Mailbox has been released");
+      }
+      return this->name;
+    }
+
+    /**
+     * @brief Release the mailbox, so that it can be reused (all the messages sent to it
+     *        must have been received)
+     *
+     * @throw std::runtime_error
+     */
+    void S4U_ReplyMailbox::release() {
+      if (this->name.empty()) {
+        throw std::runtime_error("S4U_ReplyMailbox::release(): Mailbox has already been released");
+      }
+      S4U_Mailbox::releaseReplyMailbox(this->name);
+      this->name.clear();
+    }
+
+};
@@ -9,22 +9,106 @@
  */
 
 #include "wrench/simulation/SimulationMessage.h"
+#include "wrench/simulation/SimulationMessagePool.h"
+#include "wrench/util/MessageManager.h"
 #include "wrench/workflow/WorkflowFile.h"
 
 namespace wrench {
 
 
+    unsigned long SimulationMessage::num_messages_created[SimulationMessage::NUM_TYPES] = {};
+    unsigned long SimulationMessage::num_messages_alive[SimulationMessage::NUM_TYPES] = {};
+
     /**
      * @brief Constructor
      * @param name: message name (a "human-readable type" really)
      * @param payload: message size in bytes
      */
-    SimulationMessage::SimulationMessage(std::string name, double payload) {
-      if ((name == "") || (payload < 0)) {
+    SimulationMessage::SimulationMessage(std::string name, double payload) :
+            SimulationMessage(GENERIC, std::move(name), payload) {
+    }
+
+    /**
+     * @brief Constructor
+     * @param type: message type
+     * @param name: message name (a "human-readable type" really)
+     * @param payload: message size in bytes
+     */
+    SimulationMessage::SimulationMessage(Type type, std::string name, double payload) {
+      if ((type >= NUM_TYPES) || (name == "") || (payload < 0)) {
         throw std::invalid_argument("SimulationMessage::SimulationMessage(): Invalid arguments");
       }
+      this->type = type;
       this->name = name;
       this->payload = payload;
+      num_messages_created[type]++;
+      num_messages_alive[type]++;
+    }
+
+    /**
+     * @brief Destructor
+     */
+    SimulationMessage::~SimulationMessage() {
+      // A message deleted before it was received is no longer managed
+      if (this->managed_in != nullptr) {
+        MessageManager::unmanageMessage(this);
+      }
+      num_messages_alive[this->type]--;
+    }
+
+    /**
+     * @brief Allocate memory for a message (of any SimulationMessage subclass) from the message pool
+     *
+     * @param size: the size of the message object
+     *
+     * @return a pointer to the allocated memory
+     */
+    void *SimulationMessage::operator new(size_t size) {
+      return SimulationMessagePool::allocate(size);
+    }
+
+    /**
+     * @brief Return the memory of a message to the message pool
+     *
+     * @param ptr: a pointer to the message object
+     * @param size: the size of the message object (i.e., of its dynamic type, since the destructor is virtual)
+     */
+    void SimulationMessage::operator delete(void *ptr, size_t size) {
+      SimulationMessagePool::deallocate(ptr, size);
+    }
+
+    /**
+     * @brief Get the number of messages of a given type that have been created
+     * @param type: a message type
+     * @return a number of messages
+     */
+    unsigned long SimulationMessage::getNumMessagesCreated(Type type) {
+      if (type >= NUM_TYPES) {
+        throw std::invalid_argument("SimulationMessage::getNumMessagesCreated(): Invalid message type");
+      }
+      return num_messages_created[type];
+    }
+
+    /**
+     * @brief Get the number of messages of a given type that currently exist
+     * @param type: a message type
+     * @return a number of messages
+     */
+    unsigned long SimulationMessage::getNumMessagesAlive(Type type) {
+      if (type >= NUM_TYPES) {
+        throw std::invalid_argument("SimulationMessage::getNumMessagesAlive(): Invalid message type");
+      }
+      return num_messages_alive[type];
+    }
+
+    /**
+     * @brief Reset the numbers of messages created to zero (the numbers of messages that
+     *        currently exist are unaffected)
+     */
+    void SimulationMessage::resetNumMessagesCreated() {
+      for (auto &count : num_messages_created) {
+        count = 0;
+      }
     }
 
     /**
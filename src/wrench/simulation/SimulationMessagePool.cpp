@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <new>
+
+#include "wrench/simulation/SimulationMessagePool.h"
+
+namespace wrench {
+
+    /** @brief The number of bytes obtained from the system at once for a size class */
+    static const size_t SIMULATION_MESSAGE_POOL_CHUNK_SIZE = 64 * 1024;
+
+    const size_t SimulationMessagePool::GRANULARITY;
+    const size_t SimulationMessagePool::MAX_BLOCK_SIZE;
+
+    /**
+     * @brief Get the size classes (which are never destroyed, since messages may be
+     *        deleted during the destruction of static objects)
+     *
+     * @return the size classes, by increasing block size
+     */
+    std::vector<SimulationMessagePool::SizeClass> &SimulationMessagePool::getSizeClasses() {
+      static auto size_classes = new std::vector<SizeClass>(MAX_BLOCK_SIZE / GRANULARITY);
+      return *size_classes;
+    }
+
+    /**
+     * @brief Allocate a block for a message
+     *
+     * @param size: the message size, in bytes
+     *
+     * @return a pointer to the block
+     *
+     * @throw std::bad_alloc
+     */
+    void *SimulationMessagePool::allocate(size_t size) {
+      if ((size == 0) or (size > MAX_BLOCK_SIZE)) {
+        return ::operator new(size);
+      }
+
+      SizeClass &size_class = getSizeClasses()[(size - 1) / GRANULARITY];
+      if (size_class.free_list == nullptr) {
+        // Carve a new chunk into free blocks
+        size_t block_size = ((size - 1) / GRANULARITY + 1) * GRANULARITY;
+        size_t num_blocks = SIMULATION_MESSAGE_POOL_CHUNK_SIZE / block_size;
+        char *chunk = static_cast<char *>(::operator new(num_blocks * block_size));
+        for (size_t i = num_blocks; i > 0; i--) {
+          void *block = chunk + (i - 1) * block_size;
+          *static_cast<void **>(block) = size_class.free_list;
+          size_class.free_list = block;
+        }
+        size_class.statistics.block_size = block_size;
+        size_class.statistics.num_blocks += num_blocks;
+      }
+
+      void *block = size_class.free_list;
+      size_class.free_list = *static_cast<void **>(block);
+
+      size_class.statistics.num_allocations++;
+      if (++size_class.statistics.num_in_use > size_class.statistics.max_num_in_use) {
+        size_class.statistics.max_num_in_use = size_class.statistics.num_in_use;
+      }
+      return block;
+    }
+
+    /**
+     * @brief Return the block of a message to the pool
+     *
+     * @param ptr: a pointer to the block
+     * @param size: the message size, in bytes (as passed to allocate())
+     */
+    void SimulationMessagePool::deallocate(void *ptr, size_t size) {
+      if (ptr == nullptr) {
+        return;
+      }
+      if ((size == 0) or (size > MAX_BLOCK_SIZE)) {
+        ::operator delete(ptr);
+        return;
+      }
+
+      SizeClass &size_class = getSizeClasses()[(size - 1) / GRANULARITY];
+      *static_cast<void **>(ptr) = size_class.free_list;
+      size_class.free_list = ptr;
+      size_class.statistics.num_in_use--;
+    }
+
+    /**
+     * @brief Get the usage statistics of the size classes that have been used
+     *
+     * @return a vector of statistics, by increasing block size
+     */
+    std::vector<SimulationMessagePool::SizeClassStatistics> SimulationMessagePool::getSizeClassStatistics() {
+      std::vector<SizeClassStatistics> statistics;
+      for (auto const &size_class : getSizeClasses()) {
+        if (size_class.statistics.num_allocations > 0) {
+          statistics.push_back(size_class.statistics);
+        }
+      }
+      return statistics;
+    }
+
+};
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <functional>
+#include <stdexcept>
+
+#include "wrench/util/IDTable.h"
+
+namespace wrench {
+
+    /** @brief The initial number of hash table slots (a power of 2) */
+    static const unsigned long ID_TABLE_INITIAL_NUM_SLOTS = 16;
+
+    const unsigned long IDTable::NOT_FOUND = (unsigned long) -1;
+
+    /**
+     * @brief Constructor (indices of erased IDs are never reused)
+     */
+    IDTable::IDTable() : IDTable(false) {
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param reuse_erased_indices: whether the indices of erased IDs should be reused for new IDs
+     */
+    IDTable::IDTable(bool reuse_erased_indices) : slots(ID_TABLE_INITIAL_NUM_SLOTS, 0), num_entries(0),
+                                                  reuse_erased_indices(reuse_erased_indices) {
+    }
+
+    /**
+     * @brief Intern an ID
+     *
+     * @param id: the ID
+     *
+     * @return a pair made of the ID's index and of whether the ID was inserted (false if it was already in the table)
+     */
+    std::pair<unsigned long, bool> IDTable::insert(const std::string &id) {
+
+      // Keep the load factor at most 1/2
+      if (2 * (this->num_entries + 1) > this->slots.size()) {
+        this->grow();
+      }
+
+      size_t hash = std::hash<std::string>()(id);
+      unsigned long slot = this->findSlot(id, hash);
+      if (this->slots[slot] != 0) {
+        return std::make_pair(this->slots[slot] - 1, false);
+      }
+
+      unsigned long index;
+      if (not this->erased_indices.empty()) {
+        index = this->erased_indices.back();
+        this->erased_indices.pop_back();
+        this->strings[index] = id;
+      } else {
+        index = this->strings.size();
+        this->strings.push_back(id);
+      }
+      this->slots[slot] = index + 1;
+      this->num_entries++;
+      return std::make_pair(index, true);
+    }
+
+    /**
+     * @brief Find the index of an ID
+     *
+     * @param id: the ID
+     *
+     * @return the ID's index, or IDTable::NOT_FOUND
+     */
+    unsigned long IDTable::find(const std::string &id) const {
+      unsigned long slot = this->findSlot(id, std::hash<std::string>()(id));
+      return (this->slots[slot] == 0) ? NOT_FOUND : (this->slots[slot] - 1);
+    }
+
+    /**
+     * @brief Remove an ID from the table (its index is reused only if the table was constructed to do so)
+     *
+     * @param index: the ID's index
+     *
+     * @throw std::invalid_argument
+     */
+    void IDTable::erase(unsigned long index) {
+      if ((index >= this->strings.size()) or (this->find(this->strings[index]) != index)) {
+        throw std::invalid_argument("IDTable::erase(): Invalid index");
+      }
+
+      unsigned long mask = this->slots.size() - 1;
+      unsigned long slot = this->findSlot(this->strings[index], std::hash<std::string>()(this->strings[index]));
+      this->slots[slot] = 0;
+      this->num_entries--;
+      std::string().swap(this->strings[index]);
+      if (this->reuse_erased_indices) {
+        this->erased_indices.push_back(index);
+      }
+
+      // Backward-shift deletion: move up the entries of the probe sequence that follows the freed slot
+      unsigned long next = (slot + 1) & mask;
+      while (this->slots[next] != 0) {
+        const std::string &next_id = this->strings[this->slots[next] - 1];
+        unsigned long home = std::hash<std::string>()(next_id) & mask;
+        // Move the entry if its home slot is not (cyclically) in (slot, next]
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+          this->slots[slot] = this->slots[next];
+          this->slots[next] = 0;
+          slot = next;
+        }
+        next = (next + 1) & mask;
+      }
+    }
+
+    /**
+     * @brief Get the ID with a given index
+     *
+     * @param index: the index
+     *
+     * @return the ID (an empty string if it was erased)
+     */
+    const std::string &IDTable::getString(unsigned long index) const {
+      return this->strings[index];
+    }
+
+    /**
+     * @brief Get the number of indices that have been allocated so far (i.e., an upper bound on
+     *        the indices of the IDs in the table)
+     *
+     * @return a number of indices
+     */
+    unsigned long IDTable::getNumIndices() const {
+      return this->strings.size();
+    }
+
+    /**
+     * @brief Double the number of hash table slots
+     */
+    void IDTable::grow() {
+      // Swap in twice as many empty slots, and re-insert the entries of the previous ones
+      std::vector<unsigned long> old_slots(2 * this->slots.size(), 0);
+      old_slots.swap(this->slots);
+      unsigned long mask = this->slots.size() - 1;
+      for (auto entry : old_slots) {
+        if (entry != 0) {
+          unsigned long slot = std::hash<std::string>()(this->strings[entry - 1]) & mask;
+          while (this->slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+          }
+          this->slots[slot] = entry;
+        }
+      }
+    }
+
+    /**
+     * @brief Find the slot that holds an ID, or the empty slot where it would be inserted
+     *
+     * @param id: the ID
+     * @param hash: the ID's hash
+     *
+     * @return a slot
+     */
+    unsigned long IDTable::findSlot(const std::string &id, size_t hash) const {
+      unsigned long mask = this->slots.size() - 1;
+      unsigned long slot = hash & mask;
+      while ((this->slots[slot] != 0) and (this->strings[this->slots[slot] - 1] != id)) {
+        slot = (slot + 1) & mask;
+      }
+      return slot;
+    }
+
+};
@@ -15,7 +15,7 @@ namespace wrench {
 
     // TODO: At some point, we may want to make this with only unique pointers...
 
-    std::map<std::string, std::vector<SimulationMessage *>> MessageManager::mailbox_messages = {};
+    std::unordered_map<std::string, std::shared_ptr<ManagedMessageList>> MessageManager::mailbox_messages = {};
 
     /**
      * @brief Insert a message in the manager's  "database"
@@ -23,10 +23,34 @@ namespace wrench {
      * @param msg: the message
      */
     void MessageManager::manageMessage(std::string mailbox, SimulationMessage *msg) {
-      if (mailbox_messages.find(mailbox) == mailbox_messages.end()) {
-        mailbox_messages.insert({mailbox, {}});
+      // A message that is sent again is only managed for its last mailbox
+      if (msg->managed_in != nullptr) {
+        unmanageMessage(msg);
       }
-      mailbox_messages[mailbox].push_back(msg);
+      ManagedMessageList *list = getMessageList(mailbox).get();
+      msg->managed_in = list;
+      msg->managed_index = list->messages.size();
+      list->messages.push_back(msg);
+    }
+
+    /**
+     * @brief Insert a message in the manager's  "database", without looking up the mailbox name
+     *        (but for the first message sent to the mailbox, or after the mailbox was cleaned up)
+     * @param mailbox: the handle of the relevant mailbox
+     * @param msg: the message
+     */
+    void MessageManager::manageMessage(const S4U_MailboxHandle &mailbox, SimulationMessage *msg) {
+      if (msg->managed_in != nullptr) {
+        unmanageMessage(msg);
+      }
+      std::shared_ptr<ManagedMessageList> &handle_list = mailbox.record->managed_messages;
+      if ((handle_list == nullptr) or handle_list->erased) {
+        handle_list = getMessageList(mailbox.getName());
+      }
+      ManagedMessageList *list = handle_list.get();
+      msg->managed_in = list;
+      msg->managed_index = list->messages.size();
+      list->messages.push_back(msg);
     }
 
     /**
@@ -34,15 +58,16 @@ namespace wrench {
      * @param mailbox: the mailbox name
      */
     void MessageManager::cleanUpMessages(std::string mailbox) {
-      std::map<std::string, std::vector<SimulationMessage *>>::iterator msg_itr;
-      for (msg_itr = mailbox_messages.begin(); msg_itr != mailbox_messages.end(); msg_itr++) {
-        if ((*msg_itr).first == mailbox) {
-          for (size_t i = 0; i < (*msg_itr).second.size(); i++) {
-            delete (*msg_itr).second[i];
-          }
-          (*msg_itr).second.clear();
-        }
+      auto msg_itr = mailbox_messages.find(mailbox);
+      if (msg_itr == mailbox_messages.end()) {
+        return;
       }
+      for (auto msg : msg_itr->second->messages) {
+        msg->managed_in = nullptr;
+        delete msg;
+      }
+      msg_itr->second->messages.clear();
+      eraseMessageList(msg_itr);
     }
 
     /**
@@ -51,17 +76,64 @@ namespace wrench {
      * @param msg: the message
      */
     void MessageManager::removeReceivedMessages(std::string mailbox, SimulationMessage *msg) {
-      std::map<std::string, std::vector<SimulationMessage *>>::iterator msg_itr;
-      for (msg_itr = mailbox_messages.begin(); msg_itr != mailbox_messages.end(); msg_itr++) {
-        if ((*msg_itr).first == mailbox) {
-          std::vector<SimulationMessage *>::iterator it;
-          for (it = (*msg_itr).second.begin(); it != (*msg_itr).second.end(); it++) {
-            if ((*it) == msg) {
-              it = (*msg_itr).second.erase(it);
-              break;
-            }
-          }
+      // The message knows where it is managed (if it is managed at all, since messages sent
+      // asynchronously are not), so the mailbox name does not need to be looked up
+      if (msg->managed_in != nullptr) {
+        unmanageMessage(msg);
+      }
+    }
+
+    /**
+     * @brief Remove a message from the "database" of messages, in constant time (the
+     *        last message of its mailbox's list takes its position)
+     * @param msg: the message
+     */
+    void MessageManager::unmanageMessage(SimulationMessage *msg) {
+      ManagedMessageList *list = msg->managed_in;
+      SimulationMessage *last = list->messages.back();
+      list->messages[msg->managed_index] = last;
+      last->managed_index = msg->managed_index;
+      list->messages.pop_back();
+      msg->managed_in = nullptr;
+
+      // An empty list is erased, unless a mailbox handle refers to it
+      if (list->messages.empty()) {
+        auto msg_itr = mailbox_messages.find(list->mailbox);
+        if (msg_itr->second.use_count() == 1) {
+          eraseMessageList(msg_itr);
         }
       }
     }
+
+    /**
+     * @brief Get the number of mailboxes for which the manager has a list of messages
+     * @return a number of mailboxes
+     */
+    unsigned long MessageManager::getNumMessageLists() {
+      return mailbox_messages.size();
+    }
+
+    /**
+     * @brief Get the list of messages of a mailbox (which is created if need be)
+     * @param mailbox: the mailbox name
+     * @return the list
+     */
+    const std::shared_ptr<ManagedMessageList> &MessageManager::getMessageList(const std::string &mailbox) {
+      std::shared_ptr<ManagedMessageList> &list = mailbox_messages[mailbox];
+      if (list == nullptr) {
+        list = std::make_shared<ManagedMessageList>();
+        list->mailbox = mailbox;
+      }
+      return list;
+    }
+
+    /**
+     * @brief Erase a (empty) list of messages
+     * @param msg_itr: the list's entry
+     */
+    void MessageManager::eraseMessageList(std::unordered_map<std::string, std::shared_ptr<ManagedMessageList>>::iterator msg_itr) {
+      // A mailbox handle may still hold the list, and must then not use it anymore
+      msg_itr->second->erased = true;
+      mailbox_messages.erase(msg_itr);
+    }
 }
@@ -0,0 +1,421 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "wrench/util/XMLStreamReader.h"
+
+namespace wrench {
+
+    /** @brief The size of the chunks read from the input stream */
+    static const size_t XML_STREAM_READER_BUFFER_SIZE = 1 << 16;
+
+    const std::string XMLStreamReader::empty_string = "";
+
+    /**
+     * @brief Check whether a character can be part of an element/attribute name
+     *
+     * @param c: the character
+     *
+     * @return true or false
+     */
+    static inline bool isNameCharacter(int c) {
+      return (c != EOF) and (not isspace(c)) and (c != '>') and (c != '/') and (c != '=');
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param input: the stream from which the XML document is read
+     */
+    XMLStreamReader::XMLStreamReader(std::istream &input) :
+            input(input), buffer(XML_STREAM_READER_BUFFER_SIZE), buffer_position(0), buffer_end(0), line(1),
+            num_attributes(0), depth(0), pending_end_element(false), seen_root_element(false) {
+    }
+
+    /**
+     * @brief Advance to the next element start/end tag in the document
+     *
+     * @return the event
+     *
+     * @throw std::invalid_argument
+     */
+    XMLStreamReader::Event XMLStreamReader::next() {
+
+      this->num_attributes = 0;
+
+      // An empty element (<name .../>) is reported as a start followed by an end
+      if (this->pending_end_element) {
+        this->pending_end_element = false;
+        this->open_elements.pop_back();
+        this->depth = this->open_elements.size();
+        return END_ELEMENT;
+      }
+
+      while (true) {
+        int c = this->get();
+
+        if (c == EOF) {
+          if (not this->open_elements.empty()) {
+            this->fail("Unexpected end of document (unclosed element <" + this->open_elements.back() + ">)");
+          }
+          if (not this->seen_root_element) {
+            this->fail("No root element");
+          }
+          this->name.clear();
+          this->depth = 0;
+          return END_OF_DOCUMENT;
+        }
+
+        if (c != '<') {
+          // Character data is ignored, but only whitespace is allowed outside the root element
+          if (this->open_elements.empty() and (not isspace(c))) {
+            this->fail("Unexpected character data outside of the root element");
+          }
+          continue;
+        }
+
+        c = this->get();
+
+        if (c == '?') {
+          this->skipUntil("?>");
+          continue;
+        }
+
+        if (c == '!') {
+          c = this->get();
+          if (c == '-') {
+            if (this->get() != '-') {
+              this->fail("Invalid comment");
+            }
+            this->skipUntil("-->");
+          } else if (c == '[') {
+            for (const char *expected = "CDATA["; *expected; expected++) {
+              if (this->get() != *expected) {
+                this->fail("Invalid CDATA section");
+              }
+            }
+            this->skipUntil("]]>");
+          } else {
+            this->skipDeclaration();
+          }
+          continue;
+        }
+
+        if (c == '/') {
+          this->readName(this->get(), this->name);
+          if (this->getNonSpace() != '>') {
+            this->fail("Invalid end tag </" + this->name + ">");
+          }
+          if (this->open_elements.empty() or (this->open_elements.back() != this->name)) {
+            this->fail("Unexpected end tag </" + this->name + ">");
+          }
+          this->open_elements.pop_back();
+          this->depth = this->open_elements.size();
+          return END_ELEMENT;
+        }
+
+        // Start tag
+        if (this->seen_root_element and this->open_elements.empty()) {
+          this->fail("Multiple root elements");
+        }
+        this->readName(c, this->name);
+
+        while (true) {
+          c = this->getNonSpace();
+          if (c == '>') {
+            break;
+          }
+          if (c == '/') {
+            if (this->get() != '>') {
+              this->fail("Invalid start tag <" + this->name + ">");
+            }
+            this->pending_end_element = true;
+            break;
+          }
+          if (this->num_attributes == this->attributes.size()) {
+            this->attributes.emplace_back();
+          }
+          std::pair<std::string, std::string> &attribute = this->attributes[this->num_attributes];
+          this->readName(c, attribute.first);
+          if (this->getNonSpace() != '=') {
+            this->fail("Missing value for attribute " + attribute.first + " in start tag <" + this->name + ">");
+          }
+          c = this->getNonSpace();
+          if ((c != '"') and (c != '\'')) {
+            this->fail("Unquoted value for attribute " + attribute.first + " in start tag <" + this->name + ">");
+          }
+          this->readAttributeValue(c, attribute.second);
+          this->num_attributes++;
+        }
+
+        this->depth = this->open_elements.size();
+        this->open_elements.push_back(this->name);
+        this->seen_root_element = true;
+        return START_ELEMENT;
+      }
+    }
+
+    /**
+     * @brief Get the name of the element of the current start/end event
+     *
+     * @return an element name
+     */
+    const std::string &XMLStreamReader::getName() const {
+      return this->name;
+    }
+
+    /**
+     * @brief Get the depth of the element of the current start/end event (0 for the root element)
+     *
+     * @return a depth
+     */
+    unsigned long XMLStreamReader::getDepth() const {
+      return this->depth;
+    }
+
+    /**
+     * @brief Check whether the element of the current start event has an attribute
+     *
+     * @param name: the attribute name
+     *
+     * @return true or false
+     */
+    bool XMLStreamReader::hasAttribute(const std::string &name) const {
+      for (unsigned long i = 0; i < this->num_attributes; i++) {
+        if (this->attributes[i].first == name) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /**
+     * @brief Get the (decoded) value of an attribute of the element of the current start event
+     *
+     * @param name: the attribute name
+     *
+     * @return the attribute value, or an empty string if the element does not have that attribute
+     */
+    const std::string &XMLStreamReader::getAttribute(const std::string &name) const {
+      for (unsigned long i = 0; i < this->num_attributes; i++) {
+        if (this->attributes[i].first == name) {
+          return this->attributes[i].second;
+        }
+      }
+      return XMLStreamReader::empty_string;
+    }
+
+    /**
+     * @brief Get the next character from the input
+     *
+     * @return a character, or EOF
+     */
+    inline int XMLStreamReader::get() {
+      if ((this->buffer_position == this->buffer_end) and (not this->fill())) {
+        return EOF;
+      }
+      char c = this->buffer[this->buffer_position++];
+      if (c == '\n') {
+        this->line++;
+      }
+      return (unsigned char) c;
+    }
+
+    /**
+     * @brief Read the next chunk of the input into the buffer
+     *
+     * @return false if the end of the input has been reached
+     */
+    bool XMLStreamReader::fill() {
+      this->input.read(this->buffer.data(), this->buffer.size());
+      this->buffer_position = 0;
+      this->buffer_end = (size_t) this->input.gcount();
+      return (this->buffer_end > 0);
+    }
+
+    /**
+     * @brief Get the next character from the input without consuming it
+     *
+     * @return a character, or EOF
+     */
+    inline int XMLStreamReader::peek() {
+      if ((this->buffer_position == this->buffer_end) and (not this->fill())) {
+        return EOF;
+      }
+      return (unsigned char) this->buffer[this->buffer_position];
+    }
+
+    /**
+     * @brief Get the next non-whitespace character from the input
+     *
+     * @return a character, or EOF
+     */
+    int XMLStreamReader::getNonSpace() {
+      int c;
+      do {
+        c = this->get();
+      } while ((c != EOF) and isspace(c));
+      return c;
+    }
+
+    /**
+     * @brief Read an element or attribute name
+     *
+     * @param c: the first character of the name
+     * @param name: the string in which the name is stored
+     */
+    void XMLStreamReader::readName(int c, std::string &name) {
+      name.clear();
+      if (isNameCharacter(c)) {
+        name.push_back((char) c);
+        // Only consume the next characters that are part of the name
+        while (isNameCharacter(c = this->peek())) {
+          name.push_back((char) c);
+          this->buffer_position++;
+        }
+      }
+      if (name.empty()) {
+        this->fail("Missing name");
+      }
+    }
+
+    /**
+     * @brief Read a quoted attribute value and decode its entity/character references
+     *
+     * @param quote: the opening quote character
+     * @param value: the string in which the decoded value is stored
+     */
+    void XMLStreamReader::readAttributeValue(int quote, std::string &value) {
+      value.clear();
+      while (true) {
+        int c = this->get();
+        if (c == EOF) {
+          this->fail("Unterminated attribute value");
+        }
+        if (c == quote) {
+          return;
+        }
+        if (c != '&') {
+          value.push_back((char) c);
+          continue;
+        }
+
+        std::string reference;
+        while (((c = this->get()) != ';') and (c != EOF) and (c != quote) and (reference.size() < 16)) {
+          reference.push_back((char) c);
+        }
+        if (c != ';') {
+          this->fail("Invalid entity reference &" + reference);
+        }
+
+        if (reference == "amp") {
+          value.push_back('&');
+        } else if (reference == "lt") {
+          value.push_back('<');
+        } else if (reference == "gt") {
+          value.push_back('>');
+        } else if (reference == "quot") {
+          value.push_back('"');
+        } else if (reference == "apos") {
+          value.push_back('\'');
+        } else if ((reference.size() > 1) and (reference[0] == '#')) {
+          char *end;
+          unsigned long code_point = (reference[1] == 'x') ?
+                                     strtoul(reference.c_str() + 2, &end, 16) :
+                                     strtoul(reference.c_str() + 1, &end, 10);
+          if ((*end != '\0') or (code_point > 0x10FFFF)) {
+            this->fail("Invalid character reference &" + reference + ";");
+          }
+          // UTF-8 encoding
+          if (code_point < 0x80) {
+            value.push_back((char) code_point);
+          } else if (code_point < 0x800) {
+            value.push_back((char) (0xC0 | (code_point >> 6)));
+            value.push_back((char) (0x80 | (code_point & 0x3F)));
+          } else if (code_point < 0x10000) {
+            value.push_back((char) (0xE0 | (code_point >> 12)));
+            value.push_back((char) (0x80 | ((code_point >> 6) & 0x3F)));
+            value.push_back((char) (0x80 | (code_point & 0x3F)));
+          } else {
+            value.push_back((char) (0xF0 | (code_point >> 18)));
+            value.push_back((char) (0x80 | ((code_point >> 12) & 0x3F)));
+            value.push_back((char) (0x80 | ((code_point >> 6) & 0x3F)));
+            value.push_back((char) (0x80 | (code_point & 0x3F)));
+          }
+        } else {
+          // Unknown (e.g., DTD-defined) entities are kept as is
+          value += "&" + reference + ";";
+        }
+      }
+    }
+
+    /**
+     * @brief Skip the input up to (and including) a terminator string
+     *
+     * @param terminator: the terminator string (e.g., "-->")
+     */
+    void XMLStreamReader::skipUntil(const std::string &terminator) {
+      std::string tail;
+      while (true) {
+        int c = this->get();
+        if (c == EOF) {
+          this->fail("Missing \"" + terminator + "\"");
+        }
+        tail.push_back((char) c);
+        if (tail.size() > terminator.size()) {
+          tail.erase(0, 1);
+        }
+        if (tail == terminator) {
+          return;
+        }
+      }
+    }
+
+    /**
+     * @brief Skip a <!...> declaration (e.g., DOCTYPE, possibly with an internal subset)
+     */
+    void XMLStreamReader::skipDeclaration() {
+      int nesting = 0;
+      int quote = 0;
+      while (true) {
+        int c = this->get();
+        if (c == EOF) {
+          this->fail("Unterminated declaration");
+        }
+        if (quote) {
+          if (c == quote) {
+            quote = 0;
+          }
+        } else if ((c == '"') or (c == '\'')) {
+          quote = c;
+        } else if (c == '[') {
+          nesting++;
+        } else if (c == ']') {
+          nesting--;
+        } else if ((c == '>') and (nesting <= 0)) {
+          return;
+        }
+      }
+    }
+
+    /**
+     * @brief Throw an exception describing a parse error
+     *
+     * @param message: the error message
+     *
+     * @throw std::invalid_argument
+     */
+    void XMLStreamReader::fail(const std::string &message) {
+      throw std::invalid_argument("XMLStreamReader::next(): " + message + " (line " + std::to_string(this->line) + ")");
+    }
+
+};
@@ -90,7 +90,7 @@ namespace wrench {
         std::unique_ptr<SimulationMessage> message = nullptr;
 
         try {
-          message = S4U_Mailbox::getMessage(this->mailbox_name);
+          message = S4U_Mailbox::getMessage(this->mailbox);
         } catch (std::shared_ptr<NetworkError> &cause) {
           throw std::runtime_error(cause->toString());
         }
@@ -15,10 +15,11 @@ namespace wrench {
     /**
      * @brief Constructor
      *
+     * @param type: the message type
      * @param name: the message name
      * @param payload: the message size in bytes
      */
-    WMSMessage::WMSMessage(std::string name, double payload) : SimulationMessage("WMSMessage::" + name, payload) {}
+    WMSMessage::WMSMessage(SimulationMessage::Type type, std::string name, double payload) : SimulationMessage(type, "WMSMessage::" + name, payload) {}
 
     /**
      * @brief Constructor
@@ -26,6 +27,6 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    AlarmWMSDeferredStartMessage::AlarmWMSDeferredStartMessage(double payload) : WMSMessage("WMS_START_TIME", payload) {}
+    AlarmWMSDeferredStartMessage::AlarmWMSDeferredStartMessage(double payload) : WMSMessage(SimulationMessage::ALARM_WMS_DEFERRED_START, "WMS_START_TIME", payload) {}
 
 };
@@ -23,7 +23,7 @@ namespace wrench {
     */
     class WMSMessage : public SimulationMessage {
     protected:
-        WMSMessage(std::string name, double payload);
+        WMSMessage(SimulationMessage::Type type, std::string name, double payload);
     };
 
     /**
@@ -9,10 +9,19 @@
 
 #include <lemon/list_graph.h>
 #include <lemon/graph_to_eps.h>
-#include <lemon/bfs.h>
-#include <pugixml.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <nlohmann/json.hpp>
+#include <unordered_map>
+#include <unordered_set>
 #include <wrench/util/UnitParser.h>
+#include <wrench/util/XMLStreamReader.h>
 #include <wrench/workflow/WorkflowTask.h>
 
 #include "wrench/logging/TerminalOutput.h"
@@ -24,6 +33,64 @@ XBT_LOG_NEW_DEFAULT_CATEGORY(workflow, "Log category for Workflow");
 
 namespace wrench {
 
+    /**
+     * Binary workflow snapshot format (see Workflow::saveBinary()): a header followed by arrays of
+     * fixed-size records (files and tasks in ID order, task file uses, dependencies, file transfers), all
+     * 8-byte aligned, and by a string table that the records refer to
+     */
+    static const char WORKFLOW_BINARY_MAGIC[8] = {'W', 'R', 'E', 'N', 'C', 'H', 'W', 'F'};
+    static const uint32_t WORKFLOW_BINARY_VERSION = 1;
+    static const uint32_t WORKFLOW_BINARY_BYTE_ORDER = 0x01020304;
+
+    struct WorkflowBinaryHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        uint64_t num_files;
+        uint64_t num_tasks;
+        uint64_t num_file_uses;
+        uint64_t num_edges;
+        uint64_t num_transfers;
+        uint64_t string_table_size;
+    };
+
+    struct WorkflowBinaryString {
+        uint64_t offset;  // in the string table
+        uint64_t length;
+    };
+
+    struct WorkflowBinaryFile {
+        WorkflowBinaryString id;
+        double size;
+    };
+
+    struct WorkflowBinaryTask {
+        WorkflowBinaryString id;
+        WorkflowBinaryString cluster_id;
+        double flops;
+        uint64_t min_num_cores;
+        uint64_t max_num_cores;
+        double parallel_efficiency;
+        double memory_requirement;
+        int64_t priority;
+        uint64_t task_type;
+        uint64_t topological_rank;  // Position in a topological order of the tasks
+        uint64_t num_input_files;   // The task's input and then output file indices are
+        uint64_t num_output_files;  // stored next in the file use array
+    };
+
+    struct WorkflowBinaryEdge {
+        uint64_t parent;  // task indices
+        uint64_t child;
+    };
+
+    struct WorkflowBinaryTransfer {
+        uint64_t task;
+        uint64_t file;
+        WorkflowBinaryString src;
+        WorkflowBinaryString dest;
+    };
+
     /**
      * @brief Create and add a new computational task to the workflow
      *
@@ -53,29 +120,58 @@ namespace wrench {
         throw std::invalid_argument("WorkflowTask::addTask(): Invalid argument");
       }
 
-      // Check that the task doesn't really exist
-      if (tasks.find(id) != tasks.end()) {
+      // Check that the task doesn't really exist, and intern its ID
+      std::pair<unsigned long, bool> interned_id = this->task_ids.insert(id);
+      if (not interned_id.second) {
         throw std::invalid_argument("Workflow::addTask(): Task ID '" + id + "' already exists");
       }
 
       // Create the WorkflowTask object
-      WorkflowTask *task = new WorkflowTask(id, flops, min_num_cores, max_num_cores, parallel_efficiency,
-                                            memory_requirement, type);
+      WorkflowTask *task = new WorkflowTask(interned_id.first, flops, min_num_cores, max_num_cores,
+                                            parallel_efficiency, memory_requirement, type);
       // Create a DAG node for it
       task->workflow = this;
       task->DAG = this->DAG.get();
       task->DAG_node = DAG->addNode();
       task->toplevel = 0; // upon creation, a task is an entry task
+      task->topological_index = this->next_topological_index++; // and can go last in the topological order
 
-      // Update the workflow's number of levels
-      if (this->getNumLevels() < 1 + task->toplevel) {
+      // Update the workflow's number of levels (if it's not going to be recomputed anyway)
+      if (this->top_levels_up_to_date and (this->num_levels < 1 + task->toplevel)) {
         this->setNumLevels(1 + task->toplevel);
       }
 
       // Add it to the DAG node's metadata
       (*DAG_node_map)[task->DAG_node] = task;
       // Add it to the set of workflow tasks
-      tasks[task->id] = std::unique_ptr<WorkflowTask>(task); // owner
+      this->tasks.push_back(std::unique_ptr<WorkflowTask>(task)); // owner
+      this->num_tasks++;
+
+      // Keep the tasks sorted by ID (in constant time when tasks are added by increasing ID)
+      if (this->tasks_by_id_up_to_date) {
+        // The entries of removed tasks at the end can be dropped right away
+        while ((not this->tasks_by_id.empty()) and (this->tasks_by_id.back() == nullptr)) {
+          this->tasks_by_id.pop_back();
+          this->num_removed_tasks_by_id--;
+        }
+        if (this->tasks_by_id.empty() or
+            (this->task_ids.getString(this->tasks_by_id.back()->index) < id)) {
+          task->by_id_position = this->tasks_by_id.size();
+          this->tasks_by_id.push_back(task);
+        } else {
+          this->tasks_by_id_up_to_date = false;
+          this->tasks_by_id.clear();
+          this->num_removed_tasks_by_id = 0;
+        }
+      }
+
+      // A new task has no children nor parents
+      this->children.addIndex();
+      this->parents.addIndex();
+
+      // Upon creation, a task is ready
+      this->ready_tasks.emplace_hint(this->ready_tasks.end(), id, task);
+      this->num_tasks_in_state[task->getState()]++;
 
       return task;
     }
@@ -95,12 +191,51 @@ namespace wrench {
       }
 
       // check that task exists (this should never happen)
-      if (tasks.find(task->id) == tasks.end()) {
-        throw std::invalid_argument("Workflow::removeTask(): Task '" + task->id + "' does not exist");
+      if ((task->workflow != this) or (this->tasks[task->index].get() != task)) {
+        throw std::invalid_argument("Workflow::removeTask(): Task '" + task->getID() + "' does not exist");
       }
 
+      const std::string &id = this->task_ids.getString(task->index);
+
+      // Remove it from the ready/cluster indices and state counters
+      this->ready_tasks.erase(id);
+      if (not task->getClusterID().empty()) {
+        this->clustered_tasks[task->getClusterID()].erase(id);
+        if (this->clustered_tasks[task->getClusterID()].empty()) {
+          this->clustered_tasks.erase(task->getClusterID());
+        }
+      }
+      this->num_tasks_in_state[task->getState()]--;
+
+      // Top-levels of descendants, and the number of levels, may change
+      this->top_levels_up_to_date = false;
+
+      // Leave a nullptr in the task's position, so that removing a task takes constant time (the
+      // list is compacted upon the next getTasks())
+      if (this->tasks_by_id_up_to_date) {
+        this->tasks_by_id[task->by_id_position] = nullptr;
+        this->num_removed_tasks_by_id++;
+      }
+
+      bool completed = (task->getInternalState() == WorkflowTask::InternalState::TASK_COMPLETED);
+      for (auto child : this->children.getSpan(task->index)) {
+        this->parents.remove(child->index, task);
+        child->num_parents--;
+        if (not completed) {
+          child->num_incomplete_parents--;
+        }
+      }
+      for (auto parent : this->parents.getSpan(task->index)) {
+        this->children.remove(parent->index, task);
+        parent->num_children--;
+      }
+      this->children.clear(task->index);
+      this->parents.clear(task->index);
+
       DAG.get()->erase(task->DAG_node);
-      tasks.erase(tasks.find(task->id));
+      this->task_ids.erase(task->index);
+      this->tasks[task->index].reset();
+      this->num_tasks--;
     }
 
     /**
@@ -113,10 +248,11 @@ namespace wrench {
      * @throw std::invalid_argument
      */
     WorkflowTask *Workflow::getTaskByID(const std::string id) {
-      if (tasks.find(id) == tasks.end()) {
+      unsigned long index = this->task_ids.find(id);
+      if (index == IDTable::NOT_FOUND) {
         throw std::invalid_argument("Workflow::getTaskByID(): Unknown WorkflowTask ID " + id);
       }
-      return tasks[id].get();
+      return this->tasks[index].get();
     }
 
     /**
@@ -134,12 +270,36 @@ namespace wrench {
         throw std::invalid_argument("Workflow::addControlDependency(): Invalid arguments");
       }
 
-      if (not pathExists(src, dst)) {
+      if (src == dst) {
+        throw std::invalid_argument("Workflow::addControlDependency(): Task " + src->getID() +
+                                    " cannot depend on itself");
+      }
+
+      // If src comes after dst in the topological order, there cannot be a path
+      // from src to dst, but the new arc may create a cycle and the order must be fixed
+      bool path_exists = false;
+      if (src->topological_index > dst->topological_index) {
+        this->updateTopologicalOrder(src, dst);
+      } else {
+        path_exists = pathExists(src, dst);
+      }
+
+      if (not path_exists) {
 
         WRENCH_DEBUG("Adding control dependency %s-->%s", src->getID().c_str(), dst->getID().c_str());
         DAG->addArc(src->DAG_node, dst->DAG_node);
+        this->children.add(src->index, dst);
+        this->parents.add(dst->index, src);
+        src->num_children++;
+        dst->num_parents++;
+        if (src->getInternalState() != WorkflowTask::InternalState::TASK_COMPLETED) {
+          dst->num_incomplete_parents++;
+        }
 
-        dst->updateTopLevel();
+        // Top-levels are recomputed lazily, and only if the new arc can change them
+        if (this->top_levels_up_to_date and (dst->toplevel < 1 + src->toplevel)) {
+          this->top_levels_up_to_date = false;
+        }
 
         if (src->getState() != WorkflowTask::State::COMPLETED) {
           dst->setInternalState(WorkflowTask::InternalState::TASK_NOT_READY);
@@ -165,16 +325,29 @@ namespace wrench {
         throw std::invalid_argument("Workflow::addFile(): Invalid arguments");
       }
 
-      // Create the WorkflowFile object
-      if (files.find(id) != files.end()) {
+      // Check that the file doesn't already exist, and intern its ID
+      std::pair<unsigned long, bool> interned_id = this->file_ids.insert(id);
+      if (not interned_id.second) {
         throw std::invalid_argument("Workflow::addFile(): WorkflowFile with id '" +
                                     id + "' already exists");
       }
 
-      WorkflowFile *file = new WorkflowFile(id, size);
+      // Create the WorkflowFile object
+      WorkflowFile *file = new WorkflowFile(interned_id.first, size);
       file->workflow = this;
       // Add if to the set of workflow files
-      files[file->id] = std::unique_ptr<WorkflowFile>(file);
+      this->files.push_back(std::unique_ptr<WorkflowFile>(file));
+
+      // Keep the files sorted by ID (in constant time when files are added by increasing ID)
+      if (this->files_by_id_up_to_date) {
+        if (this->files_by_id.empty() or
+            (this->file_ids.getString(this->files_by_id.back()->index) < id)) {
+          this->files_by_id.push_back(file);
+        } else {
+          this->files_by_id_up_to_date = false;
+          this->files_by_id.clear();
+        }
+      }
 
       return file;
     }
@@ -189,11 +362,11 @@ namespace wrench {
      * @throw std::invalid_argument
      */
     WorkflowFile *Workflow::getFileByID(const std::string id) {
-      if (files.find(id) == files.end()) {
+      unsigned long index = this->file_ids.find(id);
+      if (index == IDTable::NOT_FOUND) {
         throw std::invalid_argument("Workflow::getFileByID(): Unknown WorkflowFile ID " + id);
-      } else {
-        return files[id].get();
       }
+      return this->files[index].get();
     }
 
     /**
@@ -218,11 +391,12 @@ namespace wrench {
      * @return the number of tasks
      */
     unsigned long Workflow::getNumberOfTasks() {
-      return this->tasks.size();
+      return this->num_tasks;
     }
 
     /**
-     * @brief Determine whether one source is an ancestor of a destination task
+     * @brief Determine whether one source is an ancestor of a destination task. Only
+     *        the tasks between src and dst in the topological order are explored.
      *
      * @param src: the source workflow task
      * @param dst: the destination task
@@ -230,10 +404,105 @@ namespace wrench {
      * @return true if there is a path from src to dst, false otherwise
      */
     bool Workflow::pathExists(WorkflowTask *src, WorkflowTask *dst) {
-      lemon::Bfs<lemon::ListDigraph> bfs(*DAG);
+      if (src == dst) {
+        return true;
+      }
+      if (src->topological_index > dst->topological_index) {
+        return false;
+      }
+
+      std::unordered_set<WorkflowTask *> visited = {src};
+      std::vector<WorkflowTask *> to_visit = {src};
+
+      while (not to_visit.empty()) {
+        WorkflowTask *task = to_visit.back();
+        to_visit.pop_back();
+        for (lemon::ListDigraph::OutArcIt a(*DAG, task->DAG_node); a != lemon::INVALID; ++a) {
+          WorkflowTask *child = (*DAG_node_map)[(*DAG).target(a)];
+          if (child == dst) {
+            return true;
+          }
+          if ((child->topological_index < dst->topological_index) and (visited.insert(child).second)) {
+            to_visit.push_back(child);
+          }
+        }
+      }
+      return false;
+    }
+
+    /**
+     * @brief Update the topological order of the tasks before an arc is added from
+     *        a task to a task that comes before it in that order (Pearce-Kelly algorithm:
+     *        only the tasks whose positions lie between those of the two tasks are reordered)
+     *
+     * @param src: the source workflow task
+     * @param dst: the destination task
+     *
+     * @throw std::invalid_argument if the arc would create a cycle
+     */
+    void Workflow::updateTopologicalOrder(WorkflowTask *src, WorkflowTask *dst) {
+
+      // Descendants of dst that come before src (remembering how they were reached)
+      std::unordered_map<WorkflowTask *, WorkflowTask *> forward_predecessors = {{dst, nullptr}};
+      std::vector<WorkflowTask *> forward = {dst};
+      for (unsigned long i = 0; i < forward.size(); i++) {
+        WorkflowTask *task = forward[i];
+        for (lemon::ListDigraph::OutArcIt a(*DAG, task->DAG_node); a != lemon::INVALID; ++a) {
+          WorkflowTask *child = (*DAG_node_map)[(*DAG).target(a)];
+          if (child == src) {
+            // Report the cycle
+            std::string cycle = src->getID();
+            for (WorkflowTask *t = task; t != nullptr; t = forward_predecessors[t]) {
+              cycle = t->getID() + "->" + cycle;
+            }
+            throw std::invalid_argument("Workflow::addControlDependency(): Adding dependency " +
+                                        src->getID() + "->" + dst->getID() + " would create a cycle (" +
+                                        src->getID() + "->" + cycle + ")");
+          }
+          if ((child->topological_index < src->topological_index) and
+              (forward_predecessors.insert(std::make_pair(child, task)).second)) {
+            forward.push_back(child);
+          }
+        }
+      }
 
-      bool reached = bfs.run(src->DAG_node, dst->DAG_node);
-      return reached;
+      // Ancestors of src that come after dst
+      std::unordered_set<WorkflowTask *> backward_visited = {src};
+      std::vector<WorkflowTask *> backward = {src};
+      for (unsigned long i = 0; i < backward.size(); i++) {
+        WorkflowTask *task = backward[i];
+        for (lemon::ListDigraph::InArcIt a(*DAG, task->DAG_node); a != lemon::INVALID; ++a) {
+          WorkflowTask *parent = (*DAG_node_map)[(*DAG).source(a)];
+          if ((parent->topological_index > dst->topological_index) and (backward_visited.insert(parent).second)) {
+            backward.push_back(parent);
+          }
+        }
+      }
+
+      // Reuse the positions of these tasks, putting the ancestors of src before the descendants of dst
+      auto by_topological_index = [](const WorkflowTask *t1, const WorkflowTask *t2) {
+          return t1->topological_index < t2->topological_index;
+      };
+      std::sort(forward.begin(), forward.end(), by_topological_index);
+      std::sort(backward.begin(), backward.end(), by_topological_index);
+
+      std::vector<unsigned long> indices;
+      indices.reserve(forward.size() + backward.size());
+      for (auto task : backward) {
+        indices.push_back(task->topological_index);
+      }
+      for (auto task : forward) {
+        indices.push_back(task->topological_index);
+      }
+      std::sort(indices.begin(), indices.end());
+
+      unsigned long i = 0;
+      for (auto task : backward) {
+        task->topological_index = indices[i++];
+      }
+      for (auto task : forward) {
+        task->topological_index = indices[i++];
+      }
     }
 
     /**
@@ -244,24 +513,30 @@ namespace wrench {
       this->DAG_node_map = std::unique_ptr<lemon::ListDigraph::NodeMap<WorkflowTask *>>(
               new lemon::ListDigraph::NodeMap<WorkflowTask *>(*DAG));
       this->num_levels = 0;
+      this->top_levels_up_to_date = true;
+      this->next_topological_index = 0;
+      this->num_tasks = 0;
+      this->tasks_by_id_up_to_date = true;
+      this->num_removed_tasks_by_id = 0;
+      this->files_by_id_up_to_date = true;
+      for (auto &count : this->num_tasks_in_state) {
+        count = 0;
+      }
       this->callback_mailbox = S4U_Mailbox::generateUniqueMailboxName("workflow_mailbox");
     };
 
     /**
      * @brief Get a vector of ready tasks
      *
-     * @return a vector of tasks
+     * @return a vector of tasks (sorted by task ID)
      */
     std::vector<WorkflowTask *> Workflow::getReadyTasks() {
 
       std::vector<WorkflowTask *> tasks_list;
+      tasks_list.reserve(this->ready_tasks.size());
 
-      for (auto &it : this->tasks) {
-        WorkflowTask *task = it.second.get();
-
-        if (task->getState() == WorkflowTask::State::READY) {
-          tasks_list.push_back(task);
-        }
+      for (auto const &it : this->ready_tasks) {
+        tasks_list.push_back(it.second);
       }
       return tasks_list;
     }
@@ -271,36 +546,40 @@ namespace wrench {
      *
      * @return map of workflow cluster tasks
      */
-    // TODO: Implement this more efficiently
     std::map<std::string, std::vector<WorkflowTask *>> Workflow::getReadyClusters() {
 
       std::map<std::string, std::vector<WorkflowTask *>> task_map;
+      std::set<std::string> ready_cluster_ids;
+
+      for (auto const &it : this->ready_tasks) {
+        WorkflowTask *task = it.second;
 
-      for (auto &it : this->tasks) {
-        WorkflowTask *task = it.second.get();
+        if (task->getClusterID().empty()) {
+          task_map[task->getID()] = {task};
+        } else {
+          ready_cluster_ids.insert(task->getClusterID());
+        }
+      }
 
-        if (task->getState() == WorkflowTask::State::READY) {
+      // A cluster comprises its ready tasks, and all the tasks that come after
+      // its first ready task in ID order (the not-ready ones being made ready)
+      for (auto const &cluster_id : ready_cluster_ids) {
+        std::vector<WorkflowTask *> cluster_tasks;
 
-          if (task->getClusterID().empty()) {
-            task_map[task->getID()] = {task};
+        for (auto const &it : this->clustered_tasks[cluster_id]) {
+          WorkflowTask *task = it.second;
 
-          } else {
-            if (task_map.find(task->getClusterID()) == task_map.end()) {
-              task_map[task->getClusterID()] = {task};
-            } else {
-              // add to clustered task
-              task_map[task->getClusterID()].push_back(task);
-            }
-          }
-        } else {
-          if (task_map.find(task->getClusterID()) != task_map.end()) {
+          if (task->getState() == WorkflowTask::State::READY) {
+            cluster_tasks.push_back(task);
+          } else if (not cluster_tasks.empty()) {
             if (task->getState() == WorkflowTask::State::NOT_READY) {
               task->setInternalState(WorkflowTask::InternalState::TASK_READY);
               task->setState(WorkflowTask::State::READY);
             }
-            task_map[task->getClusterID()].push_back(task);
+            cluster_tasks.push_back(task);
           }
         }
+        task_map[cluster_id] = cluster_tasks;
       }
       return task_map;
     }
@@ -311,13 +590,52 @@ namespace wrench {
      * @return true or false
      */
     bool Workflow::isDone() {
-      for (auto &it : this->tasks) {
-        WorkflowTask *task = it.second.get();
-        if (task->getState() != WorkflowTask::State::COMPLETED) {
-          return false;
+      return (this->num_tasks_in_state[WorkflowTask::State::COMPLETED] == this->num_tasks);
+    }
+
+    /**
+     * @brief Update the ready task set and the task state counters after
+     *        a task's visible state has changed (called by WorkflowTask::setState())
+     *
+     * @param task: the task whose state has changed
+     * @param previous_state: the task's previous visible state
+     */
+    void Workflow::updateTaskStateIndex(WorkflowTask *task, WorkflowTask::State previous_state) {
+      if (task->getState() == previous_state) {
+        return;
+      }
+
+      this->num_tasks_in_state[previous_state]--;
+      this->num_tasks_in_state[task->getState()]++;
+
+      if (previous_state == WorkflowTask::State::READY) {
+        this->ready_tasks.erase(this->task_ids.getString(task->index));
+      } else if (task->getState() == WorkflowTask::State::READY) {
+        this->ready_tasks[this->task_ids.getString(task->index)] = task;
+      }
+    }
+
+    /**
+     * @brief Update the cluster index after a task's cluster ID has changed
+     *        (called by WorkflowTask::setClusterID())
+     *
+     * @param task: the task whose cluster ID has changed
+     * @param previous_cluster_id: the task's previous cluster ID
+     */
+    void Workflow::updateTaskClusterIndex(WorkflowTask *task, const std::string &previous_cluster_id) {
+      if (task->getClusterID() == previous_cluster_id) {
+        return;
+      }
+
+      if (not previous_cluster_id.empty()) {
+        this->clustered_tasks[previous_cluster_id].erase(this->task_ids.getString(task->index));
+        if (this->clustered_tasks[previous_cluster_id].empty()) {
+          this->clustered_tasks.erase(previous_cluster_id);
         }
       }
-      return true;
+      if (not task->getClusterID().empty()) {
+        this->clustered_tasks[task->getClusterID()][this->task_ids.getString(task->index)] = task;
+      }
     }
 
     /**
@@ -326,11 +644,32 @@ namespace wrench {
      * @return a vector of tasks
      */
     std::vector<WorkflowTask *> Workflow::getTasks() {
-      std::vector<WorkflowTask *> all_tasks;
-      for (auto &it : this->tasks) {
-        all_tasks.push_back(it.second.get());
+      bool positions_changed = false;
+      if (not this->tasks_by_id_up_to_date) {
+        this->tasks_by_id.clear();
+        for (auto const &task : this->tasks) {
+          if (task) {
+            this->tasks_by_id.push_back(task.get());
+          }
+        }
+        std::sort(this->tasks_by_id.begin(), this->tasks_by_id.end(), [this](WorkflowTask *t1, WorkflowTask *t2) {
+            return this->task_ids.getString(t1->index) < this->task_ids.getString(t2->index);
+        });
+        this->tasks_by_id_up_to_date = true;
+        positions_changed = true;
+      } else if (this->num_removed_tasks_by_id > 0) {
+        // Drop the entries of removed tasks
+        this->tasks_by_id.erase(std::remove(this->tasks_by_id.begin(), this->tasks_by_id.end(), nullptr),
+                                this->tasks_by_id.end());
+        positions_changed = true;
+      }
+      if (positions_changed) {
+        this->num_removed_tasks_by_id = 0;
+        for (unsigned long i = 0; i < this->tasks_by_id.size(); i++) {
+          this->tasks_by_id[i]->by_id_position = i;
+        }
       }
-      return all_tasks;
+      return this->tasks_by_id;
     };
 
     /**
@@ -339,11 +678,17 @@ namespace wrench {
      * @return a vector of files
      */
     std::vector<WorkflowFile *> Workflow::getFiles() {
-      std::vector<WorkflowFile *> all_files;
-      for (auto &it : this->files) {
-        all_files.push_back(it.second.get());
+      if (not this->files_by_id_up_to_date) {
+        this->files_by_id.clear();
+        for (auto const &file : this->files) {
+          this->files_by_id.push_back(file.get());
+        }
+        std::sort(this->files_by_id.begin(), this->files_by_id.end(), [this](WorkflowFile *f1, WorkflowFile *f2) {
+            return this->file_ids.getString(f1->index) < this->file_ids.getString(f2->index);
+        });
+        this->files_by_id_up_to_date = true;
       }
-      return all_files;
+      return this->files_by_id;
     };
 
     /**
@@ -352,16 +697,15 @@ namespace wrench {
      * @param task: a workflow task
      *
      * @return a vector of tasks
+     *
+     * @throw std::invalid_argument
      */
     std::vector<WorkflowTask *> Workflow::getTaskChildren(const WorkflowTask *task) {
       if (task == nullptr) {
         throw std::invalid_argument("Workflow::getTaskChildren(): Invalid arguments");
       }
-      std::vector<WorkflowTask *> children;
-      for (lemon::ListDigraph::OutArcIt a(*DAG, task->DAG_node); a != lemon::INVALID; ++a) {
-        children.push_back((*DAG_node_map)[(*DAG).target(a)]);
-      }
-      return children;
+      WorkflowTaskSpan children = this->getTaskChildrenSpan(task);
+      return std::vector<WorkflowTask *>(children.begin(), children.end());
     }
 
     /**
@@ -370,16 +714,49 @@ namespace wrench {
      * @param task: a workflow task
      *
      * @return a vector of tasks
+     *
+     * @throw std::invalid_argument
      */
     std::vector<WorkflowTask *> Workflow::getTaskParents(const WorkflowTask *task) {
       if (task == nullptr) {
         throw std::invalid_argument("Workflow::getTaskParents(): Invalid arguments");
       }
-      std::vector<WorkflowTask *> parents;
-      for (lemon::ListDigraph::InArcIt a(*DAG, task->DAG_node); a != lemon::INVALID; ++a) {
-        parents.push_back((*DAG_node_map)[(*DAG).source(a)]);
+      WorkflowTaskSpan parents = this->getTaskParentsSpan(task);
+      return std::vector<WorkflowTask *>(parents.begin(), parents.end());
+    }
+
+    /**
+     * @brief Get the children of a task, as a view of the workflow's adjacency arrays
+     *        that is valid until the structure of the workflow changes
+     *
+     * @param task: a workflow task
+     *
+     * @return a span of tasks
+     *
+     * @throw std::invalid_argument
+     */
+    WorkflowTaskSpan Workflow::getTaskChildrenSpan(const WorkflowTask *task) {
+      if (task == nullptr) {
+        throw std::invalid_argument("Workflow::getTaskChildrenSpan(): Invalid arguments");
+      }
+      return this->children.getSpan(task->index);
+    }
+
+    /**
+     * @brief Get the parents of a task, as a view of the workflow's adjacency arrays
+     *        that is valid until the structure of the workflow changes
+     *
+     * @param task: a workflow task
+     *
+     * @return a span of tasks
+     *
+     * @throw std::invalid_argument
+     */
+    WorkflowTaskSpan Workflow::getTaskParentsSpan(const WorkflowTask *task) {
+      if (task == nullptr) {
+        throw std::invalid_argument("Workflow::getTaskParentsSpan(): Invalid arguments");
       }
-      return parents;
+      return this->parents.getSpan(task->index);
     }
 
     /**
@@ -479,9 +856,9 @@ namespace wrench {
      */
     std::map<std::string, WorkflowFile *> Workflow::getInputFiles() {
       std::map<std::string, WorkflowFile *> input_files;
-      for (auto const &x : this->files) {
-        if ((x.second->output_of == nullptr) && (x.second->input_of.size() > 0)) {
-          input_files.insert({x.first, x.second.get()});
+      for (auto const &file : this->files) {
+        if ((file->output_of == nullptr) && (file->input_of.size() > 0)) {
+          input_files.insert({this->file_ids.getString(file->index), file.get()});
         }
       }
       return input_files;
@@ -517,8 +894,6 @@ namespace wrench {
      */
     void Workflow::loadFromDAX(const std::string &filename, const std::string &reference_flop_rate) {
 
-      pugi::xml_document dax_tree;
-
       double flop_rate;
 
       try {
@@ -527,54 +902,103 @@ namespace wrench {
         throw;
       }
 
-      if (not dax_tree.load_file(filename.c_str())) {
+      std::ifstream dax_file(filename);
+      if (not dax_file.is_open()) {
         throw std::invalid_argument("Workflow::loadFromDAX(): Invalid DAX file");
       }
 
-      // Get the root node
-      pugi::xml_node dag = dax_tree.child("adag");
-
-      // Iterate through the "job" nodes
-      for (pugi::xml_node job = dag.child("job"); job; job = job.next_sibling("job")) {
-        WorkflowTask *task;
-        // Get the job attributes
-        std::string id = job.attribute("id").value();
-        std::string name = job.attribute("name").value();
-        double runtime = std::strtod(job.attribute("runtime").value(), NULL);
-        int num_procs = 1;
-        bool found_one = false;
-        for (std::string tag : {"numprocs", "num_procs", "numcores", "num_cores"}) {
-          if (job.attribute(tag.c_str())) {
-            if (found_one) {
-              throw std::invalid_argument(
-                      "Workflow::loadFromDAX(): multiple \"number of cores/procs\" specification for task " + id);
-            } else {
-              found_one = true;
-              num_procs = std::stoi(job.attribute("num_procs").value());
-            }
+      // The DAX file is read one element at a time, and tasks, files, and dependencies are created
+      // on the fly, so that the memory footprint of loading is that of the resulting workflow
+      XMLStreamReader dax(dax_file);
+
+      // The task/file IDs referenced in the DAX file are resolved with the interned ID tables
+      auto lookup_task = [this](const std::string &id) -> WorkflowTask * {
+          unsigned long index = this->task_ids.find(id);
+          return (index != IDTable::NOT_FOUND) ? this->tasks[index].get() : nullptr;
+      };
+
+      // Dependencies that refer to jobs that come later in the file (DAX generators list all jobs first):
+      // they are added once all jobs have been created, as child IDs and their parent IDs
+      std::vector<std::pair<std::string, std::vector<std::string>>> deferred_dependencies;
+
+      bool in_adag = false;
+      std::string current_element;         // the current child element of <adag>
+      WorkflowTask *task = nullptr;        // the task of the current <job> element
+      WorkflowTask *child_task = nullptr;  // the task of the current <child> element
+      std::string child_id;
+
+      while (true) {
+        XMLStreamReader::Event event;
+        try {
+          event = dax.next();
+        } catch (std::invalid_argument &e) {
+          throw std::invalid_argument("Workflow::loadFromDAX(): Invalid DAX file (" + std::string(e.what()) + ")");
+        }
+
+        if (event == XMLStreamReader::Event::END_OF_DOCUMENT) {
+          break;
+        }
+        if (event == XMLStreamReader::Event::END_ELEMENT) {
+          if (dax.getDepth() == 1) {
+            current_element.clear();
           }
+          continue;
         }
 
+        const std::string &element = dax.getName();
+
+        if (dax.getDepth() == 0) {
+          // The root node
+          in_adag = (element == "adag");
+
+        } else if ((not in_adag) or (dax.getDepth() > 2)) {
+          continue;
+
+        } else if (dax.getDepth() == 1) {
+          current_element = element;
+
+          if (element == "job") {
+            // Get the job attributes
+            const std::string &id = dax.getAttribute("id");
+            double runtime = std::strtod(dax.getAttribute("runtime").c_str(), NULL);
+            int num_procs = 1;
+            bool found_one = false;
+            for (std::string tag : {"numprocs", "num_procs", "numcores", "num_cores"}) {
+              if (dax.hasAttribute(tag)) {
+                if (found_one) {
+                  throw std::invalid_argument(
+                          "Workflow::loadFromDAX(): multiple \"number of cores/procs\" specification for task " + id);
+                } else {
+                  found_one = true;
+                  num_procs = std::stoi(dax.getAttribute(tag));
+                }
+              }
+            }
 
-        // Create the task
-        // If the DAX says num_procs = x, then we set min_cores=1, max_cores=x, efficiency=1.0
-        task = this->addTask(id, runtime * flop_rate, 1, num_procs, 1.0, 0.0);
+            // Create the task
+            // If the DAX says num_procs = x, then we set min_cores=1, max_cores=x, efficiency=1.0
+            task = this->addTask(id, runtime * flop_rate, 1, num_procs, 1.0, 0.0);
 
-        // Go through the children "uses" nodes
-        for (pugi::xml_node uses = job.child("uses"); uses; uses = uses.next_sibling("uses")) {
-          // getMessage the "uses" attributes
+          } else if (element == "child") {
+            child_id = dax.getAttribute("ref");
+            child_task = lookup_task(child_id);
+            if (child_task == nullptr) {
+              deferred_dependencies.push_back(std::make_pair(child_id, std::vector<std::string>()));
+            }
+          }
+
+        } else if ((current_element == "job") and (element == "uses")) {
           // TODO: There are several attributes that we're ignoring for now...
-          std::string id = uses.attribute("file").value();
+          const std::string &id = dax.getAttribute("file");
+          const std::string &link = dax.getAttribute("link");
 
-          double size = std::strtod(uses.attribute("size").value(), NULL);
-          std::string link = uses.attribute("link").value();
           // Check whether the file already exists
-          WorkflowFile *file = nullptr;
-
-          try {
-            file = this->getFileByID(id);
-          } catch (std::invalid_argument &e) {
-            file = this->addFile(id, size);
+          WorkflowFile *file;
+          unsigned long file_index = this->file_ids.find(id);
+          if (file_index != IDTable::NOT_FOUND) {
+            file = this->files[file_index].get();
+          } else {
+            file = this->addFile(id, std::strtod(dax.getAttribute("size").c_str(), NULL));
           }
           if (link == "input") {
             task->addInputFile(file);
@@ -583,22 +1007,30 @@ namespace wrench {
             task->addOutputFile(file);
           }
           // TODO: Are there other types of "link" values?
-        }
-      }
 
-      // Iterate through the "child" nodes to handle control dependencies
-      for (pugi::xml_node child = dag.child("child"); child; child = child.next_sibling("child")) {
+        } else if ((current_element == "child") and (element == "parent")) {
+          const std::string &parent_id = dax.getAttribute("ref");
+          WorkflowTask *parent_task = lookup_task(parent_id);
 
-        WorkflowTask *child_task = this->getTaskByID(child.attribute("ref").value());
-
-        // Go through the children "parent" nodes
-        for (pugi::xml_node parent = child.child("parent"); parent; parent = parent.next_sibling("parent")) {
-          std::string parent_id = parent.attribute("ref").value();
+          if (child_task == nullptr) {
+            deferred_dependencies.back().second.push_back(parent_id);
+          } else if (parent_task == nullptr) {
+            deferred_dependencies.push_back(std::make_pair(child_id, std::vector<std::string>(1, parent_id)));
+          } else {
+            this->addControlDependency(parent_task, child_task);
+          }
+        }
+      }
 
-          WorkflowTask *parent_task = this->getTaskByID(parent_id);
-          this->addControlDependency(parent_task, child_task);
+      for (auto const &deferred : deferred_dependencies) {
+        WorkflowTask *deferred_child_task = this->getTaskByID(deferred.first);
+        for (auto const &parent_id : deferred.second) {
+          this->addControlDependency(this->getTaskByID(parent_id), deferred_child_task);
         }
       }
+
+      // Compute all top-levels in one pass, now that the DAG is complete
+      this->updateTopLevels();
     }
 
     /**
@@ -712,6 +1144,354 @@ namespace wrench {
         }
       }
       file.close();
+
+      // Compute all top-levels in one pass, now that the DAG is complete
+      this->updateTopLevels();
+    }
+
+    /**
+     * @brief Save the workflow (tasks, files, dependencies, priorities, cluster IDs, and
+     *        file transfer sources/destinations) to a binary snapshot file, which can later be
+     *        loaded with Workflow::loadBinary() much faster than a DAX or JSON file.
+     *        The format is versioned and only portable between machines with the same byte order.
+     *        Task states and execution information are not saved.
+     *
+     * @param filename: the path to the binary file
+     *
+     * @throw std::invalid_argument
+     */
+    void Workflow::saveBinary(const std::string &filename) {
+
+      std::string string_table;
+      auto add_string = [&string_table](const std::string &str) {
+          WorkflowBinaryString binary_string;
+          binary_string.offset = string_table.size();
+          binary_string.length = str.size();
+          string_table += str;
+          return binary_string;
+      };
+
+      // Files, in ID order
+      std::vector<WorkflowBinaryFile> binary_files;
+      std::unordered_map<WorkflowFile *, uint64_t> file_indices;
+      for (auto f : this->getFiles()) {
+        WorkflowBinaryFile binary_file;
+        binary_file.id = add_string(this->file_ids.getString(f->index));
+        binary_file.size = f->size;
+        file_indices[f] = binary_files.size();
+        binary_files.push_back(binary_file);
+      }
+
+      // Tasks, in ID order, with their rank in the topological order
+      std::vector<WorkflowTask *> sorted_tasks = this->getTasks();
+      std::unordered_map<WorkflowTask *, uint64_t> task_indices;
+      for (uint64_t i = 0; i < sorted_tasks.size(); i++) {
+        task_indices[sorted_tasks[i]] = i;
+      }
+      std::vector<WorkflowTask *> topological_order = sorted_tasks;
+      std::sort(topological_order.begin(), topological_order.end(), [](WorkflowTask *t1, WorkflowTask *t2) {
+          return t1->topological_index < t2->topological_index;
+      });
+      std::vector<uint64_t> topological_ranks(sorted_tasks.size());
+      for (uint64_t i = 0; i < topological_order.size(); i++) {
+        topological_ranks[task_indices[topological_order[i]]] = i;
+      }
+
+      std::vector<WorkflowBinaryTask> binary_tasks;
+      std::vector<uint64_t> file_uses;
+      std::vector<WorkflowBinaryEdge> edges;
+      std::vector<WorkflowBinaryTransfer> transfers;
+      for (auto task : sorted_tasks) {
+        WorkflowBinaryTask binary_task;
+        binary_task.id = add_string(this->task_ids.getString(task->index));
+        binary_task.cluster_id = add_string(task->cluster_id);
+        binary_task.flops = task->flops;
+        binary_task.min_num_cores = task->min_num_cores;
+        binary_task.max_num_cores = task->max_num_cores;
+        binary_task.parallel_efficiency = task->parallel_efficiency;
+        binary_task.memory_requirement = task->memory_requirement;
+        binary_task.priority = task->priority;
+        binary_task.task_type = task->task_type;
+        binary_task.topological_rank = topological_ranks[task_indices[task]];
+        binary_task.num_input_files = task->input_files.size();
+        binary_task.num_output_files = task->output_files.size();
+        binary_tasks.push_back(binary_task);
+
+        for (auto const &f : task->input_files) {
+          file_uses.push_back(file_indices.at(f));
+        }
+        for (auto const &f : task->output_files) {
+          file_uses.push_back(file_indices.at(f));
+        }
+
+        // Children are saved in reverse order, so that re-adding the arcs restores the original order
+        WorkflowTaskSpan children = this->getTaskChildrenSpan(task);
+        for (auto it = children.end(); it != children.begin();) {
+          WorkflowBinaryEdge edge;
+          edge.parent = task_indices[task];
+          edge.child = task_indices[*(--it)];
+          edges.push_back(edge);
+        }
+
+        for (auto const &transfer : task->fileTransfers) {
+          auto file_index = file_indices.find(transfer.first);
+          if (file_index == file_indices.end()) {
+            throw std::invalid_argument("Workflow::saveBinary(): Task " + task->getID() +
+                                        " transfers a file that is not in the workflow");
+          }
+          WorkflowBinaryTransfer binary_transfer;
+          binary_transfer.task = task_indices[task];
+          binary_transfer.file = file_index->second;
+          binary_transfer.src = add_string(transfer.second.first);
+          binary_transfer.dest = add_string(transfer.second.second);
+          transfers.push_back(binary_transfer);
+        }
+      }
+
+      WorkflowBinaryHeader header;
+      memcpy(header.magic, WORKFLOW_BINARY_MAGIC, sizeof(header.magic));
+      header.version = WORKFLOW_BINARY_VERSION;
+      header.byte_order = WORKFLOW_BINARY_BYTE_ORDER;
+      header.num_files = binary_files.size();
+      header.num_tasks = binary_tasks.size();
+      header.num_file_uses = file_uses.size();
+      header.num_edges = edges.size();
+      header.num_transfers = transfers.size();
+      header.string_table_size = string_table.size();
+
+      std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+      file.write((const char *) &header, sizeof(header));
+      file.write((const char *) binary_files.data(), binary_files.size() * sizeof(WorkflowBinaryFile));
+      file.write((const char *) binary_tasks.data(), binary_tasks.size() * sizeof(WorkflowBinaryTask));
+      file.write((const char *) file_uses.data(), file_uses.size() * sizeof(uint64_t));
+      file.write((const char *) edges.data(), edges.size() * sizeof(WorkflowBinaryEdge));
+      file.write((const char *) transfers.data(), transfers.size() * sizeof(WorkflowBinaryTransfer));
+      file.write(string_table.data(), string_table.size());
+      file.close();
+      if (file.fail()) {
+        throw std::invalid_argument("Workflow::saveBinary(): Cannot write file " + filename);
+      }
+    }
+
+    /**
+     * @brief Add the content of a binary snapshot file created with Workflow::saveBinary() to the workflow.
+     *        The file is memory-mapped and objects are created directly from its fixed-size records,
+     *        without any text parsing (dependencies are validated against the saved topological order)
+     *
+     * @param filename: the path to the binary file
+     *
+     * @throw std::invalid_argument
+     */
+    void Workflow::loadBinary(const std::string &filename) {
+
+      int fd = open(filename.c_str(), O_RDONLY);
+      if (fd == -1) {
+        throw std::invalid_argument("Workflow::loadBinary(): Cannot open file " + filename);
+      }
+      struct stat file_stat;
+      if ((fstat(fd, &file_stat) == -1) or ((size_t) file_stat.st_size < sizeof(WorkflowBinaryHeader))) {
+        close(fd);
+        throw std::invalid_argument("Workflow::loadBinary(): Invalid binary workflow file " + filename);
+      }
+      auto size = (size_t) file_stat.st_size;
+      void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (data == MAP_FAILED) {
+        throw std::invalid_argument("Workflow::loadBinary(): Cannot map file " + filename);
+      }
+
+      try {
+        this->loadBinarySnapshot((const char *) data, size);
+      } catch (std::invalid_argument &e) {
+        munmap(data, size);
+        throw std::invalid_argument("Workflow::loadBinary(): Invalid binary workflow file " + filename +
+                                    " (" + e.what() + ")");
+      }
+      munmap(data, size);
+    }
+
+    /**
+     * @brief Add the content of a binary snapshot (in memory) to the workflow
+     *
+     * @param data: the snapshot
+     * @param size: the snapshot size
+     *
+     * @throw std::invalid_argument
+     */
+    void Workflow::loadBinarySnapshot(const char *data, size_t size) {
+
+      auto header = (const WorkflowBinaryHeader *) data;
+      if (memcmp(header->magic, WORKFLOW_BINARY_MAGIC, sizeof(header->magic)) != 0) {
+        throw std::invalid_argument("not a binary workflow file");
+      }
+      if (header->byte_order != WORKFLOW_BINARY_BYTE_ORDER) {
+        throw std::invalid_argument("incompatible byte order");
+      }
+      if (header->version != WORKFLOW_BINARY_VERSION) {
+        throw std::invalid_argument("unsupported version " + std::to_string(header->version));
+      }
+
+      // Check the section sizes (without overflowing)
+      size_t remaining = size - sizeof(WorkflowBinaryHeader);
+      for (auto const &section : {std::make_pair(header->num_files, sizeof(WorkflowBinaryFile)),
+                                  std::make_pair(header->num_tasks, sizeof(WorkflowBinaryTask)),
+                                  std::make_pair(header->num_file_uses, sizeof(uint64_t)),
+                                  std::make_pair(header->num_edges, sizeof(WorkflowBinaryEdge)),
+                                  std::make_pair(header->num_transfers, sizeof(WorkflowBinaryTransfer)),
+                                  std::make_pair(header->string_table_size, (size_t) 1)}) {
+        if (section.first > remaining / section.second) {
+          throw std::invalid_argument("truncated file");
+        }
+        remaining -= section.first * section.second;
+      }
+      if (remaining != 0) {
+        throw std::invalid_argument("unexpected trailing data");
+      }
+
+      auto binary_files = (const WorkflowBinaryFile *) (header + 1);
+      auto binary_tasks = (const WorkflowBinaryTask *) (binary_files + header->num_files);
+      auto file_uses = (const uint64_t *) (binary_tasks + header->num_tasks);
+      auto edges = (const WorkflowBinaryEdge *) (file_uses + header->num_file_uses);
+      auto transfers = (const WorkflowBinaryTransfer *) (edges + header->num_edges);
+      auto string_table = (const char *) (transfers + header->num_transfers);
+
+      auto get_string = [header, string_table](const WorkflowBinaryString &binary_string) {
+          if ((binary_string.offset > header->string_table_size) or
+              (binary_string.length > header->string_table_size - binary_string.offset)) {
+            throw std::invalid_argument("invalid string");
+          }
+          return std::string(string_table + binary_string.offset, binary_string.length);
+      };
+
+      /** First pass: validate everything, so that a corrupt snapshot does not leave the workflow half-loaded **/
+
+      std::unordered_set<std::string> file_ids_in_snapshot;
+      for (uint64_t i = 0; i < header->num_files; i++) {
+        std::string id = get_string(binary_files[i].id);
+        if ((binary_files[i].size < 0) or (this->file_ids.find(id) != IDTable::NOT_FOUND) or
+            (not file_ids_in_snapshot.insert(id).second)) {
+          throw std::invalid_argument("invalid file");
+        }
+      }
+
+      std::unordered_set<std::string> task_ids_in_snapshot;
+      std::vector<bool> used_topological_ranks(header->num_tasks, false);
+      uint64_t num_file_uses = 0;
+      for (uint64_t i = 0; i < header->num_tasks; i++) {
+        const WorkflowBinaryTask &binary_task = binary_tasks[i];
+        std::string id = get_string(binary_task.id);
+        get_string(binary_task.cluster_id);
+        if ((binary_task.flops < 0.0) or (binary_task.min_num_cores < 1) or
+            (binary_task.min_num_cores > binary_task.max_num_cores) or
+            (binary_task.parallel_efficiency < 0.0) or (binary_task.parallel_efficiency > 1.0) or
+            (binary_task.memory_requirement < 0) or
+            (this->task_ids.find(id) != IDTable::NOT_FOUND) or (not task_ids_in_snapshot.insert(id).second)) {
+          throw std::invalid_argument("invalid task");
+        }
+        if (binary_task.task_type > WorkflowTask::TaskType::TRANSFER) {
+          throw std::invalid_argument("invalid task type");
+        }
+        if ((binary_task.topological_rank >= header->num_tasks) or
+            used_topological_ranks[binary_task.topological_rank]) {
+          throw std::invalid_argument("invalid topological rank");
+        }
+        used_topological_ranks[binary_task.topological_rank] = true;
+
+        // A file can be used at most once by a task (as an input or as an output)
+        if ((binary_task.num_input_files > header->num_file_uses - num_file_uses) or
+            (binary_task.num_output_files > header->num_file_uses - num_file_uses - binary_task.num_input_files)) {
+          throw std::invalid_argument("invalid task files");
+        }
+        std::vector<uint64_t> task_file_uses(file_uses + num_file_uses,
+                                             file_uses + num_file_uses + binary_task.num_input_files +
+                                             binary_task.num_output_files);
+        num_file_uses += task_file_uses.size();
+        std::sort(task_file_uses.begin(), task_file_uses.end());
+        if ((not task_file_uses.empty()) and (task_file_uses.back() >= header->num_files)) {
+          throw std::invalid_argument("invalid file index");
+        }
+        if (std::adjacent_find(task_file_uses.begin(), task_file_uses.end()) != task_file_uses.end()) {
+          throw std::invalid_argument("invalid task files");
+        }
+      }
+      if (num_file_uses != header->num_file_uses) {
+        throw std::invalid_argument("invalid task files");
+      }
+
+      for (uint64_t i = 0; i < header->num_edges; i++) {
+        if ((edges[i].parent >= header->num_tasks) or (edges[i].child >= header->num_tasks) or
+            (binary_tasks[edges[i].parent].topological_rank >= binary_tasks[edges[i].child].topological_rank)) {
+          throw std::invalid_argument("invalid dependency");
+        }
+      }
+
+      for (uint64_t i = 0; i < header->num_transfers; i++) {
+        if ((transfers[i].task >= header->num_tasks) or (transfers[i].file >= header->num_files)) {
+          throw std::invalid_argument("invalid file transfer");
+        }
+        get_string(transfers[i].src);
+        get_string(transfers[i].dest);
+      }
+
+      /** Second pass: create the files, tasks, dependencies, and transfers **/
+
+      std::vector<WorkflowFile *> loaded_files(header->num_files);
+      for (uint64_t i = 0; i < header->num_files; i++) {
+        loaded_files[i] = this->addFile(get_string(binary_files[i].id), binary_files[i].size);
+      }
+
+      // Tasks are appended to the workflow's topological order, in their saved topological order
+      std::vector<WorkflowTask *> loaded_tasks(header->num_tasks);
+      unsigned long first_topological_index = this->next_topological_index;
+      num_file_uses = 0;
+      for (uint64_t i = 0; i < header->num_tasks; i++) {
+        const WorkflowBinaryTask &binary_task = binary_tasks[i];
+        WorkflowTask *task = this->addTask(get_string(binary_task.id), binary_task.flops,
+                                           binary_task.min_num_cores, binary_task.max_num_cores,
+                                           binary_task.parallel_efficiency, binary_task.memory_requirement,
+                                           (WorkflowTask::TaskType) binary_task.task_type);
+        task->topological_index = first_topological_index + binary_task.topological_rank;
+        task->setPriority(binary_task.priority);
+        if (binary_task.cluster_id.length > 0) {
+          task->setClusterID(get_string(binary_task.cluster_id));
+        }
+
+        // Files are attached directly, since the dependencies they imply are part of the saved edges
+        for (uint64_t j = 0; j < binary_task.num_input_files + binary_task.num_output_files; j++) {
+          WorkflowFile *file = loaded_files[file_uses[num_file_uses++]];
+          if (j < binary_task.num_input_files) {
+            task->addFileToList(task->input_files, task->output_files, file);
+            file->setInputOf(task);
+          } else {
+            task->addFileToList(task->output_files, task->input_files, file);
+            file->setOutputOf(task);
+          }
+        }
+        loaded_tasks[i] = task;
+      }
+
+      for (uint64_t i = 0; i < header->num_edges; i++) {
+        WorkflowTask *parent = loaded_tasks[edges[i].parent];
+        WorkflowTask *child = loaded_tasks[edges[i].child];
+        DAG->addArc(parent->DAG_node, child->DAG_node);
+        this->children.add(parent->index, child);
+        this->parents.add(child->index, parent);
+        parent->num_children++;
+        child->num_parents++;
+        child->num_incomplete_parents++;  // Loaded tasks are not completed
+        if (child->getState() != WorkflowTask::State::NOT_READY) {
+          child->setInternalState(WorkflowTask::InternalState::TASK_NOT_READY);
+          child->setState(WorkflowTask::State::NOT_READY);
+        }
+      }
+
+      for (uint64_t i = 0; i < header->num_transfers; i++) {
+        loaded_tasks[transfers[i].task]->addSrcDest(loaded_files[transfers[i].file],
+                                                    get_string(transfers[i].src), get_string(transfers[i].dest));
+      }
+
+      // Compute all top-levels in one pass, now that the DAG is complete
+      this->updateTopLevels();
     }
 
     /**
@@ -735,9 +1515,164 @@ namespace wrench {
      * @return the number of levels
      */
     unsigned long Workflow::getNumLevels() {
+      if (not this->top_levels_up_to_date) {
+        this->updateTopLevels();
+      }
       return this->num_levels;
     }
 
+    /**
+     * @brief Add an (initially empty) entry for a new task index
+     */
+    void Workflow::TaskAdjacency::addIndex() {
+      this->starts.push_back(this->tasks.size());
+      this->firsts.push_back(this->tasks.size());
+      this->ends.push_back(this->tasks.size());
+    }
+
+    /**
+     * @brief Add a neighbor to a task, before its other neighbors (as new arcs come first in the DAG)
+     *
+     * @param index: the task's interned ID
+     * @param neighbor: the neighbor
+     */
+    void Workflow::TaskAdjacency::add(unsigned long index, WorkflowTask *neighbor) {
+      if (this->firsts[index] == this->starts[index]) {
+        this->move(index, std::max<unsigned long>(1, 2 * (this->ends[index] - this->starts[index])));
+      }
+      this->tasks[--this->firsts[index]] = neighbor;
+    }
+
+    /**
+     * @brief Remove a neighbor of a task, keeping the order of the other neighbors
+     *
+     * @param index: the task's interned ID
+     * @param neighbor: the neighbor
+     *
+     * @throw std::invalid_argument
+     */
+    void Workflow::TaskAdjacency::remove(unsigned long index, WorkflowTask *neighbor) {
+      auto first = this->tasks.begin() + this->firsts[index];
+      auto end = this->tasks.begin() + this->ends[index];
+      auto position = std::find(first, end, neighbor);
+      // Shifting the segment without the neighbor in it would overwrite the next segment
+      if (position == end) {
+        throw std::invalid_argument("Workflow::TaskAdjacency::remove(): Task '" + neighbor->getID() +
+                                    "' is not a neighbor of the task");
+      }
+      std::copy_backward(first, position, position + 1);
+      this->firsts[index]++;
+    }
+
+    /**
+     * @brief Remove all neighbors of a (removed) task, and release its segment
+     *
+     * @param index: the task's interned ID
+     */
+    void Workflow::TaskAdjacency::clear(unsigned long index) {
+      this->num_unused_slots += this->ends[index] - this->starts[index];
+      this->starts[index] = this->ends[index];
+      this->firsts[index] = this->ends[index];
+    }
+
+    /**
+     * @brief Get the neighbors of a task
+     *
+     * @param index: the task's interned ID
+     *
+     * @return a span of tasks
+     */
+    WorkflowTaskSpan Workflow::TaskAdjacency::getSpan(unsigned long index) const {
+      WorkflowTask *const *data = this->tasks.data();
+      return WorkflowTaskSpan(data + this->firsts[index], data + this->ends[index]);
+    }
+
+    /**
+     * @brief Move the segment of a task to the end of the array
+     *
+     * @param index: the task's interned ID
+     * @param capacity: the segment's new capacity
+     */
+    void Workflow::TaskAdjacency::move(unsigned long index, unsigned long capacity) {
+      // The slots left behind would outnumber the others
+      unsigned long num_left_slots = this->num_unused_slots + (this->ends[index] - this->starts[index]);
+      if (num_left_slots > this->tasks.size() - num_left_slots + this->ends.size()) {
+        this->compact();
+      }
+      this->num_unused_slots += this->ends[index] - this->starts[index];
+
+      unsigned long size = this->ends[index] - this->firsts[index];
+      unsigned long end = this->tasks.size() + capacity;
+      this->tasks.resize(end);
+      std::copy(this->tasks.begin() + this->firsts[index], this->tasks.begin() + this->ends[index],
+                this->tasks.begin() + (end - size));
+      this->starts[index] = end - capacity;
+      this->firsts[index] = end - size;
+      this->ends[index] = end;
+    }
+
+    /**
+     * @brief Rewrite the array without the slots that are not in any segment, nor the free slots of segments
+     */
+    void Workflow::TaskAdjacency::compact() {
+      std::vector<WorkflowTask *> compacted;
+      compacted.reserve(this->tasks.size() - this->num_unused_slots);
+      for (unsigned long i = 0; i < this->ends.size(); i++) {
+        unsigned long start = compacted.size();
+        compacted.insert(compacted.end(), this->tasks.begin() + this->firsts[i], this->tasks.begin() + this->ends[i]);
+        this->starts[i] = start;
+        this->firsts[i] = start;
+        this->ends[i] = compacted.size();
+      }
+      this->tasks.swap(compacted);
+      this->num_unused_slots = 0;
+    }
+
+    /**
+     * @brief Recompute the top-levels of all tasks, and the number of levels in
+     *        the workflow, in a single pass over the DAG in topological order
+     *
+     * @throw std::runtime_error
+     */
+    void Workflow::updateTopLevels() {
+      std::vector<unsigned long> num_unvisited_parents(this->tasks.size(), 0);  // Indexed by interned task ID
+      std::vector<WorkflowTask *> topological_order;
+      topological_order.reserve(this->num_tasks);
+
+      // Entry tasks come first
+      for (auto const &it : this->tasks) {
+        WorkflowTask *task = it.get();
+        if (task == nullptr) {
+          continue;
+        }
+        task->toplevel = 0;
+        num_unvisited_parents[task->index] = task->num_parents;
+        if (task->num_parents == 0) {
+          topological_order.push_back(task);
+        }
+      }
+
+      // A child is visited once all its parents have been visited
+      unsigned long num_levels = 0;
+      for (unsigned long i = 0; i < topological_order.size(); i++) {
+        WorkflowTask *task = topological_order[i];
+        num_levels = std::max<unsigned long>(num_levels, 1 + task->toplevel);
+        for (auto child : this->getTaskChildrenSpan(task)) {
+          child->toplevel = std::max<unsigned long>(child->toplevel, 1 + task->toplevel);
+          if (--num_unvisited_parents[child->index] == 0) {
+            topological_order.push_back(child);
+          }
+        }
+      }
+
+      if (topological_order.size() != this->num_tasks) {
+        throw std::runtime_error("Workflow::updateTopLevels(): The workflow has a cycle");
+      }
+
+      this->setNumLevels(num_levels);
+      this->top_levels_up_to_date = true;
+    }
+
 
     /**
      * @brief Sets the number of levels in the workflow
@@ -7,9 +7,11 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <map>
 #include <xbt.h>
 
+#include "wrench/workflow/Workflow.h"
 #include "wrench/workflow/WorkflowFile.h"
 #include "wrench/workflow/WorkflowTask.h"
 
@@ -20,12 +22,11 @@ namespace wrench {
     /**
      * @brief Constructor
      *
-     * @param string: the file id
+     * @param index: the file's interned id
      * @param s: the file size
      */
-    WorkflowFile::WorkflowFile(const std::string name, double s) :
-            id(name), size(s), output_of(nullptr) {
-      this->input_of = {};
+    WorkflowFile::WorkflowFile(unsigned long index, double s) :
+            index(index), size(s), workflow(nullptr), output_of(nullptr) {
     };
 
     /**
@@ -41,7 +42,7 @@ namespace wrench {
      * @return the id
      */
     std::string WorkflowFile::getID() {
-      return this->id;
+      return this->workflow->file_ids.getString(this->index);
     }
 
     /**
@@ -68,15 +69,21 @@ namespace wrench {
      * @param task: a task
      */
     void WorkflowFile::setInputOf(WorkflowTask *task) {
-      this->input_of[task->getID()] = task;
+      auto position = std::lower_bound(this->input_of.begin(), this->input_of.end(), task,
+                                       [](const WorkflowTask *t1, const WorkflowTask *t2) {
+                                           return t1->index < t2->index;
+                                       });
+      if ((position == this->input_of.end()) or (*position != task)) {
+        this->input_of.insert(position, task);
+      }
     }
 
     /**
      * @brief Get the list of tasks that use this file as input
      *
-     * @return a map of tasks index by task ids
+     * @return a vector of tasks (sorted by interned task id)
      */
-    std::map<std::string, WorkflowTask *> WorkflowFile::getInputOf() {
+    const std::vector<WorkflowTask *> &WorkflowFile::getInputOf() {
       return this->input_of;
     }
 
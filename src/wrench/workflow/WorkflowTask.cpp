@@ -7,6 +7,7 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <lemon/list_graph.h>
 #include <xbt.h>
 
@@ -21,7 +22,7 @@ namespace wrench {
     /**
      * @brief Constructor
      *
-     * @param id: the task id
+     * @param index: the task's interned id
      * @param flops: the task's number of flops
      * @param min_cores: the minimum number of cores required for running the task
      * @param max_cores: the maximum number of cores that the task can use (infinity: ULONG_MAX)
@@ -29,10 +30,10 @@ namespace wrench {
      * @param memory_requirement: memory requirement in bytes
      * @param type: the type of the task (WorkflowTask::TaskType)
      */
-    WorkflowTask::WorkflowTask(const std::string id, const double flops, const unsigned long min_num_cores,
+    WorkflowTask::WorkflowTask(const unsigned long index, const double flops, const unsigned long min_num_cores,
                                const unsigned long max_num_cores, const double parallel_efficiency,
                                const double memory_requirement, const TaskType type) :
-            id(id), task_type(type), flops(flops),
+            index(index), task_type(type), flops(flops),
             min_num_cores(min_num_cores),
             max_num_cores(max_num_cores),
             parallel_efficiency(parallel_efficiency),
@@ -40,6 +41,7 @@ namespace wrench {
             execution_host(""),
             visible_state(WorkflowTask::State::READY),
             internal_state(WorkflowTask::InternalState::TASK_READY),
+            workflow(nullptr),
             job(nullptr) {
     }
 
@@ -49,7 +51,7 @@ namespace wrench {
      * @param file: the file
      */
     void WorkflowTask::addInputFile(WorkflowFile *file) {
-      addFileToMap(input_files, output_files, file);
+      addFileToList(input_files, output_files, file);
 
       file->setInputOf(this);
 
@@ -70,11 +72,20 @@ namespace wrench {
       WRENCH_DEBUG("Adding file '%s' as output t task %s",
                    file->getID().c_str(), this->getID().c_str());
 
-      addFileToMap(output_files, input_files, file);
+      addFileToList(output_files, input_files, file);
       file->setOutputOf(this);
 
-      for (auto const &x : file->getInputOf()) {
-        workflow->addControlDependency(this, x.second);
+      // Tasks that use the file are made children of this task in task ID order (IDs are
+      // compared in the workflow's ID table, rather than copied)
+      std::vector<WorkflowTask *> consumers = file->getInputOf();
+      if (consumers.size() > 1) {
+        const IDTable &task_ids = this->workflow->task_ids;
+        std::sort(consumers.begin(), consumers.end(), [&task_ids](const WorkflowTask *t1, const WorkflowTask *t2) {
+            return task_ids.getString(t1->index) < task_ids.getString(t2->index);
+        });
+      }
+      for (auto consumer : consumers) {
+        workflow->addControlDependency(this, consumer);
       }
 
     }
@@ -85,7 +96,7 @@ namespace wrench {
      * @return an id as a string
      */
     std::string WorkflowTask::getID() const {
-      return this->id;
+      return this->workflow->task_ids.getString(this->index);
     }
 
     /**
@@ -140,11 +151,7 @@ namespace wrench {
      * @return a number of children
      */
     int WorkflowTask::getNumberOfChildren() const {
-      int count = 0;
-      for (lemon::ListDigraph::OutArcIt a(*DAG, DAG_node); a != lemon::INVALID; ++a) {
-        ++count;
-      }
-      return count;
+      return (int) this->num_children;
     }
 
     /**
@@ -153,11 +160,7 @@ namespace wrench {
      * @return a number of parents
      */
     int WorkflowTask::getNumberOfParents() const {
-      int count = 0;
-      for (lemon::ListDigraph::InArcIt a(*DAG, DAG_node); a != lemon::INVALID; ++a) {
-        ++count;
-      }
-      return count;
+      return (int) this->num_parents;
     }
 
     /**
@@ -179,6 +182,16 @@ namespace wrench {
       return this->internal_state;
     }
 
+    /**
+     * @brief Get the number of parents of the task that are not (as known to
+     *        the "internal" layer) completed
+     *
+     * @return a number of parents
+     */
+    unsigned long WorkflowTask::getNumberOfIncompleteParents() const {
+      return this->num_incomplete_parents;
+    }
+
     /**
      * @brief Convert task state to a string (useful for output, debugging, logging, etc.)
      * @param state: task state
@@ -238,7 +251,20 @@ namespace wrench {
      * @param state: the task's internal state
      */
     void WorkflowTask::setInternalState(WorkflowTask::InternalState state) {
+      bool was_completed = (this->internal_state == WorkflowTask::InternalState::TASK_COMPLETED);
+      bool is_completed = (state == WorkflowTask::InternalState::TASK_COMPLETED);
       this->internal_state = state;
+
+      // Update the children's numbers of incomplete parents
+      if (was_completed != is_completed) {
+        for (auto child : this->workflow->getTaskChildrenSpan(this)) {
+          if (is_completed) {
+            child->num_incomplete_parents--;
+          } else {
+            child->num_incomplete_parents++;
+          }
+        }
+      }
     }
 
     /**
@@ -284,7 +310,11 @@ namespace wrench {
                                  stateToString(state) + " when its internal " +
                                  "state is " + stateToString(this->internal_state));
       }
+      WorkflowTask::State previous_state = this->visible_state;
       this->visible_state = state;
+      if (this->workflow != nullptr) {
+        this->workflow->updateTaskStateIndex(this, previous_state);
+      }
     }
 
     /**
@@ -318,7 +348,11 @@ namespace wrench {
      * @param id: cluster id the task belongs to
      */
     void WorkflowTask::setClusterID(std::string id) {
+      std::string previous_cluster_id = this->cluster_id;
       this->cluster_id = id;
+      if (this->workflow != nullptr) {
+        this->workflow->updateTaskClusterIndex(this, previous_cluster_id);
+      }
     }
 
     /**
@@ -372,27 +406,32 @@ namespace wrench {
     }
 
     /**
-     * @brief Helper method to add a file to a map if necessary
+     * @brief Helper method to add a file to a (sorted) list of files if necessary
      *
-     * @param map_to_insert: the map of workflow files to insert
-     * @param map_to_check: the map of workflow files to check
+     * @param list_to_insert: the list of workflow files to insert
+     * @param list_to_check: the list of workflow files to check
      * @param f: a workflow file
      *
      * @throw std::invalid_argument
      */
-    void WorkflowTask::addFileToMap(std::map<std::string, WorkflowFile *> &map_to_insert,
-                                    std::map<std::string, WorkflowFile *> &map_to_check,
-                                    WorkflowFile *f) {
+    void WorkflowTask::addFileToList(std::vector<WorkflowFile *> &list_to_insert,
+                                     std::vector<WorkflowFile *> &list_to_check,
+                                     WorkflowFile *f) {
+
+      auto by_index = [](const WorkflowFile *f1, const WorkflowFile *f2) {
+          return f1->index < f2->index;
+      };
 
-      if (map_to_check.find(f->id) != map_to_check.end()) {
+      if (std::binary_search(list_to_check.begin(), list_to_check.end(), f, by_index)) {
         throw std::invalid_argument(
-                "WorkflowTask::addFileToMap(): File ID '" + f->id + "' is already used as input or output file");
+                "WorkflowTask::addFileToList(): File ID '" + f->getID() + "' is already used as input or output file");
       }
 
-      if (map_to_insert.find(f->id) != map_to_insert.end()) {
-        throw std::invalid_argument("WorkflowTask::addFileToMap(): File ID '" + f->id + "' already exists");
+      auto position = std::lower_bound(list_to_insert.begin(), list_to_insert.end(), f, by_index);
+      if ((position != list_to_insert.end()) and (*position == f)) {
+        throw std::invalid_argument("WorkflowTask::addFileToList(): File ID '" + f->getID() + "' already exists");
       }
-      map_to_insert[f->id] = f;
+      list_to_insert.insert(position, f);
     }
 
     /**
@@ -418,7 +457,7 @@ namespace wrench {
       std::set<WorkflowFile *> input;
 
       for (auto f: this->input_files) {
-        input.insert(f.second);
+        input.insert(f);
       }
       return input;
     }
@@ -431,7 +470,7 @@ namespace wrench {
       std::set<WorkflowFile *> output;
 
       for (auto f: this->output_files) {
-        output.insert(f.second);
+        output.insert(f);
       }
       return output;
     }
@@ -452,35 +491,15 @@ namespace wrench {
       return this->end_date;
     }
 
-    /**
-     * @brief Update the task's top level (looking only at the parents)
-     */
-    void WorkflowTask::updateTopLevel() {
-      std::vector<WorkflowTask *> parents = this->workflow->getTaskParents(this);
-      if (parents.empty()) {
-        this->toplevel = 0;
-      } else {
-        unsigned long max_toplevel = 0;
-        for (auto parent : parents) {
-          max_toplevel = (max_toplevel < parent->toplevel ? parent->toplevel : max_toplevel);
-        }
-        this->toplevel = 1 + max_toplevel;
-      }
-      if (this->workflow->getNumLevels() < 1 + this->toplevel) {
-        this->workflow->setNumLevels(1 + this->toplevel);
-      }
-      std::vector<WorkflowTask *> children = this->workflow->getTaskChildren(this);
-      for (auto child : children) {
-        child->updateTopLevel();
-      }
-    }
-
     /**
      * @brief Returns the task's top level (max number of hops on a reverse path up to an entry task. Entry
      *        tasks have a top-leve of 0)
-     * @return
+     * @return the task's top level
      */
     unsigned long WorkflowTask::getTopLevel() {
+      if (not this->workflow->top_levels_up_to_date) {
+        this->workflow->updateTopLevels();
+      }
       return this->toplevel;
     }
 
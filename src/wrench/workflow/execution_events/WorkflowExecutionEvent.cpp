@@ -42,34 +42,47 @@ namespace wrench {
         throw WorkflowExecutionException(cause);
       }
 
-      if (auto m = dynamic_cast<ComputeServiceStandardJobDoneMessage *>(message.get())) {
-        return std::unique_ptr<StandardJobCompletedEvent>(
-          new StandardJobCompletedEvent(m->job, m->compute_service));
-
-      } else if (auto m = dynamic_cast<ComputeServiceStandardJobFailedMessage *>(message.get())) {
-        return std::unique_ptr<StandardJobFailedEvent>(
-                new StandardJobFailedEvent(m->job, m->compute_service, m->cause));
-
-      } else if (auto m = dynamic_cast<ComputeServicePilotJobStartedMessage *>(message.get())) {
-        return std::unique_ptr<PilotJobStartedEvent>(
-                new PilotJobStartedEvent(m->job, m->compute_service));
-
-      } else if (auto m = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
-      return std::unique_ptr<PilotJobExpiredEvent>(
-              new PilotJobExpiredEvent(m->job, m->compute_service));
-
-      } else if (auto m = dynamic_cast<StorageServiceFileCopyAnswerMessage *>(message.get())) {
-        if (m->success) {
-          return std::unique_ptr<FileCopyCompletedEvent>(
-                  new FileCopyCompletedEvent(m->file, m->storage_service, m->file_registry_service, m->file_registry_service_updated));
-
-        } else {
-          return std::unique_ptr<FileCopyFailedEvent>(
-                  new FileCopyFailedEvent(m->file, m->storage_service, m->failure_cause));
+      switch (message->type) {
+        case SimulationMessage::COMPUTE_SERVICE_STANDARD_JOB_DONE: {
+          auto m = static_cast<ComputeServiceStandardJobDoneMessage *>(message.get());
+          return std::unique_ptr<StandardJobCompletedEvent>(
+            new StandardJobCompletedEvent(m->job, m->compute_service));
+        }
+
+        case SimulationMessage::COMPUTE_SERVICE_STANDARD_JOB_FAILED: {
+          auto m = static_cast<ComputeServiceStandardJobFailedMessage *>(message.get());
+          return std::unique_ptr<StandardJobFailedEvent>(
+                  new StandardJobFailedEvent(m->job, m->compute_service, m->cause));
+        }
+
+        case SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_STARTED: {
+          auto m = static_cast<ComputeServicePilotJobStartedMessage *>(message.get());
+          return std::unique_ptr<PilotJobStartedEvent>(
+                  new PilotJobStartedEvent(m->job, m->compute_service));
+        }
+
+        case SimulationMessage::COMPUTE_SERVICE_PILOT_JOB_EXPIRED: {
+          auto m = static_cast<ComputeServicePilotJobExpiredMessage *>(message.get());
+          return std::unique_ptr<PilotJobExpiredEvent>(
+                  new PilotJobExpiredEvent(m->job, m->compute_service));
+        }
+
+        case SimulationMessage::STORAGE_SERVICE_FILE_COPY_ANSWER: {
+          auto m = static_cast<StorageServiceFileCopyAnswerMessage *>(message.get());
+          if (m->success) {
+            return std::unique_ptr<FileCopyCompletedEvent>(
+                    new FileCopyCompletedEvent(m->file, m->storage_service, m->file_registry_service, m->file_registry_service_updated));
+
+          } else {
+            return std::unique_ptr<FileCopyFailedEvent>(
+                    new FileCopyFailedEvent(m->file, m->storage_service, m->failure_cause));
+          }
+        }
+
+        default: {
+          throw std::runtime_error(
+                  "WorkflowExecutionEvent::waitForNextExecutionEvent(): Non-handled message type when generating execution event");
         }
-      } else {
-        throw std::runtime_error(
-                "WorkflowExecutionEvent::waitForNextExecutionEvent(): Non-handled message type when generating execution event");
       }
     }
 
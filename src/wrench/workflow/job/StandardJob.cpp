@@ -50,8 +50,7 @@ namespace wrench {
       // Check that this is a ready sub-graph
       for (auto t : tasks) {
         if (t->getState() != WorkflowTask::State::READY) {
-          std::vector<WorkflowTask *> parents = t->getWorkflow()->getTaskParents(t);
-          for (auto parent : parents) {
+          for (auto parent : t->getWorkflow()->getTaskParentsSpan(t)) {
             if (parent->getState() != WorkflowTask::State::COMPLETED) {
               if (std::find(tasks.begin(), tasks.end(), parent) == tasks.end()) {
                 throw std::invalid_argument("StandardJob::StandardJob(): Task '" + t->getID() +
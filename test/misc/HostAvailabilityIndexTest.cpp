@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+#include <wrench/services/compute/batch/HostAvailabilityIndex.h>
+
+class HostAvailabilityIndexTest : public ::testing::Test {
+};
+
+TEST_F(HostAvailabilityIndexTest, AllocateAndRelease) {
+  wrench::HostAvailabilityIndex index({"host2", "host1", "host3"}, 4);
+
+  ASSERT_EQ(index.getNumHosts(), 3);
+  ASSERT_EQ(index.getNumCoresPerHost(), 4);
+  ASSERT_EQ(index.getHostID("host1"), 1);
+  ASSERT_EQ(index.getHostname(2), "host3");
+  ASSERT_EQ(index.getHostIDsInHostnameOrder(), std::vector<unsigned long>({1, 0, 2}));
+  ASSERT_THROW(index.getHostID("host4"), std::invalid_argument);
+  ASSERT_EQ(index.getNumIdleHosts(), 3);
+
+  index.allocateCores(0, 3);
+  ASSERT_EQ(index.getNumAvailableCores(0), 1);
+  ASSERT_FALSE(index.isIdle(0));
+  ASSERT_EQ(index.getNumIdleHosts(), 2);
+  ASSERT_THROW(index.allocateCores(0, 2), std::invalid_argument);
+
+  index.releaseCores(0, 3);
+  ASSERT_TRUE(index.isIdle(0));
+  ASSERT_EQ(index.getNumIdleHosts(), 3);
+  ASSERT_THROW(index.releaseCores(0, 1), std::invalid_argument);
+
+  ASSERT_THROW(wrench::HostAvailabilityIndex({"host1", "host1"}, 4), std::invalid_argument);
+}
+
+TEST_F(HostAvailabilityIndexTest, HostSelection) {
+  wrench::HostAvailabilityIndex index({"host2", "host1", "host3", "host0"}, 4);
+
+  index.allocateCores(1, 1); // host1: 3 cores left
+  index.allocateCores(2, 3); // host3: 1 core left
+
+  // FIRSTFIT: hostname order
+  ASSERT_EQ(index.selectFirstFit(2, 2), std::vector<unsigned long>({3, 1}));
+  ASSERT_EQ(index.selectFirstFit(3, 2), std::vector<unsigned long>({3, 1, 0}));
+  ASSERT_TRUE(index.selectFirstFit(4, 2).empty());
+  ASSERT_TRUE(index.selectFirstFit(1, 5).empty());
+
+  // BESTFIT: fewest cores left, then hostname order
+  ASSERT_EQ(index.selectBestFit(1, 1), std::vector<unsigned long>({2}));
+  ASSERT_EQ(index.selectBestFit(3, 2), std::vector<unsigned long>({1, 3, 0}));
+
+  // ROUNDROBIN: host ID order, after the last selected host
+  ASSERT_EQ(index.selectRoundRobin(2, 2, 0), std::vector<unsigned long>({1, 3}));
+  ASSERT_EQ(index.selectRoundRobin(2, 2, 1), std::vector<unsigned long>({3, 0}));
+  ASSERT_EQ(index.selectRoundRobin(3, 1, 3), std::vector<unsigned long>({0, 1, 2}));
+  ASSERT_TRUE(index.selectRoundRobin(4, 2, 0).empty());
+}
+
+TEST_F(HostAvailabilityIndexTest, FirstFitMatchesLinearScan) {
+  std::vector<std::string> hostnames;
+  for (unsigned long i = 0; i < 100; i++) {
+    hostnames.push_back("host" + std::to_string(i));
+  }
+  wrench::HostAvailabilityIndex index(hostnames, 8);
+  std::map<std::string, unsigned long> available;
+  for (auto const &h : hostnames) {
+    available[h] = 8;
+  }
+
+  std::mt19937 rng(42);
+  for (unsigned long i = 0; i < 1000; i++) {
+    unsigned long num_hosts = 1 + rng() % 10;
+    unsigned long num_cores = 1 + rng() % 8;
+
+    std::vector<unsigned long> expected;
+    for (auto const &h : available) {
+      if ((h.second >= num_cores) and (expected.size() < num_hosts)) {
+        expected.push_back(index.getHostID(h.first));
+      }
+    }
+    if (expected.size() < num_hosts) {
+      expected.clear();
+    }
+    ASSERT_EQ(index.selectFirstFit(num_hosts, num_cores), expected);
+
+    // Randomly allocate the selected cores, or release the cores of some host
+    if (rng() % 2) {
+      for (auto id : expected) {
+        index.allocateCores(id, num_cores);
+        available[hostnames[id]] -= num_cores;
+      }
+    } else {
+      unsigned long id = rng() % hostnames.size();
+      index.releaseCores(id, 8 - available[hostnames[id]]);
+      available[hostnames[id]] = 8;
+    }
+  }
+}
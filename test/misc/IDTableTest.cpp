@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench/util/IDTable.h>
+
+class IDTableTest : public ::testing::Test {
+};
+
+TEST_F(IDTableTest, InsertAndFind) {
+  wrench::IDTable table;
+
+  ASSERT_EQ(table.find("task1"), wrench::IDTable::NOT_FOUND);
+  ASSERT_EQ(table.insert("task1"), std::make_pair(0UL, true));
+  ASSERT_EQ(table.insert("task2"), std::make_pair(1UL, true));
+  ASSERT_EQ(table.insert("task1"), std::make_pair(0UL, false));
+  ASSERT_EQ(table.find("task1"), 0);
+  ASSERT_EQ(table.find("task2"), 1);
+  ASSERT_EQ(table.getString(1), "task2");
+  ASSERT_EQ(table.getNumIndices(), 2);
+
+  // Enough IDs to grow the table several times
+  for (unsigned long i = 0; i < 10000; i++) {
+    ASSERT_EQ(table.insert("ID" + std::to_string(i)), std::make_pair(i + 2, true));
+  }
+  for (unsigned long i = 0; i < 10000; i++) {
+    ASSERT_EQ(table.find("ID" + std::to_string(i)), i + 2);
+  }
+  ASSERT_EQ(table.find("ID10000"), wrench::IDTable::NOT_FOUND);
+}
+
+TEST_F(IDTableTest, Erase) {
+  wrench::IDTable table;
+
+  for (unsigned long i = 0; i < 1000; i++) {
+    table.insert("ID" + std::to_string(i));
+  }
+
+  // Erase every other ID: the remaining ones can still be found
+  for (unsigned long i = 0; i < 1000; i += 2) {
+    ASSERT_NO_THROW(table.erase(i));
+  }
+  for (unsigned long i = 0; i < 1000; i++) {
+    ASSERT_EQ(table.find("ID" + std::to_string(i)), (i % 2) ? i : wrench::IDTable::NOT_FOUND);
+  }
+
+  ASSERT_THROW(table.erase(0), std::invalid_argument);
+  ASSERT_THROW(table.erase(1000), std::invalid_argument);
+
+  // Indices of erased IDs are not reused
+  ASSERT_EQ(table.insert("ID0"), std::make_pair(1000UL, true));
+  ASSERT_EQ(table.getNumIndices(), 1001);
+}
+
+TEST_F(IDTableTest, ReuseErasedIndices) {
+  wrench::IDTable table(true);
+
+  for (unsigned long i = 0; i < 100; i++) {
+    table.insert("ID" + std::to_string(i));
+  }
+  table.erase(10);
+  table.erase(20);
+
+  // Indices of erased IDs are reused (the last erased one first)
+  ASSERT_EQ(table.insert("new_ID1"), std::make_pair(20UL, true));
+  ASSERT_EQ(table.insert("new_ID2"), std::make_pair(10UL, true));
+  ASSERT_EQ(table.insert("new_ID3"), std::make_pair(100UL, true));
+  ASSERT_EQ(table.find("new_ID1"), 20);
+  ASSERT_EQ(table.getString(10), "new_ID2");
+  ASSERT_EQ(table.find("ID10"), wrench::IDTable::NOT_FOUND);
+  ASSERT_EQ(table.find("ID11"), 11);
+
+  // IDs that come and go do not make the indices grow
+  for (unsigned long i = 0; i < 10000; i++) {
+    std::pair<unsigned long, bool> inserted = table.insert("transient_ID" + std::to_string(i));
+    ASSERT_TRUE(inserted.second);
+    table.erase(inserted.first);
+  }
+  ASSERT_EQ(table.getNumIndices(), 102);
+}
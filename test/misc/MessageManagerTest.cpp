@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench/util/MessageManager.h>
+
+class MessageManagerTest : public ::testing::Test {
+};
+
+/** @brief A message that counts its deletions */
+class CountedMessage : public wrench::SimulationMessage {
+public:
+    CountedMessage(unsigned long *num_deleted) : SimulationMessage("counted", 0), num_deleted(num_deleted) {}
+    ~CountedMessage() { (*this->num_deleted)++; }
+
+    unsigned long *num_deleted;
+};
+
+TEST_F(MessageManagerTest, ManageAndCleanUp) {
+  unsigned long num_deleted = 0;
+  unsigned long num_lists = wrench::MessageManager::getNumMessageLists();
+  std::vector<wrench::SimulationMessage *> messages;
+
+  for (unsigned long i = 0; i < 100; i++) {
+    auto msg = new CountedMessage(&num_deleted);
+    wrench::MessageManager::manageMessage("mailbox_" + std::to_string(i % 3), msg);
+    messages.push_back(msg);
+  }
+  ASSERT_EQ(wrench::MessageManager::getNumMessageLists(), num_lists + 3);
+
+  // Receive some messages of mailbox_0, out of order
+  for (long i = 99; i >= 0; i -= 3) {
+    wrench::MessageManager::removeReceivedMessages("mailbox_0", messages[i]);
+    delete messages[i];
+  }
+  ASSERT_EQ(num_deleted, 34);
+
+  // The list of a mailbox whose messages have all been received is erased
+  ASSERT_EQ(wrench::MessageManager::getNumMessageLists(), num_lists + 2);
+
+  // A message deleted by its receiver without being removed, and a message that was never
+  // managed, are ignored
+  delete messages[1];
+  ASSERT_EQ(num_deleted, 35);
+  wrench::SimulationMessage unmanaged("unmanaged", 0);
+  ASSERT_NO_THROW(wrench::MessageManager::removeReceivedMessages("mailbox_1", &unmanaged));
+
+  // Only the messages of the cleaned-up mailbox are deleted
+  wrench::MessageManager::cleanUpMessages("mailbox_1");
+  ASSERT_EQ(num_deleted, 35 + 32);
+  ASSERT_EQ(wrench::MessageManager::getNumMessageLists(), num_lists + 1);
+  wrench::MessageManager::cleanUpMessages("mailbox_1");
+  wrench::MessageManager::cleanUpMessages("bogus");
+  ASSERT_EQ(num_deleted, 35 + 32);
+
+  wrench::MessageManager::cleanUpMessages("mailbox_2");
+  ASSERT_EQ(num_deleted, 100);
+  ASSERT_EQ(wrench::MessageManager::getNumMessageLists(), num_lists);
+}
+
+TEST_F(MessageManagerTest, MailboxHandles) {
+  unsigned long num_deleted = 0;
+  unsigned long num_lists = wrench::MessageManager::getNumMessageLists();
+  wrench::S4U_MailboxHandle mailbox("handle_mailbox", 0);
+  wrench::S4U_MailboxHandle copy = mailbox;
+
+  ASSERT_TRUE(copy == mailbox);
+  ASSERT_FALSE(wrench::S4U_MailboxHandle("handle_mailbox", 0) == mailbox);
+  ASSERT_EQ(copy.getName(), "handle_mailbox");
+  ASSERT_THROW(wrench::S4U_MailboxHandle().getName(), std::runtime_error);
+
+  // Messages managed through a handle or through the mailbox name end up in the same list
+  auto msg = new CountedMessage(&num_deleted);
+  wrench::MessageManager::manageMessage(mailbox, msg);
+  wrench::MessageManager::manageMessage(copy, new CountedMessage(&num_deleted));
+  wrench::MessageManager::manageMessage("handle_mailbox", new CountedMessage(&num_deleted));
+  wrench::MessageManager::removeReceivedMessages("handle_mailbox", msg);
+  delete msg;
+  wrench::MessageManager::cleanUpMessages("handle_mailbox");
+  ASSERT_EQ(num_deleted, 3);
+  ASSERT_EQ(wrench::MessageManager::getNumMessageLists(), num_lists);
+
+  // The handle remains usable after a clean up, and shares the list of messages managed by name
+  msg = new CountedMessage(&num_deleted);
+  wrench::MessageManager::manageMessage(mailbox, msg);
+  wrench::MessageManager::manageMessage("handle_mailbox", new CountedMessage(&num_deleted));
+  wrench::MessageManager::cleanUpMessages("handle_mailbox");
+  ASSERT_EQ(num_deleted, 5);
+
+  // The list that a handle refers to is kept when all its messages have been received
+  msg = new CountedMessage(&num_deleted);
+  wrench::MessageManager::manageMessage(mailbox, msg);
+  wrench::MessageManager::removeReceivedMessages("handle_mailbox", msg);
+  delete msg;
+  ASSERT_EQ(wrench::MessageManager::getNumMessageLists(), num_lists + 1);
+  wrench::MessageManager::cleanUpMessages("handle_mailbox");
+  ASSERT_EQ(num_deleted, 6);
+  ASSERT_EQ(wrench::MessageManager::getNumMessageLists(), num_lists);
+}
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <complex>
+#include <random>
+#include <vector>
+#include <wrench/services/network_proximity/NetworkProximityService.h>
+
+class NetworkProximityCoordinatesTest : public ::testing::Test {
+};
+
+/**
+ * @brief The Vivaldi update, as it was computed with complex numbers
+ */
+static std::complex<double> complexVivaldiUpdate(double proximity_value,
+                                                 std::complex<double> sender_coordinates,
+                                                 std::complex<double> peer_coordinates) {
+  const std::complex<double> sensitivity(0.25, 0.25);
+  double estimated_distance = std::sqrt(norm(peer_coordinates - sender_coordinates));
+  double error = proximity_value - estimated_distance;
+  std::complex<double> scaled_direction = (sender_coordinates - peer_coordinates) * error;
+  return sender_coordinates + (scaled_direction * sensitivity);
+}
+
+TEST_F(NetworkProximityCoordinatesTest, VivaldiUpdate) {
+  const unsigned long num_hosts = 10;
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> coordinate_dist(-1.0, 1.0);
+  std::uniform_real_distribution<double> proximity_dist(0.0, 2.0);
+
+  std::vector<double> coordinates_x(num_hosts);
+  std::vector<double> coordinates_y(num_hosts);
+  std::vector<std::complex<double>> coordinates(num_hosts);
+  for (unsigned long i = 0; i < num_hosts; i++) {
+    coordinates_x[i] = coordinate_dist(rng);
+    coordinates_y[i] = coordinate_dist(rng);
+    coordinates[i] = std::complex<double>(coordinates_x[i], coordinates_y[i]);
+  }
+
+  // A round-robin sequence of measurements, over which both computations should stay in sync
+  for (unsigned long round = 0; round < 100; round++) {
+    for (unsigned long sender = 0; sender < num_hosts; sender++) {
+      unsigned long peer = (sender + 1 + round % (num_hosts - 1)) % num_hosts;
+      double proximity_value = proximity_dist(rng);
+
+      wrench::NetworkProximityService::vivaldiUpdate(proximity_value, coordinates_x.data(), coordinates_y.data(),
+                                                     sender, peer);
+      coordinates[sender] = complexVivaldiUpdate(proximity_value, coordinates[sender], coordinates[peer]);
+
+      for (unsigned long i = 0; i < num_hosts; i++) {
+        ASSERT_DOUBLE_EQ(coordinates_x[i], coordinates[i].real());
+        ASSERT_DOUBLE_EQ(coordinates_y[i], coordinates[i].imag());
+      }
+    }
+  }
+}
+
+TEST_F(NetworkProximityCoordinatesTest, AllProximityValues) {
+  const unsigned long num_hosts = 7;
+  std::vector<double> coordinates_x = {0.0, 3.0, -1.5, 2.0, 0.0, 10.0, -4.0};
+  std::vector<double> coordinates_y = {0.0, 4.0, 2.5, -2.0, 1.0, 0.0, -3.0};
+
+  std::vector<double> proximity_values(num_hosts * num_hosts, -1.0);
+  wrench::NetworkProximityService::computeAllProximityValues(coordinates_x.data(), coordinates_y.data(),
+                                                             num_hosts, proximity_values.data());
+
+  for (unsigned long i = 0; i < num_hosts; i++) {
+    for (unsigned long j = 0; j < num_hosts; j++) {
+      double distance = std::abs(std::complex<double>(coordinates_x[j], coordinates_y[j]) -
+                                 std::complex<double>(coordinates_x[i], coordinates_y[i]));
+      ASSERT_DOUBLE_EQ(proximity_values[i * num_hosts + j], distance);
+    }
+  }
+  ASSERT_DOUBLE_EQ(proximity_values[0 * num_hosts + 1], 5.0);
+  ASSERT_DOUBLE_EQ(proximity_values[1 * num_hosts + 0], 5.0);
+}
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench/services/compute/batch/NodeAvailabilityProfile.h>
+
+class NodeAvailabilityProfileTest : public ::testing::Test {
+};
+
+TEST_F(NodeAvailabilityProfileTest, AllocateAndRelease) {
+  wrench::NodeAvailabilityProfile profile(4);
+
+  ASSERT_EQ(profile.getNumAvailableNodes(0), 4);
+  ASSERT_EQ(profile.getNumSteps(), 1);
+
+  profile.allocate(0, 60, 3);
+  profile.allocate(60, 120, 4);
+  ASSERT_EQ(profile.getNumAvailableNodes(0), 1);
+  ASSERT_EQ(profile.getNumAvailableNodes(59), 1);
+  ASSERT_EQ(profile.getNumAvailableNodes(60), 0);
+  ASSERT_EQ(profile.getNumAvailableNodes(120), 4);
+
+  // Adjacent steps with the same number of available nodes are merged
+  profile.allocate(0, 60, 1);
+  ASSERT_EQ(profile.getNumSteps(), 3);
+  ASSERT_EQ(profile.getNumAvailableNodes(30), 0);
+
+  profile.release(0, 60, 1);
+  profile.release(60, 120, 4);
+  profile.release(0, 60, 3);
+  ASSERT_EQ(profile.getNumSteps(), 1);
+  ASSERT_EQ(profile.getNumAvailableNodes(30), 4);
+}
+
+TEST_F(NodeAvailabilityProfileTest, EarliestStartDate) {
+  wrench::NodeAvailabilityProfile profile(4);
+
+  profile.allocate(0, 60, 2);     // a running job
+  profile.allocate(60, 120, 4);   // a reservation
+
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(0, 60, 2), 0);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(0, 61, 2), 120);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(0, 10, 3), 120);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(10, 30, 1), 10);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(200, 30, 4), 200);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(0, 10, 5), -1.0);
+
+  // A hole between two allocations
+  profile.allocate(150, 300, 3);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(0, 30, 4), 120);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(0, 31, 4), 300);
+  ASSERT_DOUBLE_EQ(profile.getEarliestStartDate(0, 1000, 1), 120);
+}
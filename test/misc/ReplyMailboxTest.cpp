@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+#include <wrench/simgrid_S4U_util/S4U_Mailbox.h>
+
+class ReplyMailboxTest : public ::testing::Test {
+};
+
+TEST_F(ReplyMailboxTest, GetAndRelease) {
+  std::string mailbox1 = wrench::S4U_Mailbox::getReplyMailbox();
+  std::string mailbox2 = wrench::S4U_Mailbox::getReplyMailbox();
+  ASSERT_NE(mailbox1, mailbox2);
+
+  // A released mailbox is reused
+  wrench::S4U_Mailbox::releaseReplyMailbox(mailbox1);
+  std::string mailbox3 = wrench::S4U_Mailbox::getReplyMailbox();
+  ASSERT_EQ(mailbox3, mailbox1);
+
+  // A mailbox cannot be released twice, nor can a mailbox that is not a reply mailbox
+  wrench::S4U_Mailbox::releaseReplyMailbox(mailbox2);
+  ASSERT_THROW(wrench::S4U_Mailbox::releaseReplyMailbox(mailbox2), std::invalid_argument);
+  ASSERT_THROW(wrench::S4U_Mailbox::releaseReplyMailbox("not_a_reply_mailbox"), std::invalid_argument);
+  wrench::S4U_Mailbox::releaseReplyMailbox(mailbox3);
+
+  // A mailbox in use is never handed out, whatever the order of gets and releases
+  std::set<std::string> in_use;
+  for (unsigned long i = 0; i < 100; i++) {
+    std::string mailbox = wrench::S4U_Mailbox::getReplyMailbox();
+    ASSERT_TRUE(in_use.insert(mailbox).second);
+    if (i % 3 == 0) {
+      wrench::S4U_Mailbox::releaseReplyMailbox(*in_use.begin());
+      in_use.erase(in_use.begin());
+    }
+  }
+  for (auto const &mailbox : in_use) {
+    wrench::S4U_Mailbox::releaseReplyMailbox(mailbox);
+  }
+}
+
+TEST_F(ReplyMailboxTest, Guard) {
+  std::string name;
+
+  // A released mailbox is reused
+  {
+    wrench::S4U_ReplyMailbox mailbox;
+    name = mailbox.getName();
+    mailbox.release();
+    ASSERT_THROW(mailbox.getName(), std::runtime_error);
+    ASSERT_THROW(mailbox.release(), std::runtime_error);
+  }
+  {
+    wrench::S4U_ReplyMailbox mailbox;
+    ASSERT_EQ(mailbox.getName(), name);
+    mailbox.release();
+  }
+
+  // A mailbox that is not released (e.g., because of an exception) is discarded, and never reused
+  try {
+    wrench::S4U_ReplyMailbox mailbox;
+    name = mailbox.getName();
+    throw std::runtime_error("failure");
+  } catch (std::runtime_error &e) {
+  }
+  ASSERT_THROW(wrench::S4U_Mailbox::releaseReplyMailbox(name), std::invalid_argument);
+  std::set<std::string> in_use;
+  for (unsigned long i = 0; i < 10; i++) {
+    std::string mailbox = wrench::S4U_Mailbox::getReplyMailbox();
+    ASSERT_NE(mailbox, name);
+    in_use.insert(mailbox);
+  }
+  for (auto const &mailbox : in_use) {
+    wrench::S4U_Mailbox::releaseReplyMailbox(mailbox);
+  }
+
+  // A moved mailbox is held by the new object only
+  {
+    wrench::S4U_ReplyMailbox mailbox;
+    name = mailbox.getName();
+    std::vector<wrench::S4U_ReplyMailbox> mailboxes;
+    mailboxes.push_back(std::move(mailbox));
+    ASSERT_THROW(mailbox.getName(), std::runtime_error);
+    ASSERT_EQ(mailboxes[0].getName(), name);
+    mailboxes[0].release();
+  }
+  wrench::S4U_ReplyMailbox mailbox;
+  ASSERT_EQ(mailbox.getName(), name);
+  mailbox.release();
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench/simulation/SimulationMessage.h>
+#include <wrench/simulation/SimulationMessagePool.h>
+#include <wrench/util/MessageManager.h>
+
+class SimulationMessagePoolTest : public ::testing::Test {
+};
+
+/** @brief A message larger than the largest pooled block */
+class LargeMessage : public wrench::SimulationMessage {
+public:
+    LargeMessage() : SimulationMessage("large", 0) {}
+
+    char data[2 * wrench::SimulationMessagePool::MAX_BLOCK_SIZE];
+};
+
+/** @brief A message of a different size than SimulationMessage */
+class PaddedMessage : public wrench::SimulationMessage {
+public:
+    PaddedMessage() : SimulationMessage("padded", 0) {}
+
+    char data[100];
+};
+
+/**
+ * @brief Get the statistics of the size class of a given size
+ */
+wrench::SimulationMessagePool::SizeClassStatistics getStatistics(size_t size) {
+  for (auto const &statistics : wrench::SimulationMessagePool::getSizeClassStatistics()) {
+    if ((statistics.block_size >= size) and (statistics.block_size < size + wrench::SimulationMessagePool::GRANULARITY)) {
+      return statistics;
+    }
+  }
+  return {0, 0, 0, 0, 0};
+}
+
+TEST_F(SimulationMessagePoolTest, Reuse) {
+  auto msg = new wrench::SimulationMessage("message", 0);
+  unsigned long num_in_use = getStatistics(sizeof(wrench::SimulationMessage)).num_in_use;
+  ASSERT_GE(num_in_use, 1);
+  delete msg;
+  ASSERT_EQ(getStatistics(sizeof(wrench::SimulationMessage)).num_in_use, num_in_use - 1);
+
+  // The freed block is reused by the next message of the same size class
+  auto other_msg = new wrench::SimulationMessage("message", 0);
+  ASSERT_EQ(other_msg, msg);
+
+  // Messages of other sizes use other blocks, which are returned to their own size class
+  std::vector<PaddedMessage *> padded_messages;
+  for (unsigned long i = 0; i < 1000; i++) {
+    padded_messages.push_back(new PaddedMessage());
+  }
+  ASSERT_GE(getStatistics(sizeof(PaddedMessage)).num_in_use, 1000);
+  ASSERT_GE(getStatistics(sizeof(PaddedMessage)).max_num_in_use, 1000);
+  for (auto padded_msg : padded_messages) {
+    ASSERT_NE((void *) padded_msg, (void *) other_msg);
+    delete padded_msg;
+  }
+  ASSERT_EQ(getStatistics(sizeof(PaddedMessage)).num_in_use, 0);
+
+  // Large messages are not pooled
+  auto large_msg = new LargeMessage();
+  large_msg->data[sizeof(large_msg->data) - 1] = 0;
+  delete large_msg;
+
+  // Managed messages are deleted through the pool as well
+  wrench::MessageManager::manageMessage("pool_test_mailbox", new PaddedMessage());
+  ASSERT_EQ(getStatistics(sizeof(PaddedMessage)).num_in_use, 1);
+  wrench::MessageManager::cleanUpMessages("pool_test_mailbox");
+  ASSERT_EQ(getStatistics(sizeof(PaddedMessage)).num_in_use, 0);
+
+  // Messages whose construction fails are returned to the pool
+  ASSERT_THROW(new wrench::SimulationMessage("", 0), std::invalid_argument);
+
+  delete other_msg;
+}
@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench/simulation/SimulationMessage.h>
+
+class SimulationMessageTest : public ::testing::Test {
+};
+
+/** @brief A message defined outside of WRENCH, which does not specify a type */
+class UserDefinedMessage : public wrench::SimulationMessage {
+public:
+    UserDefinedMessage() : SimulationMessage("user_defined", 0) {}
+};
+
+TEST_F(SimulationMessageTest, Type) {
+  wrench::SimulationMessage::resetNumMessagesCreated();
+
+  UserDefinedMessage user_defined_msg;
+  ASSERT_EQ(user_defined_msg.type, wrench::SimulationMessage::GENERIC);
+  ASSERT_EQ(wrench::SimulationMessage::getNumMessagesCreated(wrench::SimulationMessage::GENERIC), 1);
+
+  wrench::SimulationMessage msg1(wrench::SimulationMessage::SERVICE_STOP_DAEMON, "stop", 0);
+  wrench::SimulationMessage msg2(wrench::SimulationMessage::SERVICE_STOP_DAEMON, "stop", 0);
+  ASSERT_EQ(msg1.type, wrench::SimulationMessage::SERVICE_STOP_DAEMON);
+  ASSERT_EQ(wrench::SimulationMessage::getNumMessagesCreated(wrench::SimulationMessage::SERVICE_STOP_DAEMON), 2);
+  ASSERT_EQ(wrench::SimulationMessage::getNumMessagesCreated(wrench::SimulationMessage::GENERIC), 1);
+
+  // Messages that are deleted are no longer alive
+  unsigned long num_alive = wrench::SimulationMessage::getNumMessagesAlive(wrench::SimulationMessage::SERVICE_STOP_DAEMON);
+  ASSERT_GE(num_alive, 2);
+  auto msg3 = new wrench::SimulationMessage(wrench::SimulationMessage::SERVICE_STOP_DAEMON, "stop", 0);
+  ASSERT_EQ(wrench::SimulationMessage::getNumMessagesAlive(wrench::SimulationMessage::SERVICE_STOP_DAEMON), num_alive + 1);
+  delete msg3;
+  ASSERT_EQ(wrench::SimulationMessage::getNumMessagesAlive(wrench::SimulationMessage::SERVICE_STOP_DAEMON), num_alive);
+
+  wrench::SimulationMessage::resetNumMessagesCreated();
+  ASSERT_EQ(wrench::SimulationMessage::getNumMessagesCreated(wrench::SimulationMessage::SERVICE_STOP_DAEMON), 0);
+  ASSERT_EQ(wrench::SimulationMessage::getNumMessagesAlive(wrench::SimulationMessage::SERVICE_STOP_DAEMON), num_alive);
+
+  ASSERT_THROW(wrench::SimulationMessage(wrench::SimulationMessage::NUM_TYPES, "bogus", 0), std::invalid_argument);
+  ASSERT_THROW(wrench::SimulationMessage::getNumMessagesCreated(wrench::SimulationMessage::NUM_TYPES),
+               std::invalid_argument);
+  ASSERT_THROW(wrench::SimulationMessage::getNumMessagesAlive(wrench::SimulationMessage::NUM_TYPES),
+               std::invalid_argument);
+}
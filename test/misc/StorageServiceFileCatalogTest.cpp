@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench/services/storage/StorageServiceFileCatalog.h>
+#include <wrench/workflow/Workflow.h>
+
+class StorageServiceFileCatalogTest : public ::testing::Test {
+
+protected:
+    StorageServiceFileCatalogTest() {
+      file1 = workflow.addFile("file1", 100.0);
+      file2 = workflow.addFile("file2", 10.0);
+    }
+
+    wrench::Workflow workflow;
+    wrench::WorkflowFile *file1;
+    wrench::WorkflowFile *file2;
+};
+
+TEST_F(StorageServiceFileCatalogTest, InsertAndRemove) {
+  wrench::StorageServiceFileCatalog catalog;
+
+  ASSERT_FALSE(catalog.lookup("/", file1));
+  ASSERT_TRUE(catalog.insert("/", file1));
+  ASSERT_FALSE(catalog.insert("/", file1));
+  ASSERT_TRUE(catalog.insert("/", file2));
+  ASSERT_TRUE(catalog.insert("/job", file1));
+  ASSERT_TRUE(catalog.lookup("/", file1));
+  ASSERT_TRUE(catalog.lookup("/job", file1));
+  ASSERT_FALSE(catalog.lookup("/job", file2));
+  ASSERT_FALSE(catalog.lookup("/other_job", file1));
+
+  ASSERT_DOUBLE_EQ(catalog.getOccupiedSpace("/"), 110.0);
+  ASSERT_DOUBLE_EQ(catalog.getOccupiedSpace("/job"), 100.0);
+  ASSERT_DOUBLE_EQ(catalog.getOccupiedSpace("/other_job"), 0.0);
+  ASSERT_EQ(catalog.getNumFiles("/"), 2);
+  ASSERT_EQ(catalog.getNumFiles(), 3);
+
+  ASSERT_TRUE(catalog.remove("/", file1));
+  ASSERT_FALSE(catalog.remove("/", file1));
+  ASSERT_FALSE(catalog.remove("/other_job", file1));
+  ASSERT_FALSE(catalog.lookup("/", file1));
+  ASSERT_TRUE(catalog.lookup("/job", file1));
+  ASSERT_DOUBLE_EQ(catalog.getOccupiedSpace("/"), 10.0);
+  ASSERT_EQ(catalog.getNumFiles(), 2);
+}
+
+TEST_F(StorageServiceFileCatalogTest, RemovePartition) {
+  wrench::StorageServiceFileCatalog catalog;
+
+  catalog.insert("/", file1);
+  catalog.insert("/job", file1);
+  catalog.insert("/job", file2);
+
+  ASSERT_EQ(catalog.removePartition("/job"), 2);
+  ASSERT_EQ(catalog.removePartition("/job"), 0);
+  ASSERT_EQ(catalog.removePartition("/other_job"), 0);
+  ASSERT_FALSE(catalog.lookup("/job", file1));
+  ASSERT_FALSE(catalog.lookup("/job", file2));
+  ASSERT_TRUE(catalog.lookup("/", file1));
+  ASSERT_DOUBLE_EQ(catalog.getOccupiedSpace("/job"), 0.0);
+  ASSERT_EQ(catalog.getNumFiles(), 1);
+
+  // A removed partition can be used again
+  ASSERT_TRUE(catalog.insert("/job", file2));
+  ASSERT_DOUBLE_EQ(catalog.getOccupiedSpace("/job"), 10.0);
+  ASSERT_EQ(catalog.getNumFiles(), 2);
+}
+
+TEST_F(StorageServiceFileCatalogTest, ManyPartitions) {
+  wrench::StorageServiceFileCatalog catalog;
+
+  catalog.insert("/", file1);
+
+  // Partitions that come and go, like the scratch partitions of jobs, reuse the slots
+  // of removed partitions, but never the files that were in them
+  for (unsigned long i = 0; i < 1000; i++) {
+    std::string partition = "/job_" + std::to_string(i);
+    ASSERT_FALSE(catalog.lookup(partition, file2));
+    ASSERT_DOUBLE_EQ(catalog.getOccupiedSpace(partition), 0.0);
+    ASSERT_TRUE(catalog.insert(partition, file2));
+    ASSERT_EQ(catalog.getNumFiles(), 2);
+    ASSERT_EQ(catalog.removePartition(partition), 1);
+  }
+
+  ASSERT_TRUE(catalog.lookup("/", file1));
+  ASSERT_EQ(catalog.getNumFiles(), 1);
+}
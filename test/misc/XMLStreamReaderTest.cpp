@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <wrench/util/XMLStreamReader.h>
+
+class XMLStreamReaderTest : public ::testing::Test {
+};
+
+TEST_F(XMLStreamReaderTest, Events) {
+  std::istringstream xml(
+          "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+          "<!DOCTYPE adag [ <!ENTITY e \"x\"> ]>\n"
+          "<!-- a comment with <tags> -- and dashes --->\n"
+          "<adag name='test'>\n"
+          "  <job id=\"ID1\" runtime = \"1.5\">text<![CDATA[<notatag>]]>\n"
+          "    <uses file=\"a&amp;b &lt;&#65;&#x42;&gt; &quot;&apos;&e;\" link=\"input\"/>\n"
+          "  </job >\n"
+          "  <child ref=\"ID1\"/>\n"
+          "</adag>\n");
+
+  wrench::XMLStreamReader reader(xml);
+
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::START_ELEMENT);
+  ASSERT_EQ(reader.getName(), "adag");
+  ASSERT_EQ(reader.getDepth(), 0);
+  ASSERT_EQ(reader.getAttribute("name"), "test");
+
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::START_ELEMENT);
+  ASSERT_EQ(reader.getName(), "job");
+  ASSERT_EQ(reader.getDepth(), 1);
+  ASSERT_TRUE(reader.hasAttribute("id"));
+  ASSERT_FALSE(reader.hasAttribute("name"));
+  ASSERT_EQ(reader.getAttribute("id"), "ID1");
+  ASSERT_EQ(reader.getAttribute("runtime"), "1.5");
+  ASSERT_EQ(reader.getAttribute("name"), "");
+
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::START_ELEMENT);
+  ASSERT_EQ(reader.getName(), "uses");
+  ASSERT_EQ(reader.getDepth(), 2);
+  ASSERT_EQ(reader.getAttribute("file"), "a&b <AB> \"'&e;");
+  ASSERT_EQ(reader.getAttribute("link"), "input");
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_ELEMENT);
+  ASSERT_EQ(reader.getName(), "uses");
+  ASSERT_EQ(reader.getDepth(), 2);
+
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_ELEMENT);
+  ASSERT_EQ(reader.getName(), "job");
+  ASSERT_EQ(reader.getDepth(), 1);
+  ASSERT_FALSE(reader.hasAttribute("id"));
+
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::START_ELEMENT);
+  ASSERT_EQ(reader.getName(), "child");
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_ELEMENT);
+  ASSERT_EQ(reader.getName(), "child");
+
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_ELEMENT);
+  ASSERT_EQ(reader.getName(), "adag");
+  ASSERT_EQ(reader.getDepth(), 0);
+
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_OF_DOCUMENT);
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_OF_DOCUMENT);
+}
+
+TEST_F(XMLStreamReaderTest, LargeDocument) {
+  // A document larger than the reader's internal buffer
+  std::string xml = "<adag>";
+  for (unsigned long i = 0; i < 10000; i++) {
+    xml += "<job id=\"ID" + std::to_string(i) + "\"/>";
+  }
+  xml += "</adag>";
+  std::istringstream input(xml);
+
+  wrench::XMLStreamReader reader(input);
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::START_ELEMENT);
+  for (unsigned long i = 0; i < 10000; i++) {
+    ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::START_ELEMENT);
+    ASSERT_EQ(reader.getAttribute("id"), "ID" + std::to_string(i));
+    ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_ELEMENT);
+  }
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_ELEMENT);
+  ASSERT_EQ(reader.next(), wrench::XMLStreamReader::Event::END_OF_DOCUMENT);
+}
+
+TEST_F(XMLStreamReaderTest, InvalidDocuments) {
+  for (std::string invalid : {"",
+                              "   ",
+                              "not xml",
+                              "<adag>",
+                              "<adag></job>",
+                              "<adag><job></adag>",
+                              "<adag/><adag/>",
+                              "<adag/>text",
+                              "<adag id=ID1/>",
+                              "<adag id/>",
+                              "<adag id=\"ID1/>",
+                              "<adag id=\"&bogus\"/>",
+                              "<adag><!-- comment </adag>",
+                              "<adag/ >"}) {
+    std::istringstream input(invalid);
+    wrench::XMLStreamReader reader(input);
+    ASSERT_THROW(while (reader.next() != wrench::XMLStreamReader::Event::END_OF_DOCUMENT) {},
+                 std::invalid_argument) << "Document: " << invalid;
+  }
+}
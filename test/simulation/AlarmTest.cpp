@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+#include <wrench/services/helpers/Alarm.h>
+#include <wrench/services/helpers/AlarmService.h>
+
+#include "../include/TestWithFork.h"
+
+class AlarmTest : public ::testing::Test {
+
+public:
+    void do_AlarmOrdering_test();
+
+protected:
+    AlarmTest() {
+
+      // Create the simplest workflow
+      workflow = new wrench::Workflow();
+
+      // Create a one-host platform file
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"1\"/> "
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+    wrench::Workflow *workflow;
+};
+
+/** @brief A message sent by the test's alarms */
+class AlarmTestMessage : public wrench::SimulationMessage {
+public:
+    explicit AlarmTestMessage(unsigned long id) : SimulationMessage("alarm_test", 0), id(id) {}
+
+    unsigned long id;
+};
+
+/**********************************************************************/
+/**  ALARM ORDERING AND CANCELLATION TEST                            **/
+/**********************************************************************/
+
+class AlarmOrderingTestWMS : public wrench::WMS {
+
+public:
+    AlarmOrderingTestWMS(AlarmTest *test, std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    AlarmTest *test;
+
+    int main() {
+
+      // Arm alarms in an order that differs from that of their dates
+      std::vector<double> dates = {30.0, 10.0, 50.0, 20.0, 10.0, 40.0};
+      std::vector<std::shared_ptr<wrench::Alarm>> alarms;
+      for (unsigned long i = 0; i < dates.size(); i++) {
+        alarms.push_back(wrench::Alarm::createAndStartAlarm(this->simulation, dates[i], this->hostname,
+                                                            this->mailbox_name, new AlarmTestMessage(i), "test"));
+      }
+
+      // An alarm in the past does not go off
+      wrench::Alarm::createAndStartAlarm(this->simulation, 0.0, this->hostname, this->mailbox_name,
+                                         new AlarmTestMessage(100), "test");
+
+      // Cancel two alarms, including one that is not the next one to go off
+      alarms[5]->kill();
+      alarms[1]->kill();
+      alarms[1]->kill();
+
+      if (wrench::AlarmService::getAlarmService(this->simulation, this->hostname)->getNumArmedAlarms() != 4) {
+        throw std::runtime_error("Unexpected number of armed alarms");
+      }
+
+      std::vector<unsigned long> expected_ids = {4, 3, 0, 2};
+      for (auto expected_id : expected_ids) {
+        std::unique_ptr<wrench::SimulationMessage> message = wrench::S4U_Mailbox::getMessage(this->mailbox);
+        auto msg = dynamic_cast<AlarmTestMessage *>(message.get());
+        if (msg == nullptr) {
+          throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        }
+        if (msg->id != expected_id) {
+          throw std::runtime_error("Alarm " + std::to_string(msg->id) + " went off instead of alarm " +
+                                   std::to_string(expected_id));
+        }
+        if (std::abs(wrench::S4U_Simulation::getClock() - dates[expected_id]) > 0.001) {
+          throw std::runtime_error("Alarm " + std::to_string(msg->id) + " went off at an unexpected date (" +
+                                   std::to_string(wrench::S4U_Simulation::getClock()) + ")");
+        }
+      }
+
+      // An alarm armed after all others went off, which is earlier than an alarm armed before it
+      auto late_alarm = wrench::Alarm::createAndStartAlarm(this->simulation, 200.0, this->hostname,
+                                                           this->mailbox_name, new AlarmTestMessage(200), "test");
+      wrench::Alarm::createAndStartAlarm(this->simulation, 100.0, this->hostname,
+                                         this->mailbox_name, new AlarmTestMessage(101), "test");
+      std::unique_ptr<wrench::SimulationMessage> message = wrench::S4U_Mailbox::getMessage(this->mailbox);
+      auto msg = dynamic_cast<AlarmTestMessage *>(message.get());
+      if ((msg == nullptr) or (msg->id != 101) or (std::abs(wrench::S4U_Simulation::getClock() - 100.0) > 0.001)) {
+        throw std::runtime_error("The earliest alarm did not go off first");
+      }
+      late_alarm->kill();
+
+      // No other message should arrive
+      bool success = true;
+      try {
+        wrench::S4U_Mailbox::getMessage(this->mailbox, 500.0);
+      } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+        success = false;
+      }
+      if (success) {
+        throw std::runtime_error("A cancelled or past alarm went off");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(AlarmTest, AlarmOrdering) {
+  DO_TEST_WITH_FORK(do_AlarmOrdering_test);
+}
+
+void AlarmTest::do_AlarmOrdering_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("alarm_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = simulation->getHostnameList()[0];
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(new AlarmOrderingTestWMS(this, hostname)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
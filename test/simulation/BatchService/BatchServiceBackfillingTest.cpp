@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include <gtest/gtest.h>
+#include <wrench/services/compute/batch/BatchService.h>
+
+#include "../../include/TestWithFork.h"
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(batch_service_backfilling_test, "Log category for BatchServiceBackfillingTest");
+
+#define EPSILON 0.05
+
+class BatchServiceBackfillingTest : public ::testing::Test {
+
+public:
+    wrench::ComputeService *compute_service = nullptr;
+
+    void do_EASYBackfilling_test();
+    void do_ConservativeBackfilling_test();
+    void do_ConservativeBackfillingReservations_test();
+    void do_BackfillingStartTimeEstimates_test();
+
+    void do_Backfilling_test(std::string scheduling_algorithm,
+                             std::vector<std::tuple<std::string, std::string, double>> job_specs,
+                             std::vector<double> expected_completion_times);
+
+protected:
+    BatchServiceBackfillingTest() {
+
+      // Create the simplest workflow
+      workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+
+      // Create a four-host 10-core platform file
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"10\"/> "
+              "       <host id=\"Host2\" speed=\"1f\" core=\"10\"/> "
+              "       <host id=\"Host3\" speed=\"1f\" core=\"10\"/> "
+              "       <host id=\"Host4\" speed=\"1f\" core=\"10\"/> "
+              "       <link id=\"1\" bandwidth=\"50000GBps\" latency=\"0us\"/>"
+              "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+              "       <route src=\"Host1\" dst=\"Host3\"> <link_ctn id=\"1\"/> </route>"
+              "       <route src=\"Host1\" dst=\"Host4\"> <link_ctn id=\"1\"/> </route>"
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+    std::unique_ptr<wrench::Workflow> workflow;
+
+};
+
+/**********************************************************************/
+/**  BACKFILLING TEST                                                **/
+/**********************************************************************/
+
+class BackfillingTestWMS : public wrench::WMS {
+
+public:
+    BackfillingTestWMS(BatchServiceBackfillingTest *test,
+                       std::vector<std::tuple<std::string, std::string, double>> job_specs,
+                       std::vector<double> expected_completion_times,
+                       const std::set<wrench::ComputeService *> &compute_services,
+                       std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr, hostname,
+                        "test"), job_specs(job_specs), expected_completion_times(expected_completion_times) {
+      this->test = test;
+    }
+
+private:
+
+    BatchServiceBackfillingTest *test;
+    // (-N, -t, task duration in seconds) for each job, in submission order
+    std::vector<std::tuple<std::string, std::string, double>> job_specs;
+    std::vector<double> expected_completion_times;
+
+    int main() {
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // Create one single-task whole-node job per job spec, and submit them all
+      std::map<wrench::StandardJob *, unsigned long> job_indices;
+      for (unsigned long i = 0; i < this->job_specs.size(); i++) {
+        wrench::WorkflowTask *task = this->getWorkflow()->addTask("task" + std::to_string(i),
+                                                                  std::get<2>(this->job_specs[i]), 1, 1, 1.0, 0);
+        wrench::StandardJob *job = job_manager->createStandardJob(task, {});
+        job_indices[job] = i;
+
+        std::map<std::string, std::string> job_args;
+        job_args["-N"] = std::get<0>(this->job_specs[i]);
+        job_args["-t"] = std::get<1>(this->job_specs[i]);
+        job_args["-c"] = "10";
+        try {
+          job_manager->submitJob(job, this->test->compute_service, job_args);
+        } catch (wrench::WorkflowExecutionException &e) {
+          throw std::runtime_error("Unexpected exception while submitting job");
+        }
+      }
+
+      // Wait for all job completions (which may happen in any order)
+      for (unsigned long i = 0; i < this->job_specs.size(); i++) {
+        std::unique_ptr<wrench::WorkflowExecutionEvent> event;
+        try {
+          event = this->getWorkflow()->waitForNextExecutionEvent();
+        } catch (wrench::WorkflowExecutionException &e) {
+          throw std::runtime_error("Error while getting and execution event: " + e.getCause()->toString());
+        }
+        auto real_event = dynamic_cast<wrench::StandardJobCompletedEvent *>(event.get());
+        if (real_event == nullptr) {
+          throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+        }
+
+        unsigned long index = job_indices[real_event->standard_job];
+        double delta = fabs(this->simulation->getCurrentSimulatedDate() - this->expected_completion_times[index]);
+        if (delta > EPSILON) {
+          throw std::runtime_error("Unexpected job completion time for job #" + std::to_string(index) + ": " +
+                                   std::to_string(this->simulation->getCurrentSimulatedDate()) +
+                                   " (expected: " + std::to_string(this->expected_completion_times[index]) + ")");
+        }
+      }
+
+      return 0;
+    }
+};
+
+#ifdef ENABLE_BATSCHED
+TEST_F(BatchServiceBackfillingTest, DISABLED_EASYBackfillingTest)
+#else
+TEST_F(BatchServiceBackfillingTest, EASYBackfillingTest)
+#endif
+{
+  DO_TEST_WITH_FORK(do_EASYBackfilling_test);
+}
+
+void BatchServiceBackfillingTest::do_EASYBackfilling_test() {
+  // Job #3 is backfilled: it runs on the node left by job #0 without delaying job #1's reservation
+  // (it could delay job #2, which has no reservation)
+  do_Backfilling_test("easy_bf",
+                      {std::make_tuple("3", "1", 50), std::make_tuple("2", "1", 50),
+                       std::make_tuple("2", "1", 50), std::make_tuple("1", "3", 50)},
+                      {50, 100, 100, 50});
+}
+
+#ifdef ENABLE_BATSCHED
+TEST_F(BatchServiceBackfillingTest, DISABLED_ConservativeBackfillingTest)
+#else
+TEST_F(BatchServiceBackfillingTest, ConservativeBackfillingTest)
+#endif
+{
+  DO_TEST_WITH_FORK(do_ConservativeBackfilling_test);
+}
+
+void BatchServiceBackfillingTest::do_ConservativeBackfilling_test() {
+  // Job #2 is backfilled: it ends (according to its walltime) when job #1's reservation begins
+  do_Backfilling_test("conservative_bf",
+                      {std::make_tuple("2", "1", 50), std::make_tuple("4", "1", 50),
+                       std::make_tuple("2", "1", 50), std::make_tuple("1", "2", 50)},
+                      {50, 100, 50, 150});
+}
+
+#ifdef ENABLE_BATSCHED
+TEST_F(BatchServiceBackfillingTest, DISABLED_ConservativeBackfillingReservationsTest)
+#else
+TEST_F(BatchServiceBackfillingTest, ConservativeBackfillingReservationsTest)
+#endif
+{
+  DO_TEST_WITH_FORK(do_ConservativeBackfillingReservations_test);
+}
+
+void BatchServiceBackfillingTest::do_ConservativeBackfillingReservations_test() {
+  // Same jobs as in the EASY test: job #3 would delay job #2's reservation, and is not backfilled
+  do_Backfilling_test("conservative_bf",
+                      {std::make_tuple("3", "1", 50), std::make_tuple("2", "1", 50),
+                       std::make_tuple("2", "1", 50), std::make_tuple("1", "3", 50)},
+                      {50, 100, 100, 150});
+}
+
+void BatchServiceBackfillingTest::do_Backfilling_test(std::string scheduling_algorithm,
+                                                      std::vector<std::tuple<std::string, std::string, double>> job_specs,
+                                                      std::vector<double> expected_completion_times) {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("batch_service_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = "Host1";
+
+  // Create a Batch Service with a backfilling scheduling algorithm
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::BatchService(hostname, {"Host1", "Host2", "Host3", "Host4"}, 0,
+                                   {{wrench::BatchServiceProperty::BATCH_SCHEDULING_ALGORITHM, scheduling_algorithm}})));
+
+  simulation->add(new wrench::FileRegistryService(hostname));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new BackfillingTestWMS(
+                  this, job_specs, expected_completion_times, {compute_service}, hostname)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+
+/**********************************************************************/
+/**  BACKFILLING START TIME ESTIMATES TEST                           **/
+/**********************************************************************/
+
+class BackfillingStartTimeEstimatesTestWMS : public wrench::WMS {
+
+public:
+    BackfillingStartTimeEstimatesTestWMS(BatchServiceBackfillingTest *test,
+                                         const std::set<wrench::ComputeService *> &compute_services,
+                                         std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr, hostname,
+                        "test") {
+      this->test = test;
+    }
+
+private:
+
+    BatchServiceBackfillingTest *test;
+
+    int main() {
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // Same jobs as in the conservative backfilling reservations test: job #0 runs on 3 nodes
+      // until date 60 (walltime), jobs #1 and #2 have reservations on 2 nodes each
+      // for [60, 120], and job #3 has a reservation on 1 node for [120, 300]
+      std::string num_nodes[4] = {"3", "2", "2", "1"};
+      std::string walltimes[4] = {"1", "1", "1", "3"};
+      for (int i=0; i < 4; i++) {
+        wrench::WorkflowTask *task = this->getWorkflow()->addTask("task" + std::to_string(i), 50, 1, 1, 1.0, 0);
+        wrench::StandardJob *job = job_manager->createStandardJob(task, {});
+        std::map<std::string, std::string> job_args = {{"-N", num_nodes[i]}, {"-t", walltimes[i]}, {"-c", "10"}};
+        try {
+          job_manager->submitJob(job, this->test->compute_service, job_args);
+        } catch (wrench::WorkflowExecutionException &e) {
+          throw std::runtime_error("Unexpected exception while submitting job");
+        }
+      }
+
+      // Sleep for 10 seconds
+      wrench::Simulation::sleep(10);
+
+      // Get Predictions
+      std::set<std::tuple<std::string,unsigned int,unsigned int, double>> set_of_jobs = {
+              (std::tuple<std::string,unsigned int,unsigned int, double>){"job1", 1, 10, 30},
+              (std::tuple<std::string,unsigned int,unsigned int, double>){"job2", 1, 10, 60},
+              (std::tuple<std::string,unsigned int,unsigned int, double>){"job3", 2, 10, 60},
+              (std::tuple<std::string,unsigned int,unsigned int, double>){"job4", 4, 10, 10},
+              (std::tuple<std::string,unsigned int,unsigned int, double>){"job5", 5, 10, 10},
+              (std::tuple<std::string,unsigned int,unsigned int, double>){"job6", 1, 11, 10},
+      };
+
+      // Expectations
+      std::map<std::string, double> expectations;
+      expectations.insert(std::make_pair("job1", 10));
+      expectations.insert(std::make_pair("job2", 120));
+      expectations.insert(std::make_pair("job3", 120));
+      expectations.insert(std::make_pair("job4", 300));
+      expectations.insert(std::make_pair("job5", -1));
+      expectations.insert(std::make_pair("job6", -1));
+
+      std::map<std::string,double> jobs_estimated_start_times =
+              ((wrench::BatchService *)this->test->compute_service)->getStartTimeEstimates(set_of_jobs);
+
+      for (auto job : set_of_jobs) {
+        std::string id = std::get<0>(job);
+        double estimated = jobs_estimated_start_times[id];
+        double expected = expectations[id];
+        if (fabs(estimated - expected) > EPSILON) {
+          throw std::runtime_error("invalid prediction for job '" + id + "': got " +
+                                   std::to_string(estimated) + " but expected is " + std::to_string(expected));
+        }
+      }
+
+      return 0;
+    }
+};
+
+#ifdef ENABLE_BATSCHED
+TEST_F(BatchServiceBackfillingTest, DISABLED_BackfillingStartTimeEstimatesTest)
+#else
+TEST_F(BatchServiceBackfillingTest, BackfillingStartTimeEstimatesTest)
+#endif
+{
+  DO_TEST_WITH_FORK(do_BackfillingStartTimeEstimates_test);
+}
+
+void BatchServiceBackfillingTest::do_BackfillingStartTimeEstimates_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("batch_service_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = "Host1";
+
+  // Create a Batch Service with a conservative backfilling scheduling algorithm
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::BatchService(hostname, {"Host1", "Host2", "Host3", "Host4"}, 0,
+                                   {{wrench::BatchServiceProperty::BATCH_SCHEDULING_ALGORITHM, "conservative_bf"}})));
+
+  simulation->add(new wrench::FileRegistryService(hostname));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new BackfillingStartTimeEstimatesTestWMS(
+                  this, {compute_service}, hostname)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
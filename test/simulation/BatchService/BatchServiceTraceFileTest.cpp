@@ -35,6 +35,8 @@ public:
 
     void do_WorkloadTraceFileTest_test();
 
+    void do_WorkloadTraceFileRunTimeTest_test();
+
 protected:
     BatchServiceTest() {
 
@@ -473,3 +475,116 @@ void BatchServiceTest::do_WorkloadTraceFileTest_test() {
   free(argv);
 }
 
+
+
+/**********************************************************************/
+/**  WORKLOAD TRACE FILE RUN TIME TEST                               **/
+/**********************************************************************/
+
+class WorkloadTraceFileRunTimeTestWMS : public wrench::WMS {
+
+public:
+    WorkloadTraceFileRunTimeTestWMS(BatchServiceTest *test,
+                                    const std::set<wrench::ComputeService *> &compute_services,
+                                    const std::set<wrench::StorageService *> &storage_services,
+                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr,
+                        hostname, "test") {
+      this->test = test;
+    }
+
+
+private:
+
+    BatchServiceTest *test;
+
+    int main() {
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      wrench::Simulation::sleep(10);
+      // At this point, both trace jobs are ahead of ours in the queue: the first one holds the whole
+      // machine for its run time (1000 seconds), the second one for its walltime (11 minutes), which
+      // is shorter than its run time
+
+      // Create and submit a 10-second job that needs the whole machine
+      std::vector<wrench::WorkflowTask *> tasks;
+      for (size_t i = 0; i < 4; i++) {
+        tasks.push_back(this->getWorkflow()->addTask("test_job_task_" + std::to_string(i),
+                                                     10 * 10, 10, 10, 1.0, 0.0));
+      }
+      wrench::StandardJob *standard_job = job_manager->createStandardJob(tasks, {});
+
+      std::map<std::string, std::string> batch_job_args;
+      batch_job_args["-N"] = std::to_string(4); // Number of nodes/tasks
+      batch_job_args["-t"] = std::to_string(60); // Time in minutes (at least 1 minute)
+      batch_job_args["-c"] = std::to_string(10); //number of cores per task
+
+      job_manager->submitJob(standard_job, *(this->getAvailableComputeServices().begin()), batch_job_args);
+
+      // Wait for the workflow execution event
+      std::unique_ptr<wrench::WorkflowExecutionEvent> event = this->getWorkflow()->waitForNextExecutionEvent();
+      if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+        throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+      }
+
+      double completion_time = this->simulation->getCurrentSimulatedDate();
+      double expected_completion_time = 1000 + 11 * 60 + 10;
+      double delta = fabs(expected_completion_time - completion_time);
+      double tolerance = 1;
+      if (delta > tolerance) {
+        throw std::runtime_error("Unexpected job completion time: " + std::to_string(completion_time) +
+                                 " (expected: " + std::to_string(expected_completion_time) + ")");
+      }
+      return 0;
+    }
+};
+
+TEST_F(BatchServiceTest, WorkloadTraceFileRunTimeTest) {
+  DO_TEST_WITH_FORK(do_WorkloadTraceFileRunTimeTest_test);
+}
+
+
+void BatchServiceTest::do_WorkloadTraceFileRunTimeTest_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("batch_service_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = "Host1";
+
+  // Create a trace file with two jobs that take the whole machine
+  std::string trace_file_path = "/tmp/swf_trace";
+  FILE *trace_file = fopen(trace_file_path.c_str(), "w");
+  fprintf(trace_file, "1 0 -1 1000 -1 -1 -1 4 3600 -1\n");   // job that completes before its walltime
+  fprintf(trace_file, "2 1 -1 100000 -1 -1 -1 4 600 -1\n");  // job that reaches its walltime
+  fclose(trace_file);
+
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::BatchService(hostname,
+                                   {"Host1", "Host2", "Host3", "Host4"}, 0,
+                                   {{wrench::BatchServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path}}
+          )));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(new WorkloadTraceFileRunTimeTestWMS(
+          this, {compute_service}, {}, hostname)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
@@ -20,6 +20,7 @@ public:
     wrench::StorageService *storage_service1 = nullptr;
     wrench::StorageService *storage_service2 = nullptr;
     wrench::StorageService *storage_service3 = nullptr;
+    wrench::StorageService *storage_service4 = nullptr;
     wrench::ComputeService *compute_service = nullptr;
 
     void do_FileRegistry_Test();
@@ -293,7 +294,7 @@ private:
 
       std::vector<std::string> file1_expected_locations = {"Host4", "Host1", "Host2"};
       std::vector<std::string> file1_locations(3);
-      std::map<double, wrench::StorageService *> file1_locations_by_proximity;
+      std::multimap<double, wrench::StorageService *> file1_locations_by_proximity;
 
       bool success = true;
       try {
@@ -332,6 +333,23 @@ private:
                 "lookupEntry using NetworkProximityService did not include the unmonitored Storage Service");
       }
 
+      // Two storage services at the same distance
+      wrench::WorkflowFile *file2 = this->getWorkflow()->addFile("file2", 100.0);
+      frs->addEntry(file2, this->test->storage_service2);
+      frs->addEntry(file2, this->test->storage_service4);
+
+      std::multimap<double, wrench::StorageService *> file2_locations_by_proximity;
+      try {
+        file2_locations_by_proximity = frs->lookupEntry(file2, "Host3", nps);
+      } catch (std::exception &e) {
+        throw std::runtime_error("Should be able to lookup a file");
+      }
+
+      if ((file2_locations_by_proximity.size() != 2) or (file2_locations_by_proximity.count(DBL_MAX) != 2)) {
+        throw std::runtime_error(
+                "lookupEntry using NetworkProximityService did not return all Storage Services at the same distance");
+      }
+
       return 0;
     }
 };
@@ -370,6 +388,9 @@ void FileRegistryTest::do_lookupEntry_Test() {
   storage_service3 = simulation->add(
           new wrench::SimpleStorageService(host4, 10000000000000.0));
 
+  storage_service4 = simulation->add(
+          new wrench::SimpleStorageService(host2, 10000000000000.0));
+
 
   wrench::FileRegistryService *file_registry_service(
           new wrench::FileRegistryService(host1));
@@ -380,7 +401,7 @@ void FileRegistryTest::do_lookupEntry_Test() {
   wms = simulation->add(
           new FileRegistryLookupEntryTestWMS(
                   this,
-                  {}, {storage_service1, storage_service2, storage_service3}, {network_proximity_service}, file_registry_service, host1));
+                  {}, {storage_service1, storage_service2, storage_service3, storage_service4}, {network_proximity_service}, file_registry_service, host1));
 
   wms->addWorkflow(workflow);
 
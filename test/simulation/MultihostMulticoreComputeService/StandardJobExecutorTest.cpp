@@ -8,6 +8,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <random>
 #include <wrench-dev.h>
 
@@ -25,6 +26,7 @@ class StandardJobExecutorTest : public ::testing::Test {
 public:
     wrench::StorageService *storage_service1 = nullptr;
     wrench::StorageService *storage_service2 = nullptr;
+    wrench::StorageService *storage_service3 = nullptr;
     wrench::Simulation *simulation;
 
 
@@ -50,6 +52,10 @@ public:
 
     void do_JobTerminationTestAtRandomTimes_test();
 
+    void do_ConcurrentInputFileReadsTest_test();
+
+    void do_PreFileCopyChainTest_test();
+
     void do_DEBUG_test();
 
     static bool isJustABitGreater(double base, double variable) {
@@ -89,6 +95,29 @@ protected:
     std::string platform_file_path = "/tmp/platform.xml";
     std::unique_ptr<wrench::Workflow> workflow;
 
+    // Create a three-host platform in which each pair of hosts has its own 1MBps link,
+    // so that transfers between different pairs of hosts do not share bandwidth
+    void createThreeHostPlatformFile() {
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"10\"/> "
+              "       <host id=\"Host2\" speed=\"1f\" core=\"10\"/> "
+              "       <host id=\"Host3\" speed=\"1f\" core=\"10\"/> "
+              "       <link id=\"12\" bandwidth=\"1MBps\" latency=\"0us\"/>"
+              "       <link id=\"13\" bandwidth=\"1MBps\" latency=\"0us\"/>"
+              "       <link id=\"23\" bandwidth=\"1MBps\" latency=\"0us\"/>"
+              "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"12\"/> </route>"
+              "       <route src=\"Host1\" dst=\"Host3\"> <link_ctn id=\"13\"/> </route>"
+              "       <route src=\"Host2\" dst=\"Host3\"> <link_ctn id=\"23\"/> </route>"
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
 };
 
 
@@ -1383,7 +1412,7 @@ private:
 
         double before = wrench::S4U_Simulation::getClock();
 
-        // Create a StandardJobExecutor that will run stuff on one host and 6 core
+        // Create a StandardJobExecutor that will run stuff on one host and 10 cores
         std::shared_ptr<wrench::StandardJobExecutor> executor = std::unique_ptr<wrench::StandardJobExecutor>(
                 new wrench::StandardJobExecutor(
                         test->simulation,
@@ -1451,7 +1480,7 @@ private:
 
         double before = wrench::S4U_Simulation::getClock();
 
-        // Create a StandardJobExecutor that will run stuff on one host and 6 core
+        // Create a StandardJobExecutor that will run stuff on one host and 10 cores
         double thread_startup_overhead = 14;
         std::shared_ptr<wrench::StandardJobExecutor> executor = std::unique_ptr<wrench::StandardJobExecutor>(
                 new wrench::StandardJobExecutor(
@@ -1503,6 +1532,77 @@ private:
         this->test->storage_service1->deleteFile(this->getWorkflow()->getFileByID("output_file"));
       }
 
+      /** Case 4: Same as case 3, but without simulating one compute thread per core **/
+      {
+        wrench::WorkflowTask *task = this->getWorkflow()->addTask("task1", 3600, 1, 10, 0.5, 0);
+        task->addInputFile(this->getWorkflow()->getFileByID("input_file"));
+        task->addOutputFile(this->getWorkflow()->getFileByID("output_file"));
+
+        // Create a StandardJob
+        wrench::StandardJob *job = job_manager->createStandardJob(
+                task,
+                {
+                        {*(task->getInputFiles().begin()),  this->test->storage_service1},
+                        {*(task->getOutputFiles().begin()), this->test->storage_service1}
+                });
+
+        std::string my_mailbox = "test_callback_mailbox";
+
+        double before = wrench::S4U_Simulation::getClock();
+
+        // Create a StandardJobExecutor that will run stuff on one host and 10 cores
+        double thread_startup_overhead = 14;
+        std::shared_ptr<wrench::StandardJobExecutor> executor = std::unique_ptr<wrench::StandardJobExecutor>(
+                new wrench::StandardJobExecutor(
+                        test->simulation,
+                        my_mailbox,
+                        test->simulation->getHostnameList()[1],
+                        job,
+                        {std::make_tuple(test->simulation->getHostnameList()[1], 10, wrench::ComputeService::ALL_RAM)},
+                        nullptr,
+                        false,
+                        nullptr,
+                        {{wrench::StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD, std::to_string(
+                                thread_startup_overhead)},
+                         {wrench::StandardJobExecutorProperty::SIMULATE_COMPUTE_THREADS, "false"}}, {}
+                ));
+        executor->start(executor, true);
+
+        // Wait for a message on my mailbox_name
+        std::unique_ptr<wrench::SimulationMessage> message;
+        try {
+          message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+          std::string error_msg = cause->toString();
+          throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+        }
+
+        // Did we get the expected message?
+        auto *msg = dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get());
+        if (!msg) {
+          throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+        }
+
+        double after = wrench::S4U_Simulation::getClock();
+
+        double observed_duration = after - before;
+
+        double expected_duration =
+                10 * thread_startup_overhead + task->getFlops() / (10 * task->getParallelEfficiency());
+
+        // Does the task completion time make sense?
+        if (!StandardJobExecutorTest::isJustABitGreater(expected_duration, observed_duration)) {
+          throw std::runtime_error(
+                  "Case 4: Unexpected job duration (should be around " + std::to_string(expected_duration) +
+                  " but is " +
+                  std::to_string(observed_duration) + ")");
+        }
+
+        this->getWorkflow()->removeTask(task);
+
+        this->test->storage_service1->deleteFile(this->getWorkflow()->getFileByID("output_file"));
+      }
+
       return 0;
     }
 };
@@ -2683,3 +2783,300 @@ void StandardJobExecutorTest::do_JobTerminationTestAtRandomTimes_test() {
   free(argv);
 }
 
+
+
+/**********************************************************************/
+/**  CONCURRENT INPUT FILE READS TEST                                **/
+/**********************************************************************/
+
+class ConcurrentInputFileReadsTestWMS : public wrench::WMS {
+
+public:
+    ConcurrentInputFileReadsTestWMS(StandardJobExecutorTest *test,
+                                    const std::set<wrench::ComputeService *> &compute_services,
+                                    const std::set<wrench::StorageService *> &storage_services,
+                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+
+private:
+
+    StandardJobExecutorTest *test;
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      {
+        // Create a task with two input files, which are on storage services on different hosts
+        wrench::WorkflowTask *task = this->getWorkflow()->addTask("task", 1, 1, 1, 1.0, 0);
+        task->addInputFile(this->getWorkflow()->getFileByID("input_file_1"));
+        task->addInputFile(this->getWorkflow()->getFileByID("input_file_2"));
+
+        wrench::StandardJob *job = job_manager->createStandardJob(
+                {task},
+                {
+                        {this->getWorkflow()->getFileByID("input_file_1"), this->test->storage_service2},
+                        {this->getWorkflow()->getFileByID("input_file_2"), this->test->storage_service3}
+                },
+                {}, {}, {});
+
+        std::string my_mailbox = "test_callback_mailbox";
+
+        double before = wrench::S4U_Simulation::getClock();
+
+        // Create a StandardJobExecutor that will run the task on Host1
+        std::shared_ptr<wrench::StandardJobExecutor> executor = std::shared_ptr<wrench::StandardJobExecutor>(
+                new wrench::StandardJobExecutor(
+                        test->simulation,
+                        my_mailbox,
+                        "Host1",
+                        job,
+                        {std::make_tuple("Host1", 1, wrench::ComputeService::ALL_RAM)},
+                        nullptr,
+                        false,
+                        nullptr,
+                        {{wrench::StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD, "0"}}, {}
+                ));
+        executor->start(executor, true);
+
+        // Wait for a message on my mailbox_name
+        std::unique_ptr<wrench::SimulationMessage> message;
+        try {
+          message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+          throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+        }
+
+        // Did we get the expected message?
+        auto msg = dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get());
+        if (!msg) {
+          throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+        }
+
+        // Each 10MB file takes a bit more than 10 seconds to go through its own 1MBps link: the
+        // task should start once both reads, which proceed concurrently, have completed (i.e., after
+        // the longest read, and not after the sum of the two reads)
+        double staging_time = task->getStartDate() - before;
+        if ((staging_time < 10.0) or (staging_time > 15.0)) {
+          throw std::runtime_error("Unexpected input file staging time (should be a bit more than 10 seconds but is " +
+                                   std::to_string(staging_time) + ")");
+        }
+
+        this->getWorkflow()->removeTask(task);
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(StandardJobExecutorTest, ConcurrentInputFileReadsTest) {
+  DO_TEST_WITH_FORK(do_ConcurrentInputFileReadsTest_test);
+}
+
+void StandardJobExecutorTest::do_ConcurrentInputFileReadsTest_test() {
+
+  // Create and initialize a simulation
+  simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("concurrent_reads_test");
+
+  simulation->init(&argc, argv);
+
+  // Setting up the platform
+  createThreeHostPlatformFile();
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Create a Compute Service (we don't use it)
+  wrench::ComputeService *compute_service = nullptr;
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService("Host1",
+                                                       {std::make_tuple("Host1", wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM)},
+                                                       {})));
+
+  // Create two Storage Services on different hosts
+  ASSERT_NO_THROW(storage_service2 = simulation->add(
+          new wrench::SimpleStorageService("Host2", 10000000000000.0)));
+  ASSERT_NO_THROW(storage_service3 = simulation->add(
+          new wrench::SimpleStorageService("Host3", 10000000000000.0)));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new ConcurrentInputFileReadsTestWMS(
+                  this,  {compute_service}, {storage_service2, storage_service3}, "Host1")));
+
+  ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  // Create two workflow files, and stage them on different storage services
+  wrench::WorkflowFile *input_file_1 = this->workflow->addFile("input_file_1", 10000000.0);
+  wrench::WorkflowFile *input_file_2 = this->workflow->addFile("input_file_2", 10000000.0);
+  ASSERT_NO_THROW(simulation->stageFile(input_file_1, storage_service2));
+  ASSERT_NO_THROW(simulation->stageFile(input_file_2, storage_service3));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+
+/**********************************************************************/
+/**  PRE FILE COPY CHAIN TEST                                        **/
+/**********************************************************************/
+
+class PreFileCopyChainTestWMS : public wrench::WMS {
+
+public:
+    PreFileCopyChainTestWMS(StandardJobExecutorTest *test,
+                            const std::set<wrench::ComputeService *> &compute_services,
+                            const std::set<wrench::StorageService *> &storage_services,
+                            std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+
+private:
+
+    StandardJobExecutorTest *test;
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      {
+        wrench::WorkflowFile *file = this->getWorkflow()->getFileByID("input_file");
+
+        // storage_service1 < storage_service2 < storage_service3 (see below), so that the pre file copies
+        // are performed in the order A->B, B->C
+        wrench::WorkflowTask *task = this->getWorkflow()->addTask("task", 1, 1, 1, 1.0, 0);
+        wrench::StandardJob *job = job_manager->createStandardJob(
+                {task},
+                {},
+                {
+                        std::make_tuple(file, this->test->storage_service1, this->test->storage_service2),
+                        std::make_tuple(file, this->test->storage_service2, this->test->storage_service3)
+                },
+                {}, {});
+
+        std::string my_mailbox = "test_callback_mailbox";
+
+        double before = wrench::S4U_Simulation::getClock();
+
+        // Create a StandardJobExecutor that will run the task on Host1
+        std::shared_ptr<wrench::StandardJobExecutor> executor = std::shared_ptr<wrench::StandardJobExecutor>(
+                new wrench::StandardJobExecutor(
+                        test->simulation,
+                        my_mailbox,
+                        "Host1",
+                        job,
+                        {std::make_tuple("Host1", 1, wrench::ComputeService::ALL_RAM)},
+                        nullptr,
+                        false,
+                        nullptr,
+                        {{wrench::StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD, "0"}}, {}
+                ));
+        executor->start(executor, true);
+
+        // Wait for a message on my mailbox_name
+        std::unique_ptr<wrench::SimulationMessage> message;
+        try {
+          message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+          throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+        }
+
+        // Did we get the expected message? (if the second copy had not waited for the first one,
+        // it would have failed because the file was not on B yet)
+        auto msg = dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get());
+        if (!msg) {
+          throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+        }
+
+        if (not this->test->storage_service3->lookupFile(file, nullptr)) {
+          throw std::runtime_error("The file has not been copied to the last storage service of the chain");
+        }
+
+        // Each copy takes a bit more than 10 seconds: the second one can only start once the first one is done
+        double copy_time = task->getStartDate() - before;
+        if ((copy_time < 20.0) or (copy_time > 25.0)) {
+          throw std::runtime_error("Unexpected file copy time (should be a bit more than 20 seconds but is " +
+                                   std::to_string(copy_time) + ")");
+        }
+
+        this->getWorkflow()->removeTask(task);
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(StandardJobExecutorTest, PreFileCopyChainTest) {
+  DO_TEST_WITH_FORK(do_PreFileCopyChainTest_test);
+}
+
+void StandardJobExecutorTest::do_PreFileCopyChainTest_test() {
+
+  // Create and initialize a simulation
+  simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("copy_chain_test");
+
+  simulation->init(&argc, argv);
+
+  // Setting up the platform
+  createThreeHostPlatformFile();
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Create a Compute Service (we don't use it)
+  wrench::ComputeService *compute_service = nullptr;
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService("Host1",
+                                                       {std::make_tuple("Host1", wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM)},
+                                                       {})));
+
+  // Create three Storage Services, one per host
+  std::vector<wrench::StorageService *> storage_services;
+  for (auto const &host : {"Host1", "Host2", "Host3"}) {
+    wrench::StorageService *storage_service = nullptr;
+    ASSERT_NO_THROW(storage_service = simulation->add(
+            new wrench::SimpleStorageService(host, 10000000000000.0)));
+    storage_services.push_back(storage_service);
+  }
+
+  // A job's pre file copies are ordered by (file, source, destination) pointers, so sort the storage
+  // services to get the A->B, B->C order (every pair of hosts has its own link, so which host is
+  // which does not matter)
+  std::sort(storage_services.begin(), storage_services.end());
+  storage_service1 = storage_services[0];
+  storage_service2 = storage_services[1];
+  storage_service3 = storage_services[2];
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new PreFileCopyChainTestWMS(
+                  this,  {compute_service}, {storage_service1, storage_service2, storage_service3}, "Host1")));
+
+  ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  // Create a workflow file, and stage it on the first storage service of the chain
+  wrench::WorkflowFile *input_file = this->workflow->addFile("input_file", 10000000.0);
+  ASSERT_NO_THROW(simulation->stageFile(input_file, storage_service1));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
@@ -29,6 +29,8 @@ public:
 
     void do_VivaldiConverge_Test();
 
+    void do_AllToAllCoverage_Test();
+
     void do_ValidateProperties_Test();
 
 protected:
@@ -482,6 +484,25 @@ private:
       if (coordinates.first == 0 && coordinates.second == 0) {
         throw std::runtime_error("Vivaldi algorithm did not update the coordinates of host:" + target_host);
       }
+
+      // All pairwise estimates at once (a snapshot of distances, in which every host is at
+      // distance 0 from itself, and the distance between two hosts is the same both ways)
+      const std::vector<std::string> &hosts = vivaldi_service->getHostnameList();
+      unsigned long num_hosts = hosts.size();
+      std::vector<double> all_proximities = vivaldi_service->queryAll();
+      if (all_proximities.size() != num_hosts * num_hosts) {
+        throw std::runtime_error("Unexpected number of proximity values: " + std::to_string(all_proximities.size()));
+      }
+      for (unsigned long i = 0; i < num_hosts; i++) {
+        if (all_proximities[i * num_hosts + i] != 0.0) {
+          throw std::runtime_error("Non-zero proximity value between " + hosts[i] + " and itself");
+        }
+        for (unsigned long j = 0; j < num_hosts; j++) {
+          if (all_proximities[i * num_hosts + j] != all_proximities[j * num_hosts + i]) {
+            throw std::runtime_error("Asymmetric proximity values between " + hosts[i] + " and " + hosts[j]);
+          }
+        }
+      }
       return 0;
     }
 };
@@ -569,6 +590,97 @@ void NetworkProximityTest::do_VivaldiConverge_Test() {
   free(argv);
 }
 
+/**********************************************************************/
+/**  ALLTOALL COVERAGE TEST                                          **/
+/**********************************************************************/
+
+class AllToAllCoverageWMS : public wrench::WMS {
+public:
+    AllToAllCoverageWMS(NetworkProximityTest *test,
+                        std::set<wrench::NetworkProximityService *> network_proximity_services,
+                        std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, network_proximity_services, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+    NetworkProximityTest *test;
+
+    int main() {
+      wrench::NetworkProximityService *network_proximity_service =
+              *(this->getAvailableNetworkProximityServices().begin());
+
+      // The k-th measurement of each daemon happens between k * (100 - 10) and k * (100 + 10) seconds,
+      // so at this date each daemon has done exactly N-1 measurements
+      const std::vector<std::string> &hosts = network_proximity_service->getHostnameList();
+      unsigned long num_hosts = hosts.size();
+      wrench::Simulation::sleep((num_hosts - 1) * (100 + 10) + 5);
+
+      // Each daemon should have measured its proximity to every other daemon
+      std::vector<double> proximities = network_proximity_service->queryAll();
+      for (unsigned long i = 0; i < num_hosts; i++) {
+        for (unsigned long j = 0; j < num_hosts; j++) {
+          if ((i != j) and (proximities[i * num_hosts + j] == wrench::NetworkProximityService::NOT_AVAILABLE)) {
+            throw std::runtime_error("Got a NOT_AVAILABLE proximity value between " + hosts[i] + " and " + hosts[j] +
+                                     " after " + std::to_string(num_hosts - 1) + " measurement periods");
+          }
+        }
+      }
+      return 0;
+    }
+};
+
+TEST_F(NetworkProximityTest, AllToAllCoverageTest) {
+  DO_TEST_WITH_FORK(do_AllToAllCoverage_Test);
+}
+
+void NetworkProximityTest::do_AllToAllCoverage_Test() {
+  // Create and initialize a simulation
+  wrench::Simulation *simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("one_task_test");
+
+  simulation->init(&argc, argv);
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = simulation->getHostnameList()[0];
+
+  // Get a host for network proximity host
+  std::string network_proximity_db_hostname = simulation->getHostnameList()[1];
+
+  std::vector<std::string> hosts_in_network = simulation->getHostnameList();
+
+  wrench::NetworkProximityService *network_proximity_service = nullptr;
+  ASSERT_NO_THROW(network_proximity_service =
+                          new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                              {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "ALLTOALL"},
+                                                               {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD, "100"},
+                                                               {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD_MAX_NOISE, "10"}}));
+
+  ASSERT_NO_THROW(simulation->add(network_proximity_service));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new AllToAllCoverageWMS(
+                  this,
+                  (std::set<wrench::NetworkProximityService *>){network_proximity_service},
+                  hostname)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
 /**********************************************************************/
 /**  VALIDATE PROPERTIES TEST                                        **/
 /**********************************************************************/
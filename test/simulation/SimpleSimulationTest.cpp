@@ -279,6 +279,12 @@ void SimpleSimulationTest::do_getReadyTasksTest_test() {
   // Try to get a non-double double property (property value is "infinity", which is not a number)
   ASSERT_THROW(storage_service->getPropertyValueAsDouble(wrench::SimpleStorageServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD),
                std::invalid_argument);
+  // Try to get a non-boolean boolean property, and the property as the string it was set to
+  ASSERT_THROW(storage_service->getPropertyValueAsBoolean(wrench::SimpleStorageServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD),
+               std::invalid_argument);
+  ASSERT_EQ("BOGUS", storage_service->getPropertyValueAsString(wrench::SimpleStorageServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD));
+  // Message payloads are parsed when the service is created
+  ASSERT_EQ(1024, storage_service->getMessagePayloadValueAsDouble(wrench::SimpleStorageServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD));
 
   // Create a Cloud Service
   std::vector<std::string> execution_hosts = {simulation->getHostnameList()[1]};
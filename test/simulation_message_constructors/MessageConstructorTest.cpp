@@ -240,6 +240,14 @@ TEST_F(MessageConstructorTest, StorageServiceMessages) {
   ASSERT_THROW(new wrench::StorageServiceFileDeleteAnswerMessage(file, storage_service, true, failure_cause, 666),
                std::invalid_argument);
 
+  ASSERT_NO_THROW(new wrench::StorageServicePartitionDeleteRequestMessage("mailbox", "/job", 666));
+  ASSERT_THROW(new wrench::StorageServicePartitionDeleteRequestMessage("", "/job", 666), std::invalid_argument);
+  ASSERT_THROW(new wrench::StorageServicePartitionDeleteRequestMessage("mailbox", "", 666), std::invalid_argument);
+
+  ASSERT_NO_THROW(new wrench::StorageServicePartitionDeleteAnswerMessage("/job", storage_service, 2, 666));
+  ASSERT_THROW(new wrench::StorageServicePartitionDeleteAnswerMessage("", storage_service, 2, 666), std::invalid_argument);
+  ASSERT_THROW(new wrench::StorageServicePartitionDeleteAnswerMessage("/job", nullptr, 2, 666), std::invalid_argument);
+
   ASSERT_NO_THROW(new wrench::StorageServiceFileCopyRequestMessage("mailbox", file, storage_service, root_dir, root_dir, nullptr, 666));
   ASSERT_THROW(new wrench::StorageServiceFileCopyRequestMessage("", file, storage_service, root_dir, root_dir, nullptr, 666), std::invalid_argument);
   ASSERT_THROW(new wrench::StorageServiceFileCopyRequestMessage("mailbox", nullptr, storage_service, root_dir, root_dir, nullptr, 666), std::invalid_argument);
@@ -292,6 +300,18 @@ TEST_F(MessageConstructorTest, NetworkProximityMessages) {
   ASSERT_THROW(new wrench::NetworkProximityLookupAnswerMessage(std::make_pair("","b"), 1.0, 666), std::invalid_argument);
   ASSERT_THROW(new wrench::NetworkProximityLookupAnswerMessage(std::make_pair("a",""), 1.0, 666), std::invalid_argument);
 
+  ASSERT_NO_THROW(new wrench::NetworkProximityBulkLookupRequestMessage("mailbox", "a", {"b", "c"}, 666));
+  ASSERT_THROW(new wrench::NetworkProximityBulkLookupRequestMessage("", "a", {"b", "c"}, 666), std::invalid_argument);
+  ASSERT_THROW(new wrench::NetworkProximityBulkLookupRequestMessage("mailbox", "", {"b", "c"}, 666), std::invalid_argument);
+
+  ASSERT_NO_THROW(new wrench::NetworkProximityBulkLookupAnswerMessage("a", {1.0, 2.0}, 666));
+  ASSERT_THROW(new wrench::NetworkProximityBulkLookupAnswerMessage("", {1.0, 2.0}, 666), std::invalid_argument);
+
+  ASSERT_NO_THROW(new wrench::NetworkProximityAllLookupRequestMessage("mailbox", 666));
+  ASSERT_THROW(new wrench::NetworkProximityAllLookupRequestMessage("", 666), std::invalid_argument);
+
+  ASSERT_NO_THROW(new wrench::NetworkProximityAllLookupAnswerMessage({1.0, 2.0, 3.0, 4.0}, 666));
+
   ASSERT_NO_THROW(new wrench::NetworkProximityComputeAnswerMessage(std::make_pair("a","b"), 1.0, 666));
   ASSERT_THROW(new wrench::NetworkProximityComputeAnswerMessage(std::make_pair("","b"), 1.0, 666), std::invalid_argument);
   ASSERT_THROW(new wrench::NetworkProximityComputeAnswerMessage(std::make_pair("a",""), 1.0, 666), std::invalid_argument);
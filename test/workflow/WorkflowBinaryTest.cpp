@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+#include "wrench/workflow/Workflow.h"
+
+class WorkflowBinaryTest : public ::testing::Test {
+protected:
+    WorkflowBinaryTest() {
+      workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+
+      t1 = workflow->addTask("task1", 1.0, 1, 1, 1.0, 0.0);
+      t2 = workflow->addTask("task2", 2.0, 1, 4, 0.5, 1000.0, wrench::WorkflowTask::TaskType::AUXILIARY);
+      t3 = workflow->addTask("task3", 3.0, 2, 2, 1.0, 0.0, wrench::WorkflowTask::TaskType::TRANSFER);
+      t4 = workflow->addTask("task4", 4.0, 1, 1, 1.0, 0.0);
+      t5 = workflow->addTask("task5", 5.0, 1, 1, 1.0, 0.0);
+
+      f1 = workflow->addFile("file1", 10.0);
+      f2 = workflow->addFile("file2", 20.0);
+      f3 = workflow->addFile("file3", 30.0);
+
+      // t4 is added before its parents, so that the topological order differs from the creation order
+      workflow->addControlDependency(t5, t4);
+      t1->addOutputFile(f1);
+      t2->addInputFile(f1);
+      t3->addInputFile(f1);
+      t2->addOutputFile(f2);
+      t4->addInputFile(f2);
+      workflow->addControlDependency(t3, t4);
+      t3->addSrcDest(f3, "host1", "host2");
+
+      t2->setPriority(10);
+      t3->setPriority(-3);
+      t2->setClusterID("cluster");
+      t3->setClusterID("cluster");
+    }
+
+    // data members
+    std::unique_ptr<wrench::Workflow> workflow;
+    wrench::WorkflowTask *t1, *t2, *t3, *t4, *t5;
+    wrench::WorkflowFile *f1, *f2, *f3;
+    std::string binary_file_path = "/tmp/workflow.bin";
+};
+
+TEST_F(WorkflowBinaryTest, SaveAndLoad) {
+
+  ASSERT_NO_THROW(workflow->saveBinary(binary_file_path));
+
+  auto *loaded = new wrench::Workflow();
+  ASSERT_NO_THROW(loaded->loadBinary(binary_file_path));
+
+  ASSERT_EQ(loaded->getNumberOfTasks(), workflow->getNumberOfTasks());
+  ASSERT_EQ(loaded->getFiles().size(), workflow->getFiles().size());
+  ASSERT_EQ(loaded->getNumLevels(), workflow->getNumLevels());
+
+  for (auto task : workflow->getTasks()) {
+    wrench::WorkflowTask *loaded_task = loaded->getTaskByID(task->getID());
+    ASSERT_EQ(loaded_task->getFlops(), task->getFlops());
+    ASSERT_EQ(loaded_task->getMinNumCores(), task->getMinNumCores());
+    ASSERT_EQ(loaded_task->getMaxNumCores(), task->getMaxNumCores());
+    ASSERT_EQ(loaded_task->getParallelEfficiency(), task->getParallelEfficiency());
+    ASSERT_EQ(loaded_task->getMemoryRequirement(), task->getMemoryRequirement());
+    ASSERT_EQ(loaded_task->getTaskType(), task->getTaskType());
+    ASSERT_EQ(loaded_task->getPriority(), task->getPriority());
+    ASSERT_EQ(loaded_task->getClusterID(), task->getClusterID());
+    ASSERT_EQ(loaded_task->getState(), task->getState());
+    ASSERT_EQ(loaded_task->getInternalState(), task->getInternalState());
+    ASSERT_EQ(loaded_task->getTopLevel(), task->getTopLevel());
+    ASSERT_EQ(loaded_task->getInputFiles().size(), task->getInputFiles().size());
+    ASSERT_EQ(loaded_task->getOutputFiles().size(), task->getOutputFiles().size());
+
+    std::vector<wrench::WorkflowTask *> children = workflow->getTaskChildren(task);
+    std::vector<wrench::WorkflowTask *> loaded_children = loaded->getTaskChildren(loaded_task);
+    ASSERT_EQ(loaded_children.size(), children.size());
+    for (unsigned long i = 0; i < children.size(); i++) {
+      ASSERT_EQ(loaded_children[i]->getID(), children[i]->getID());
+    }
+    ASSERT_EQ(loaded->getTaskParents(loaded_task).size(), workflow->getTaskParents(task).size());
+  }
+
+  for (auto file : workflow->getFiles()) {
+    ASSERT_EQ(loaded->getFileByID(file->getID())->getSize(), file->getSize());
+  }
+  ASSERT_EQ(loaded->getFileByID("file1")->getOutputOf(), loaded->getTaskByID("task1"));
+  ASSERT_EQ(loaded->getInputFiles().size(), workflow->getInputFiles().size());
+
+  auto transfers = loaded->getTaskByID("task3")->getFileTransfers();
+  ASSERT_EQ(transfers.size(), 1);
+  ASSERT_EQ(transfers.begin()->first, loaded->getFileByID("file3"));
+  ASSERT_EQ(transfers.begin()->second.first, "host1");
+  ASSERT_EQ(transfers.begin()->second.second, "host2");
+
+  ASSERT_EQ(loaded->getReadyTasks().size(), workflow->getReadyTasks().size());
+  ASSERT_EQ(loaded->getReadyClusters().size(), workflow->getReadyClusters().size());
+
+  // The loaded workflow can be modified as usual
+  ASSERT_THROW(loaded->addControlDependency(loaded->getTaskByID("task4"), loaded->getTaskByID("task1")),
+               std::invalid_argument);
+  ASSERT_NO_THROW(loaded->addControlDependency(loaded->getTaskByID("task5"), loaded->getTaskByID("task3")));
+
+  // Loading it again into the same workflow fails (duplicate IDs), and leaves the workflow unchanged
+  ASSERT_THROW(loaded->loadBinary(binary_file_path), std::invalid_argument);
+  ASSERT_EQ(loaded->getNumberOfTasks(), workflow->getNumberOfTasks());
+  ASSERT_EQ(loaded->getFiles().size(), workflow->getFiles().size());
+
+  delete loaded;
+}
+
+TEST_F(WorkflowBinaryTest, LoadInvalidFiles) {
+
+  auto *loaded = new wrench::Workflow();
+
+  ASSERT_THROW(loaded->loadBinary("bogus"), std::invalid_argument);
+
+  // Not a binary workflow file
+  FILE *file = fopen(binary_file_path.c_str(), "w");
+  fprintf(file, "<adag></adag>\n");
+  fclose(file);
+  ASSERT_THROW(loaded->loadBinary(binary_file_path), std::invalid_argument);
+
+  // Truncated file
+  ASSERT_NO_THROW(workflow->saveBinary(binary_file_path));
+  FILE *binary_file = fopen(binary_file_path.c_str(), "r");
+  std::vector<char> content(4096);
+  content.resize(fread(content.data(), 1, content.size(), binary_file));
+  fclose(binary_file);
+  binary_file = fopen(binary_file_path.c_str(), "w");
+  fwrite(content.data(), 1, content.size() - 10, binary_file);
+  fclose(binary_file);
+  ASSERT_THROW(loaded->loadBinary(binary_file_path), std::invalid_argument);
+
+  // Invalid file index in the last record (the file transfer, which comes right before the string table),
+  // which must be detected before anything is added to the workflow
+  uint64_t string_table_size;
+  memcpy(&string_table_size, content.data() + 56, sizeof(uint64_t));
+  uint64_t bogus_file_index = 1000;
+  memcpy(content.data() + content.size() - string_table_size - 48 + 8, &bogus_file_index, sizeof(uint64_t));
+  binary_file = fopen(binary_file_path.c_str(), "w");
+  fwrite(content.data(), 1, content.size(), binary_file);
+  fclose(binary_file);
+  ASSERT_THROW(loaded->loadBinary(binary_file_path), std::invalid_argument);
+
+  ASSERT_EQ(loaded->getNumberOfTasks(), 0);
+  ASSERT_EQ(loaded->getFiles().size(), 0);
+
+  delete loaded;
+}
@@ -355,3 +355,55 @@ TEST_F(WorkflowLoadFromDAXTest, LoadValidDAX) {
 }
 
 
+
+TEST_F(WorkflowLoadFromDAXTest, LoadDAXWithForwardReferences) {
+
+  std::string xml =
+          "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+          "<adag name=\"forward\">"
+          "  <job id=\"ID2\" runtime=\"2\" numcores=\"4\">"
+          "    <uses file=\"f1\" link=\"input\" size=\"100\"/>"
+          "  </job>"
+          "  <child ref=\"ID3\">"
+          "    <parent ref=\"ID2\"/>"
+          "  </child>"
+          "  <child ref=\"ID2\">"
+          "    <parent ref=\"ID1\"/>"
+          "  </child>"
+          "  <job id=\"ID1\" runtime=\"1\">"
+          "    <uses file=\"f1\" link=\"output\" size=\"100\"/>"
+          "  </job>"
+          "  <job id=\"ID3\" runtime=\"3\"/>"
+          "</adag>";
+
+  std::string path = "/tmp/workflow_forward.dax";
+  FILE *dax_file = fopen(path.c_str(), "w");
+  fprintf(dax_file, "%s", xml.c_str());
+  fclose(dax_file);
+
+  auto *workflow = new wrench::Workflow();
+
+  ASSERT_NO_THROW(workflow->loadFromDAX(path, "1f"));
+  ASSERT_EQ(workflow->getNumberOfTasks(), 3);
+  ASSERT_EQ(workflow->getFiles().size(), 1);
+  ASSERT_EQ(workflow->getTaskByID("ID2")->getMaxNumCores(), 4);
+  ASSERT_EQ(workflow->getNumLevels(), 3);
+  ASSERT_EQ(workflow->getTaskByID("ID1")->getTopLevel(), 0);
+  ASSERT_EQ(workflow->getTaskByID("ID2")->getTopLevel(), 1);
+  ASSERT_EQ(workflow->getTaskByID("ID3")->getTopLevel(), 2);
+
+  // Malformed DAX files and references to unknown jobs
+  for (std::string invalid : {"<adag><job id=\"ID1\" runtime=\"1\"></adag>",
+                              "<adag><child ref=\"ID1\"/></adag>",
+                              "<adag><job id=\"ID1\"/><child ref=\"ID1\"><parent ref=\"ID0\"/></child></adag>",
+                              "<adag><job id=\"ID1\" numprocs=\"1\" num_cores=\"1\"/></adag>"}) {
+    dax_file = fopen(path.c_str(), "w");
+    fprintf(dax_file, "%s", invalid.c_str());
+    fclose(dax_file);
+    auto *other_workflow = new wrench::Workflow();
+    ASSERT_THROW(other_workflow->loadFromDAX(path, "1f"), std::invalid_argument);
+    delete other_workflow;
+  }
+
+  delete workflow;
+}
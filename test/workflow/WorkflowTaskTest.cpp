@@ -86,6 +86,38 @@ TEST_F(WorkflowTaskTest, GetSet) {
   ASSERT_EQ(t1->getFailureCount(), 1);
 }
 
+TEST_F(WorkflowTaskTest, IncompleteParents) {
+  wrench::WorkflowTask *t3 = workflow->addTask("task-03", 50, 1, 1, 1.0, 0);
+  workflow->addControlDependency(t3, t2);
+
+  ASSERT_EQ(t1->getNumberOfIncompleteParents(), 0);
+  ASSERT_EQ(t2->getNumberOfIncompleteParents(), 2);
+
+  t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_RUNNING);
+  t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+  ASSERT_EQ(t2->getNumberOfIncompleteParents(), 1);
+  t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+  ASSERT_EQ(t2->getNumberOfIncompleteParents(), 1);
+
+  // A completed task that is made to run again (e.g., after a job failure) is incomplete again
+  t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_READY);
+  ASSERT_EQ(t2->getNumberOfIncompleteParents(), 2);
+  t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+  t3->setInternalState(wrench::WorkflowTask::InternalState::TASK_FAILED);
+  ASSERT_EQ(t2->getNumberOfIncompleteParents(), 1);
+  t3->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+  ASSERT_EQ(t2->getNumberOfIncompleteParents(), 0);
+
+  // Dependencies on completed tasks are complete
+  wrench::WorkflowTask *t4 = workflow->addTask("task-04", 50, 1, 1, 1.0, 0);
+  workflow->addControlDependency(t1, t4);
+  ASSERT_EQ(t4->getNumberOfIncompleteParents(), 0);
+  workflow->addControlDependency(t2, t4);
+  ASSERT_EQ(t4->getNumberOfIncompleteParents(), 1);
+  workflow->removeTask(t2);
+  ASSERT_EQ(t4->getNumberOfIncompleteParents(), 0);
+}
+
 TEST_F(WorkflowTaskTest, InputOutputFile) {
   wrench::WorkflowFile *f1 = workflow->addFile("file-01", 10);
   wrench::WorkflowFile *f2 = workflow->addFile("file-02", 100);
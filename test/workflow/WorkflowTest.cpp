@@ -92,11 +92,145 @@ TEST_F(WorkflowTest, WorkflowStructure) {
   workflow->removeTask(t1);
 }
 
+TEST_F(WorkflowTest, RemoveTasks) {
+  // Removals interleaved with additions and listings
+  workflow->removeTask(t2);
+  std::vector<wrench::WorkflowTask *> expected_tasks = {t1, t3, t4};
+  ASSERT_EQ(expected_tasks, workflow->getTasks());
+
+  wrench::WorkflowTask *t5 = workflow->addTask("task-test-05", 1, 1, 1, 1.0, 0);
+  workflow->removeTask(t4);
+  workflow->removeTask(t5);
+  wrench::WorkflowTask *t6 = workflow->addTask("task-test-06", 1, 1, 1, 1.0, 0);
+  wrench::WorkflowTask *t0 = workflow->addTask("task-test-00", 1, 1, 1, 1.0, 0);
+  expected_tasks = {t0, t1, t3, t6};
+  ASSERT_EQ(expected_tasks, workflow->getTasks());
+  ASSERT_EQ(4, workflow->getNumberOfTasks());
+
+  workflow->removeTask(t1);
+  workflow->removeTask(t6);
+  expected_tasks = {t0, t3};
+  ASSERT_EQ(expected_tasks, workflow->getTasks());
+  ASSERT_EQ(t3, workflow->getTaskByID("task-test-03"));
+}
+
+TEST_F(WorkflowTest, AdjacencySpans) {
+  ASSERT_EQ(2, t1->getNumberOfChildren());
+  ASSERT_EQ(0, t1->getNumberOfParents());
+  ASSERT_EQ(2, t4->getNumberOfParents());
+
+  wrench::WorkflowTaskSpan children = workflow->getTaskChildrenSpan(t1);
+  std::vector<wrench::WorkflowTask *> children_vector = workflow->getTaskChildren(t1);
+  ASSERT_EQ(children_vector.size(), children.size());
+  for (unsigned long i = 0; i < children.size(); i++) {
+    ASSERT_EQ(children_vector[i], children[i]);
+  }
+  ASSERT_TRUE(workflow->getTaskChildrenSpan(t4).empty());
+  ASSERT_EQ(2, workflow->getTaskParentsSpan(t4).size());
+
+  // Spans reflect structure changes
+  wrench::WorkflowTask *t5 = workflow->addTask("task-test-05", 1, 1, 1, 1.0, 0);
+  ASSERT_TRUE(workflow->getTaskParentsSpan(t5).empty());
+  workflow->addControlDependency(t4, t5);
+  ASSERT_EQ(1, t4->getNumberOfChildren());
+  ASSERT_EQ(1, workflow->getTaskChildrenSpan(t4).size());
+  ASSERT_EQ(t5, *workflow->getTaskChildrenSpan(t4).begin());
+
+  workflow->removeTask(t4);
+  ASSERT_EQ(0, t2->getNumberOfChildren());
+  ASSERT_EQ(0, t5->getNumberOfParents());
+  ASSERT_TRUE(workflow->getTaskChildrenSpan(t2).empty());
+  ASSERT_TRUE(workflow->getTaskParentsSpan(t5).empty());
+
+  ASSERT_THROW(workflow->getTaskChildrenSpan(nullptr), std::invalid_argument);
+  ASSERT_THROW(workflow->getTaskParentsSpan(nullptr), std::invalid_argument);
+}
+
+TEST_F(WorkflowTest, AdjacencySpansDuringConstruction) {
+  wrench::Workflow *w = new wrench::Workflow();
+  wrench::WorkflowTask *root = w->addTask("root", 1, 1, 1, 1.0, 0);
+  std::vector<wrench::WorkflowTask *> tasks;
+
+  // Dependencies are queried as they are added (children come newest first, as in the DAG)
+  for (unsigned long i = 0; i < 100; i++) {
+    wrench::WorkflowTask *task = w->addTask("task-" + std::to_string(i), 1, 1, 1, 1.0, 0);
+    w->addControlDependency(root, task);
+    if (not tasks.empty()) {
+      w->addControlDependency(tasks.back(), task);
+    }
+    tasks.push_back(task);
+    ASSERT_EQ(i + 1, w->getTaskChildrenSpan(root).size());
+    ASSERT_EQ(task, w->getTaskChildrenSpan(root)[0]);
+    ASSERT_EQ(std::min<unsigned long>(i + 1, 2), w->getTaskParentsSpan(task).size());
+    ASSERT_EQ(root, w->getTaskParentsSpan(task)[i == 0 ? 0 : 1]);
+  }
+
+  // Removing tasks keeps the other neighbors in order
+  for (unsigned long i = 0; i < 100; i += 2) {
+    w->removeTask(tasks[i]);
+  }
+  std::vector<wrench::WorkflowTask *> expected_children;
+  for (long i = 99; i > 0; i -= 2) {
+    expected_children.push_back(tasks[i]);
+    ASSERT_EQ(1, w->getTaskParentsSpan(tasks[i]).size());
+    ASSERT_TRUE(w->getTaskChildrenSpan(tasks[i]).empty());
+  }
+  ASSERT_EQ(expected_children, w->getTaskChildren(root));
+
+  delete w;
+}
+
+TEST_F(WorkflowTest, TopLevels) {
+  ASSERT_EQ(3, workflow->getNumLevels());
+
+  // Adding a chain below t4, and then an edge that makes t3 deeper
+  wrench::WorkflowTask *t5 = workflow->addTask("task-test-05", 1, 1, 1, 1.0, 0);
+  wrench::WorkflowTask *t6 = workflow->addTask("task-test-06", 1, 1, 1, 1.0, 0);
+  ASSERT_EQ(0, t6->getTopLevel());
+  workflow->addControlDependency(t5, t6);
+  workflow->addControlDependency(t4, t5);
+  ASSERT_EQ(4, t6->getTopLevel());
+  ASSERT_EQ(5, workflow->getNumLevels());
+
+  workflow->addControlDependency(t2, t3);
+  ASSERT_EQ(2, t3->getTopLevel());
+  ASSERT_EQ(5, t6->getTopLevel());
+  ASSERT_EQ(6, workflow->getNumLevels());
+
+  // Removing tasks makes levels shrink
+  workflow->removeTask(t5);
+  ASSERT_EQ(0, t6->getTopLevel());
+  ASSERT_EQ(4, workflow->getNumLevels());
+}
+
 TEST_F(WorkflowTest, ControlDependency) {
   // testing null control dependencies
   ASSERT_THROW(workflow->addControlDependency(nullptr, nullptr), std::invalid_argument);
   ASSERT_THROW(workflow->addControlDependency(t1, nullptr), std::invalid_argument);
   ASSERT_THROW(workflow->addControlDependency(nullptr, t1), std::invalid_argument);
+
+  // testing redundant control dependencies (there is already a path)
+  workflow->addControlDependency(t1, t4);
+  ASSERT_EQ(2, workflow->getTaskParents(t4).size());
+
+  // testing cyclic control dependencies
+  ASSERT_THROW(workflow->addControlDependency(t1, t1), std::invalid_argument);
+  ASSERT_THROW(workflow->addControlDependency(t4, t1), std::invalid_argument);
+  ASSERT_EQ(0, workflow->getTaskParents(t1).size());
+
+  // testing control dependencies that go against the task creation order
+  wrench::WorkflowTask *t5 = workflow->addTask("task-test-05", 1, 1, 1, 1.0, 0);
+  wrench::WorkflowTask *t6 = workflow->addTask("task-test-06", 1, 1, 1, 1.0, 0);
+  wrench::WorkflowTask *t7 = workflow->addTask("task-test-07", 1, 1, 1, 1.0, 0);
+  workflow->addControlDependency(t7, t6);
+  workflow->addControlDependency(t6, t5);
+  workflow->addControlDependency(t5, t1);
+  ASSERT_EQ(5, t4->getTopLevel());
+  workflow->addControlDependency(t7, t5);
+  ASSERT_EQ(1, workflow->getTaskParents(t5).size());
+  ASSERT_THROW(workflow->addControlDependency(t4, t7), std::invalid_argument);
+  ASSERT_THROW(workflow->addControlDependency(t5, t7), std::invalid_argument);
+  ASSERT_EQ(0, workflow->getTaskParents(t7).size());
 }
 
 TEST_F(WorkflowTest, WorkflowTaskThrow) {
@@ -159,6 +293,46 @@ TEST_F(WorkflowTest, IsDone) {
   ASSERT_TRUE(workflow->isDone());
 }
 
+TEST_F(WorkflowTest, ReadyTasks) {
+  ASSERT_EQ(1, workflow->getReadyTasks().size());
+  ASSERT_EQ(t1, workflow->getReadyTasks()[0]);
+  ASSERT_EQ(1, workflow->getReadyClusters().size());
+
+  t1->setState(wrench::WorkflowTask::State::PENDING);
+  ASSERT_EQ(0, workflow->getReadyTasks().size());
+
+  t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+  t1->setState(wrench::WorkflowTask::State::COMPLETED);
+  t3->setInternalState(wrench::WorkflowTask::InternalState::TASK_READY);
+  t3->setState(wrench::WorkflowTask::State::READY);
+  ASSERT_EQ(1, workflow->getReadyTasks().size());
+  ASSERT_EQ(t3, workflow->getReadyTasks()[0]);
+
+  // t2 comes before t3 in the cluster, so it is not added
+  std::map<std::string, std::vector<wrench::WorkflowTask *>> clusters = workflow->getReadyClusters();
+  ASSERT_EQ(1, clusters.size());
+  ASSERT_EQ(1, clusters["cluster-01"].size());
+
+  t2->setInternalState(wrench::WorkflowTask::InternalState::TASK_READY);
+  t2->setState(wrench::WorkflowTask::State::READY);
+  clusters = workflow->getReadyClusters();
+  ASSERT_EQ(1, clusters.size());
+  ASSERT_EQ(2, clusters["cluster-01"].size());
+  ASSERT_EQ(t2, clusters["cluster-01"][0]);
+  ASSERT_EQ(t3, clusters["cluster-01"][1]);
+
+  // Moving a task out of a cluster
+  t3->setClusterID("");
+  clusters = workflow->getReadyClusters();
+  ASSERT_EQ(2, clusters.size());
+  ASSERT_EQ(1, clusters["cluster-01"].size());
+  ASSERT_EQ(1, clusters["task-test-03"].size());
+
+  workflow->removeTask(t3);
+  ASSERT_EQ(1, workflow->getReadyTasks().size());
+  ASSERT_FALSE(workflow->isDone());
+}
+
 TEST_F(WorkflowTest, SumFlops) {
 
   double sum_flops = 0;
@@ -0,0 +1,21 @@
+# list of benchmarks (not built by default: use "make benchmarks")
+set(BENCHMARK_FILES
+        benchmarks/WorkflowReadyTasksBenchmark.cpp
+        benchmarks/DAXLoaderBenchmark.cpp
+        benchmarks/MessageThroughputBenchmark.cpp
+        benchmarks/WorkloadTraceReplayBenchmark.cpp
+        benchmarks/NetworkProximityBenchmark.cpp
+        )
+
+add_custom_target(benchmarks)
+
+foreach (benchmark_file ${BENCHMARK_FILES})
+    get_filename_component(benchmark_name ${benchmark_file} NAME_WE)
+    add_executable(${benchmark_name} EXCLUDE_FROM_ALL ${benchmark_file})
+    if (ENABLE_BATSCHED)
+        target_link_libraries(${benchmark_name} wrench ${SIMGRID_LIBRARY} ${PUGIXML_LIBRARY} ${LEMON_LIBRARY} -lzmq)
+    else()
+        target_link_libraries(${benchmark_name} wrench ${SIMGRID_LIBRARY} ${PUGIXML_LIBRARY} ${LEMON_LIBRARY})
+    endif()
+    add_dependencies(benchmarks ${benchmark_name})
+endforeach ()